@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/bsp/bsp.c ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c ../src/config/default/peripheral/aic/plib_aic.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/matrix/plib_matrix.c ../src/config/default/peripheral/mmu/plib_mmu.c ../src/config/default/peripheral/pio/plib_pio.c ../src/config/default/peripheral/tc/plib_tc0.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/cache/sys_cache.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/int/src/sys_int.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_scsi.c ../src/config/default/usb/src/usb_host_msd.c ../src/config/default/cstartup.S ../src/config/default/initialization.c ../src/config/default/tasks.c ../src/config/default/usb_host_init_data.c ../src/config/default/fault_handlers.c ../src/config/default/interrupts.c ../src/third_party/tflite-micro/tensorflow/lite/c/common.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp ../src/app.c ../src/main.c ../src/model.c ../src/mlapp_ssd_mobilenet.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp ../src/config/default/debug_log.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp
+SOURCEFILES_QUOTED_IF_SPACED=../src/config/default/bsp/bsp.c ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c ../src/config/default/peripheral/aic/plib_aic.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/matrix/plib_matrix.c ../src/config/default/peripheral/mmu/plib_mmu.c ../src/config/default/peripheral/pio/plib_pio.c ../src/config/default/peripheral/tc/plib_tc0.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/cache/sys_cache.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/int/src/sys_int.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_scsi.c ../src/config/default/usb/src/usb_host_msd.c ../src/config/default/cstartup.S ../src/config/default/initialization.c ../src/config/default/tasks.c ../src/config/default/usb_host_init_data.c ../src/config/default/fault_handlers.c ../src/config/default/interrupts.c ../src/third_party/tflite-micro/tensorflow/lite/c/common.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp ../src/app.c ../src/bmp_input.c ../src/main.c ../src/model.c ../src/mlapp_ssd_mobilenet.cpp ../src/config/default/micro_time.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp ../src/config/default/debug_log.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ${OBJECTDIR}/_ext/60163497/plib_aic.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ${OBJECTDIR}/_ext/60177924/plib_pio.o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1881668453/sys_int.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ${OBJECTDIR}/_ext/1171490990/cstartup.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/tasks.o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/398855315/common.o ${OBJECTDIR}/_ext/970912416/error_reporter.o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ${OBJECTDIR}/_ext/1222731669/activations.o ${OBJECTDIR}/_ext/1222731669/activations_common.o ${OBJECTDIR}/_ext/1222731669/add.o ${OBJECTDIR}/_ext/1222731669/add_common.o ${OBJECTDIR}/_ext/1222731669/add_n.o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ${OBJECTDIR}/_ext/1222731669/call_once.o ${OBJECTDIR}/_ext/1222731669/cast.o ${OBJECTDIR}/_ext/1222731669/ceil.o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ${OBJECTDIR}/_ext/1222731669/comparisons.o ${OBJECTDIR}/_ext/1222731669/concatenation.o ${OBJECTDIR}/_ext/1222731669/conv.o ${OBJECTDIR}/_ext/1222731669/conv_common.o ${OBJECTDIR}/_ext/1222731669/cumsum.o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ${OBJECTDIR}/_ext/1222731669/dequantize.o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ${OBJECTDIR}/_ext/1222731669/elementwise.o ${OBJECTDIR}/_ext/1222731669/elu.o ${OBJECTDIR}/_ext/1222731669/ethosu.o ${OBJECTDIR}/_ext/1222731669/exp.o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ${OBJECTDIR}/_ext/1222731669/floor.o ${OBJECTDIR}/_ext/1222731669/floor_div.o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ${OBJECTDIR}/_ext/1222731669/gather.o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ${OBJECTDIR}/_ext/1222731669/if.o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ${OBJECTDIR}/_ext/1222731669/l2norm.o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ${OBJECTDIR}/_ext/1222731669/logical.o ${OBJECTDIR}/_ext/1222731669/logical_common.o ${OBJECTDIR}/_ext/1222731669/logistic.o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o ${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o ${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_time.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1434821282/bsp.o.d ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d ${OBJECTDIR}/_ext/60163497/plib_aic.o.d ${OBJECTDIR}/_ext/60165520/plib_clk.o.d ${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d ${OBJECTDIR}/_ext/60175171/plib_mmu.o.d ${OBJECTDIR}/_ext/60177924/plib_pio.o.d ${OBJECTDIR}/_ext/829342655/plib_tc0.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1014039709/sys_cache.o.d ${OBJECTDIR}/_ext/411819097/ff.o.d ${OBJECTDIR}/_ext/411819097/ffunicode.o.d ${OBJECTDIR}/_ext/565198302/diskio.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d ${OBJECTDIR}/_ext/1881668453/sys_int.o.d ${OBJECTDIR}/_ext/101884895/sys_time.o.d ${OBJECTDIR}/_ext/308758920/usb_host.o.d ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d ${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d ${OBJECTDIR}/_ext/1171490990/cstartup.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/tasks.o.d ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d ${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/398855315/common.o.d ${OBJECTDIR}/_ext/970912416/error_reporter.o.d ${OBJECTDIR}/_ext/970912416/tensor_utils.o.d ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d ${OBJECTDIR}/_ext/2119355252/quantization_util.o.d ${OBJECTDIR}/_ext/2084290720/kernel_util.o.d ${OBJECTDIR}/_ext/1222731669/activations.o.d ${OBJECTDIR}/_ext/1222731669/activations_common.o.d ${OBJECTDIR}/_ext/1222731669/add.o.d ${OBJECTDIR}/_ext/1222731669/add_common.o.d ${OBJECTDIR}/_ext/1222731669/add_n.o.d ${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d ${OBJECTDIR}/_ext/1222731669/assign_variable.o.d ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d ${OBJECTDIR}/_ext/1222731669/call_once.o.d ${OBJECTDIR}/_ext/1222731669/cast.o.d ${OBJECTDIR}/_ext/1222731669/ceil.o.d ${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d ${OBJECTDIR}/_ext/1222731669/comparisons.o.d ${OBJECTDIR}/_ext/1222731669/concatenation.o.d ${OBJECTDIR}/_ext/1222731669/conv.o.d ${OBJECTDIR}/_ext/1222731669/conv_common.o.d ${OBJECTDIR}/_ext/1222731669/cumsum.o.d ${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d ${OBJECTDIR}/_ext/1222731669/dequantize.o.d ${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d ${OBJECTDIR}/_ext/1222731669/elementwise.o.d ${OBJECTDIR}/_ext/1222731669/elu.o.d ${OBJECTDIR}/_ext/1222731669/ethosu.o.d ${OBJECTDIR}/_ext/1222731669/exp.o.d ${OBJECTDIR}/_ext/1222731669/expand_dims.o.d ${OBJECTDIR}/_ext/1222731669/floor.o.d ${OBJECTDIR}/_ext/1222731669/floor_div.o.d ${OBJECTDIR}/_ext/1222731669/floor_mod.o.d ${OBJECTDIR}/_ext/1222731669/fully_connected.o.d ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d ${OBJECTDIR}/_ext/1222731669/gather.o.d ${OBJECTDIR}/_ext/1222731669/gather_nd.o.d ${OBJECTDIR}/_ext/1222731669/hard_swish.o.d ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d ${OBJECTDIR}/_ext/1222731669/if.o.d ${OBJECTDIR}/_ext/1222731669/kernel_util.o.d ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d ${OBJECTDIR}/_ext/1222731669/l2norm.o.d ${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d ${OBJECTDIR}/_ext/1222731669/log_softmax.o.d ${OBJECTDIR}/_ext/1222731669/logical.o.d ${OBJECTDIR}/_ext/1222731669/logical_common.o.d ${OBJECTDIR}/_ext/1222731669/logistic.o.d ${OBJECTDIR}/_ext/1222731669/logistic_common.o.d ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d ${OBJECTDIR}/_ext/1222731669/mul.o.d ${OBJECTDIR}/_ext/1222731669/mul_common.o.d ${OBJECTDIR}/_ext/1222731669/neg.o.d ${OBJECTDIR}/_ext/1222731669/pack.o.d ${OBJECTDIR}/_ext/1222731669/pad.o.d ${OBJECTDIR}/_ext/1222731669/pooling.o.d ${OBJECTDIR}/_ext/1222731669/pooling_common.o.d ${OBJECTDIR}/_ext/1222731669/prelu.o.d ${OBJECTDIR}/_ext/1222731669/prelu_common.o.d ${OBJECTDIR}/_ext/1222731669/quantize.o.d ${OBJECTDIR}/_ext/1222731669/quantize_common.o.d ${OBJECTDIR}/_ext/1222731669/read_variable.o.d ${OBJECTDIR}/_ext/1222731669/reduce.o.d ${OBJECTDIR}/_ext/1222731669/reshape.o.d ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d ${OBJECTDIR}/_ext/1222731669/round.o.d ${OBJECTDIR}/_ext/1222731669/shape.o.d ${OBJECTDIR}/_ext/1222731669/slice.o.d ${OBJECTDIR}/_ext/1222731669/softmax.o.d ${OBJECTDIR}/_ext/1222731669/softmax_common.o.d ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d ${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d ${OBJECTDIR}/_ext/1222731669/split.o.d ${OBJECTDIR}/_ext/1222731669/split_v.o.d ${OBJECTDIR}/_ext/1222731669/squeeze.o.d ${OBJECTDIR}/_ext/1222731669/strided_slice.o.d ${OBJECTDIR}/_ext/1222731669/sub.o.d ${OBJECTDIR}/_ext/1222731669/sub_common.o.d ${OBJECTDIR}/_ext/1222731669/svdf.o.d ${OBJECTDIR}/_ext/1222731669/svdf_common.o.d ${OBJECTDIR}/_ext/1222731669/tanh.o.d ${OBJECTDIR}/_ext/1222731669/transpose.o.d ${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d ${OBJECTDIR}/_ext/1222731669/unpack.o.d ${OBJECTDIR}/_ext/1222731669/var_handle.o.d ${OBJECTDIR}/_ext/1222731669/zeros_like.o.d ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d ${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d ${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d ${OBJECTDIR}/_ext/1966695218/micro_context.o.d ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d ${OBJECTDIR}/_ext/1966695218/micro_graph.o.d ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d ${OBJECTDIR}/_ext/1966695218/micro_string.o.d ${OBJECTDIR}/_ext/1966695218/micro_time.o.d ${OBJECTDIR}/_ext/1966695218/micro_utils.o.d ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d ${OBJECTDIR}/_ext/1966695218/system_setup.o.d ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d ${OBJECTDIR}/_ext/1360937237/app.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/model.o.d ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d ${OBJECTDIR}/_ext/1171490990/debug_log.o.d ${OBJECTDIR}/_ext/970912416/op_resolver.o.d ${OBJECTDIR}/_ext/671639337/schema_utils.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ${OBJECTDIR}/_ext/60163497/plib_aic.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ${OBJECTDIR}/_ext/60177924/plib_pio.o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1881668453/sys_int.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ${OBJECTDIR}/_ext/1171490990/cstartup.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/tasks.o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/398855315/common.o ${OBJECTDIR}/_ext/970912416/error_reporter.o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ${OBJECTDIR}/_ext/1222731669/activations.o ${OBJECTDIR}/_ext/1222731669/activations_common.o ${OBJECTDIR}/_ext/1222731669/add.o ${OBJECTDIR}/_ext/1222731669/add_common.o ${OBJECTDIR}/_ext/1222731669/add_n.o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ${OBJECTDIR}/_ext/1222731669/call_once.o ${OBJECTDIR}/_ext/1222731669/cast.o ${OBJECTDIR}/_ext/1222731669/ceil.o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ${OBJECTDIR}/_ext/1222731669/comparisons.o ${OBJECTDIR}/_ext/1222731669/concatenation.o ${OBJECTDIR}/_ext/1222731669/conv.o ${OBJECTDIR}/_ext/1222731669/conv_common.o ${OBJECTDIR}/_ext/1222731669/cumsum.o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ${OBJECTDIR}/_ext/1222731669/dequantize.o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ${OBJECTDIR}/_ext/1222731669/elementwise.o ${OBJECTDIR}/_ext/1222731669/elu.o ${OBJECTDIR}/_ext/1222731669/ethosu.o ${OBJECTDIR}/_ext/1222731669/exp.o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ${OBJECTDIR}/_ext/1222731669/floor.o ${OBJECTDIR}/_ext/1222731669/floor_div.o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ${OBJECTDIR}/_ext/1222731669/gather.o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ${OBJECTDIR}/_ext/1222731669/if.o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ${OBJECTDIR}/_ext/1222731669/l2norm.o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ${OBJECTDIR}/_ext/1222731669/logical.o ${OBJECTDIR}/_ext/1222731669/logical_common.o ${OBJECTDIR}/_ext/1222731669/logistic.o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o ${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o ${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/1171490990/micro_time.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1434821282/bsp.o.d ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d ${OBJECTDIR}/_ext/60163497/plib_aic.o.d ${OBJECTDIR}/_ext/60165520/plib_clk.o.d ${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d ${OBJECTDIR}/_ext/60175171/plib_mmu.o.d ${OBJECTDIR}/_ext/60177924/plib_pio.o.d ${OBJECTDIR}/_ext/829342655/plib_tc0.o.d ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d ${OBJECTDIR}/_ext/1014039709/sys_cache.o.d ${OBJECTDIR}/_ext/411819097/ff.o.d ${OBJECTDIR}/_ext/411819097/ffunicode.o.d ${OBJECTDIR}/_ext/565198302/diskio.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d ${OBJECTDIR}/_ext/1881668453/sys_int.o.d ${OBJECTDIR}/_ext/101884895/sys_time.o.d ${OBJECTDIR}/_ext/308758920/usb_host.o.d ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d ${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d ${OBJECTDIR}/_ext/1171490990/cstartup.o.d ${OBJECTDIR}/_ext/1171490990/initialization.o.d ${OBJECTDIR}/_ext/1171490990/tasks.o.d ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d ${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d ${OBJECTDIR}/_ext/1171490990/interrupts.o.d ${OBJECTDIR}/_ext/398855315/common.o.d ${OBJECTDIR}/_ext/970912416/error_reporter.o.d ${OBJECTDIR}/_ext/970912416/tensor_utils.o.d ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d ${OBJECTDIR}/_ext/2119355252/quantization_util.o.d ${OBJECTDIR}/_ext/2084290720/kernel_util.o.d ${OBJECTDIR}/_ext/1222731669/activations.o.d ${OBJECTDIR}/_ext/1222731669/activations_common.o.d ${OBJECTDIR}/_ext/1222731669/add.o.d ${OBJECTDIR}/_ext/1222731669/add_common.o.d ${OBJECTDIR}/_ext/1222731669/add_n.o.d ${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d ${OBJECTDIR}/_ext/1222731669/assign_variable.o.d ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d ${OBJECTDIR}/_ext/1222731669/call_once.o.d ${OBJECTDIR}/_ext/1222731669/cast.o.d ${OBJECTDIR}/_ext/1222731669/ceil.o.d ${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d ${OBJECTDIR}/_ext/1222731669/comparisons.o.d ${OBJECTDIR}/_ext/1222731669/concatenation.o.d ${OBJECTDIR}/_ext/1222731669/conv.o.d ${OBJECTDIR}/_ext/1222731669/conv_common.o.d ${OBJECTDIR}/_ext/1222731669/cumsum.o.d ${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d ${OBJECTDIR}/_ext/1222731669/dequantize.o.d ${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d ${OBJECTDIR}/_ext/1222731669/elementwise.o.d ${OBJECTDIR}/_ext/1222731669/elu.o.d ${OBJECTDIR}/_ext/1222731669/ethosu.o.d ${OBJECTDIR}/_ext/1222731669/exp.o.d ${OBJECTDIR}/_ext/1222731669/expand_dims.o.d ${OBJECTDIR}/_ext/1222731669/floor.o.d ${OBJECTDIR}/_ext/1222731669/floor_div.o.d ${OBJECTDIR}/_ext/1222731669/floor_mod.o.d ${OBJECTDIR}/_ext/1222731669/fully_connected.o.d ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d ${OBJECTDIR}/_ext/1222731669/gather.o.d ${OBJECTDIR}/_ext/1222731669/gather_nd.o.d ${OBJECTDIR}/_ext/1222731669/hard_swish.o.d ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d ${OBJECTDIR}/_ext/1222731669/if.o.d ${OBJECTDIR}/_ext/1222731669/kernel_util.o.d ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d ${OBJECTDIR}/_ext/1222731669/l2norm.o.d ${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d ${OBJECTDIR}/_ext/1222731669/log_softmax.o.d ${OBJECTDIR}/_ext/1222731669/logical.o.d ${OBJECTDIR}/_ext/1222731669/logical_common.o.d ${OBJECTDIR}/_ext/1222731669/logistic.o.d ${OBJECTDIR}/_ext/1222731669/logistic_common.o.d ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d ${OBJECTDIR}/_ext/1222731669/mul.o.d ${OBJECTDIR}/_ext/1222731669/mul_common.o.d ${OBJECTDIR}/_ext/1222731669/neg.o.d ${OBJECTDIR}/_ext/1222731669/pack.o.d ${OBJECTDIR}/_ext/1222731669/pad.o.d ${OBJECTDIR}/_ext/1222731669/pooling.o.d ${OBJECTDIR}/_ext/1222731669/pooling_common.o.d ${OBJECTDIR}/_ext/1222731669/prelu.o.d ${OBJECTDIR}/_ext/1222731669/prelu_common.o.d ${OBJECTDIR}/_ext/1222731669/quantize.o.d ${OBJECTDIR}/_ext/1222731669/quantize_common.o.d ${OBJECTDIR}/_ext/1222731669/read_variable.o.d ${OBJECTDIR}/_ext/1222731669/reduce.o.d ${OBJECTDIR}/_ext/1222731669/reshape.o.d ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d ${OBJECTDIR}/_ext/1222731669/round.o.d ${OBJECTDIR}/_ext/1222731669/shape.o.d ${OBJECTDIR}/_ext/1222731669/slice.o.d ${OBJECTDIR}/_ext/1222731669/softmax.o.d ${OBJECTDIR}/_ext/1222731669/softmax_common.o.d ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d ${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d ${OBJECTDIR}/_ext/1222731669/split.o.d ${OBJECTDIR}/_ext/1222731669/split_v.o.d ${OBJECTDIR}/_ext/1222731669/squeeze.o.d ${OBJECTDIR}/_ext/1222731669/strided_slice.o.d ${OBJECTDIR}/_ext/1222731669/sub.o.d ${OBJECTDIR}/_ext/1222731669/sub_common.o.d ${OBJECTDIR}/_ext/1222731669/svdf.o.d ${OBJECTDIR}/_ext/1222731669/svdf_common.o.d ${OBJECTDIR}/_ext/1222731669/tanh.o.d ${OBJECTDIR}/_ext/1222731669/transpose.o.d ${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d ${OBJECTDIR}/_ext/1222731669/unpack.o.d ${OBJECTDIR}/_ext/1222731669/var_handle.o.d ${OBJECTDIR}/_ext/1222731669/zeros_like.o.d ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d ${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d ${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d ${OBJECTDIR}/_ext/1966695218/micro_context.o.d ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d ${OBJECTDIR}/_ext/1966695218/micro_graph.o.d ${OBJECTDIR}/_ext/1966695218/micro_fusion.o.d ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d ${OBJECTDIR}/_ext/1966695218/micro_string.o.d ${OBJECTDIR}/_ext/1966695218/micro_profiler.o.d ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o.d ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o.d ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o.d ${OBJECTDIR}/_ext/1966695218/micro_utils.o.d ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d ${OBJECTDIR}/_ext/1966695218/system_setup.o.d ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d ${OBJECTDIR}/_ext/1360937237/app.o.d ${OBJECTDIR}/_ext/1360937237/bmp_input.o.d ${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/model.o.d ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d ${OBJECTDIR}/_ext/1171490990/micro_time.o.d ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d ${OBJECTDIR}/_ext/1171490990/debug_log.o.d ${OBJECTDIR}/_ext/970912416/op_resolver.o.d ${OBJECTDIR}/_ext/671639337/schema_utils.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ${OBJECTDIR}/_ext/60163497/plib_aic.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ${OBJECTDIR}/_ext/60177924/plib_pio.o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1881668453/sys_int.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ${OBJECTDIR}/_ext/1171490990/cstartup.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/tasks.o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/398855315/common.o ${OBJECTDIR}/_ext/970912416/error_reporter.o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ${OBJECTDIR}/_ext/1222731669/activations.o ${OBJECTDIR}/_ext/1222731669/activations_common.o ${OBJECTDIR}/_ext/1222731669/add.o ${OBJECTDIR}/_ext/1222731669/add_common.o ${OBJECTDIR}/_ext/1222731669/add_n.o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ${OBJECTDIR}/_ext/1222731669/call_once.o ${OBJECTDIR}/_ext/1222731669/cast.o ${OBJECTDIR}/_ext/1222731669/ceil.o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ${OBJECTDIR}/_ext/1222731669/comparisons.o ${OBJECTDIR}/_ext/1222731669/concatenation.o ${OBJECTDIR}/_ext/1222731669/conv.o ${OBJECTDIR}/_ext/1222731669/conv_common.o ${OBJECTDIR}/_ext/1222731669/cumsum.o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ${OBJECTDIR}/_ext/1222731669/dequantize.o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ${OBJECTDIR}/_ext/1222731669/elementwise.o ${OBJECTDIR}/_ext/1222731669/elu.o ${OBJECTDIR}/_ext/1222731669/ethosu.o ${OBJECTDIR}/_ext/1222731669/exp.o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ${OBJECTDIR}/_ext/1222731669/floor.o ${OBJECTDIR}/_ext/1222731669/floor_div.o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ${OBJECTDIR}/_ext/1222731669/gather.o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ${OBJECTDIR}/_ext/1222731669/if.o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ${OBJECTDIR}/_ext/1222731669/l2norm.o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ${OBJECTDIR}/_ext/1222731669/logical.o ${OBJECTDIR}/_ext/1222731669/logical_common.o ${OBJECTDIR}/_ext/1222731669/logistic.o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o ${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o ${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_time.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o
+OBJECTFILES=${OBJECTDIR}/_ext/1434821282/bsp.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ${OBJECTDIR}/_ext/60163497/plib_aic.o ${OBJECTDIR}/_ext/60165520/plib_clk.o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ${OBJECTDIR}/_ext/60177924/plib_pio.o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ${OBJECTDIR}/_ext/411819097/ff.o ${OBJECTDIR}/_ext/411819097/ffunicode.o ${OBJECTDIR}/_ext/565198302/diskio.o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ${OBJECTDIR}/_ext/1881668453/sys_int.o ${OBJECTDIR}/_ext/101884895/sys_time.o ${OBJECTDIR}/_ext/308758920/usb_host.o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ${OBJECTDIR}/_ext/1171490990/cstartup.o ${OBJECTDIR}/_ext/1171490990/initialization.o ${OBJECTDIR}/_ext/1171490990/tasks.o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ${OBJECTDIR}/_ext/1171490990/interrupts.o ${OBJECTDIR}/_ext/398855315/common.o ${OBJECTDIR}/_ext/970912416/error_reporter.o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ${OBJECTDIR}/_ext/1222731669/activations.o ${OBJECTDIR}/_ext/1222731669/activations_common.o ${OBJECTDIR}/_ext/1222731669/add.o ${OBJECTDIR}/_ext/1222731669/add_common.o ${OBJECTDIR}/_ext/1222731669/add_n.o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ${OBJECTDIR}/_ext/1222731669/call_once.o ${OBJECTDIR}/_ext/1222731669/cast.o ${OBJECTDIR}/_ext/1222731669/ceil.o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ${OBJECTDIR}/_ext/1222731669/comparisons.o ${OBJECTDIR}/_ext/1222731669/concatenation.o ${OBJECTDIR}/_ext/1222731669/conv.o ${OBJECTDIR}/_ext/1222731669/conv_common.o ${OBJECTDIR}/_ext/1222731669/cumsum.o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ${OBJECTDIR}/_ext/1222731669/dequantize.o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ${OBJECTDIR}/_ext/1222731669/elementwise.o ${OBJECTDIR}/_ext/1222731669/elu.o ${OBJECTDIR}/_ext/1222731669/ethosu.o ${OBJECTDIR}/_ext/1222731669/exp.o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ${OBJECTDIR}/_ext/1222731669/floor.o ${OBJECTDIR}/_ext/1222731669/floor_div.o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ${OBJECTDIR}/_ext/1222731669/gather.o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ${OBJECTDIR}/_ext/1222731669/if.o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ${OBJECTDIR}/_ext/1222731669/l2norm.o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ${OBJECTDIR}/_ext/1222731669/logical.o ${OBJECTDIR}/_ext/1222731669/logical_common.o ${OBJECTDIR}/_ext/1222731669/logistic.o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o ${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o ${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/1171490990/micro_time.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o
 
 # Source Files
-SOURCEFILES=../src/config/default/bsp/bsp.c ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c ../src/config/default/peripheral/aic/plib_aic.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/matrix/plib_matrix.c ../src/config/default/peripheral/mmu/plib_mmu.c ../src/config/default/peripheral/pio/plib_pio.c ../src/config/default/peripheral/tc/plib_tc0.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/cache/sys_cache.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/int/src/sys_int.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_scsi.c ../src/config/default/usb/src/usb_host_msd.c ../src/config/default/cstartup.S ../src/config/default/initialization.c ../src/config/default/tasks.c ../src/config/default/usb_host_init_data.c ../src/config/default/fault_handlers.c ../src/config/default/interrupts.c ../src/third_party/tflite-micro/tensorflow/lite/c/common.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp ../src/app.c ../src/main.c ../src/model.c ../src/mlapp_ssd_mobilenet.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp ../src/config/default/debug_log.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp
+SOURCEFILES=../src/config/default/bsp/bsp.c ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c ../src/config/default/peripheral/aic/plib_aic.c ../src/config/default/peripheral/clk/plib_clk.c ../src/config/default/peripheral/matrix/plib_matrix.c ../src/config/default/peripheral/mmu/plib_mmu.c ../src/config/default/peripheral/pio/plib_pio.c ../src/config/default/peripheral/tc/plib_tc0.c ../src/config/default/peripheral/uart/plib_uart1.c ../src/config/default/stdio/xc32_monitor.c ../src/config/default/system/cache/sys_cache.c ../src/config/default/system/fs/fat_fs/file_system/ff.c ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c ../src/config/default/system/fs/src/sys_fs_fat_interface.c ../src/config/default/system/fs/src/sys_fs_media_manager.c ../src/config/default/system/fs/src/sys_fs.c ../src/config/default/system/int/src/sys_int.c ../src/config/default/system/time/src/sys_time.c ../src/config/default/usb/src/usb_host.c ../src/config/default/usb/src/usb_host_scsi.c ../src/config/default/usb/src/usb_host_msd.c ../src/config/default/cstartup.S ../src/config/default/initialization.c ../src/config/default/tasks.c ../src/config/default/usb_host_init_data.c ../src/config/default/fault_handlers.c ../src/config/default/interrupts.c ../src/third_party/tflite-micro/tensorflow/lite/c/common.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp ../src/app.c ../src/bmp_input.c ../src/main.c ../src/model.c ../src/mlapp_ssd_mobilenet.cpp ../src/config/default/micro_time.cpp ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp ../src/config/default/debug_log.c ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp
 
 # Pack Options 
 PACK_COMMON_OPTIONS=-I "${CMSIS_DIR}/CMSIS/Core_A/Include"
@@ -124,398 +124,410 @@ ${OBJECTDIR}/_ext/1434821282/bsp.o: ../src/config/default/bsp/bsp.c  .generated_
 	@${MKDIR} "${OBJECTDIR}/_ext/1434821282" 
 	@${RM} ${OBJECTDIR}/_ext/1434821282/bsp.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1434821282/bsp.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1434821282/bsp.o.d" -o ${OBJECTDIR}/_ext/1434821282/bsp.o ../src/config/default/bsp/bsp.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1434821282/bsp.o.d" -o ${OBJECTDIR}/_ext/1434821282/bsp.o ../src/config/default/bsp/bsp.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o: ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c  .generated_files/flags/default/845075dc685a74379a95af8f90d56e4f3823aba3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1535495969" 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o: ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c  .generated_files/flags/default/432ad48e2b60e3c1ac34618e84052af817680f72 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1535495969" 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60163497/plib_aic.o: ../src/config/default/peripheral/aic/plib_aic.c  .generated_files/flags/default/3741339b9f8886d2e53646e2d03461a9b57ae8f0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60163497" 
 	@${RM} ${OBJECTDIR}/_ext/60163497/plib_aic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60163497/plib_aic.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60163497/plib_aic.o.d" -o ${OBJECTDIR}/_ext/60163497/plib_aic.o ../src/config/default/peripheral/aic/plib_aic.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60163497/plib_aic.o.d" -o ${OBJECTDIR}/_ext/60163497/plib_aic.o ../src/config/default/peripheral/aic/plib_aic.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60165520/plib_clk.o: ../src/config/default/peripheral/clk/plib_clk.c  .generated_files/flags/default/17fba69ca0479272dc30864e5f748ff3e4dbf647 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60165520" 
 	@${RM} ${OBJECTDIR}/_ext/60165520/plib_clk.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60165520/plib_clk.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60165520/plib_clk.o.d" -o ${OBJECTDIR}/_ext/60165520/plib_clk.o ../src/config/default/peripheral/clk/plib_clk.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60165520/plib_clk.o.d" -o ${OBJECTDIR}/_ext/60165520/plib_clk.o ../src/config/default/peripheral/clk/plib_clk.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1666157715/plib_matrix.o: ../src/config/default/peripheral/matrix/plib_matrix.c  .generated_files/flags/default/dea49a27ac8ea38f1f27198ed7babe6c314c3deb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1666157715" 
 	@${RM} ${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1666157715/plib_matrix.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d" -o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ../src/config/default/peripheral/matrix/plib_matrix.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d" -o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ../src/config/default/peripheral/matrix/plib_matrix.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60175171/plib_mmu.o: ../src/config/default/peripheral/mmu/plib_mmu.c  .generated_files/flags/default/ed6b4f315a0c29054f12dc00c904f5846034c49 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60175171" 
 	@${RM} ${OBJECTDIR}/_ext/60175171/plib_mmu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60175171/plib_mmu.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60175171/plib_mmu.o.d" -o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ../src/config/default/peripheral/mmu/plib_mmu.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60175171/plib_mmu.o.d" -o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ../src/config/default/peripheral/mmu/plib_mmu.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60177924/plib_pio.o: ../src/config/default/peripheral/pio/plib_pio.c  .generated_files/flags/default/65bc16bdebbed6e05c8dd6affafe6f1726665556 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60177924" 
 	@${RM} ${OBJECTDIR}/_ext/60177924/plib_pio.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60177924/plib_pio.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60177924/plib_pio.o.d" -o ${OBJECTDIR}/_ext/60177924/plib_pio.o ../src/config/default/peripheral/pio/plib_pio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60177924/plib_pio.o.d" -o ${OBJECTDIR}/_ext/60177924/plib_pio.o ../src/config/default/peripheral/pio/plib_pio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/829342655/plib_tc0.o: ../src/config/default/peripheral/tc/plib_tc0.c  .generated_files/flags/default/463094f19757fb0ef66ad4a0ca5c6c1be9afdb08 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/829342655" 
 	@${RM} ${OBJECTDIR}/_ext/829342655/plib_tc0.o.d 
 	@${RM} ${OBJECTDIR}/_ext/829342655/plib_tc0.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/829342655/plib_tc0.o.d" -o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ../src/config/default/peripheral/tc/plib_tc0.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/829342655/plib_tc0.o.d" -o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ../src/config/default/peripheral/tc/plib_tc0.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1865657120/plib_uart1.o: ../src/config/default/peripheral/uart/plib_uart1.c  .generated_files/flags/default/48502a52b27ae52f4ca44efa938e9982720d0200 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1865657120" 
 	@${RM} ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1865657120/plib_uart1.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d" -o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ../src/config/default/peripheral/uart/plib_uart1.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d" -o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ../src/config/default/peripheral/uart/plib_uart1.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/163028504/xc32_monitor.o: ../src/config/default/stdio/xc32_monitor.c  .generated_files/flags/default/a60dbf66e94e7d08728445fa109dd0e5b9429b81 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/163028504" 
 	@${RM} ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/163028504/xc32_monitor.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d" -o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ../src/config/default/stdio/xc32_monitor.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d" -o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ../src/config/default/stdio/xc32_monitor.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1014039709/sys_cache.o: ../src/config/default/system/cache/sys_cache.c  .generated_files/flags/default/51b88fce56a2b0ec46447c6f3e2c5caa2cbea2ed .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1014039709" 
 	@${RM} ${OBJECTDIR}/_ext/1014039709/sys_cache.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1014039709/sys_cache.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1014039709/sys_cache.o.d" -o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ../src/config/default/system/cache/sys_cache.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1014039709/sys_cache.o.d" -o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ../src/config/default/system/cache/sys_cache.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/411819097/ff.o: ../src/config/default/system/fs/fat_fs/file_system/ff.c  .generated_files/flags/default/c58507140982fc82d8b1e91dc5f655e54c1f7f4c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/411819097" 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ff.o.d 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ff.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ff.o.d" -o ${OBJECTDIR}/_ext/411819097/ff.o ../src/config/default/system/fs/fat_fs/file_system/ff.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ff.o.d" -o ${OBJECTDIR}/_ext/411819097/ff.o ../src/config/default/system/fs/fat_fs/file_system/ff.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/411819097/ffunicode.o: ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c  .generated_files/flags/default/248c1823bfaefec9cc50758b5b51a58c9d375efb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/411819097" 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ffunicode.o.d 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ffunicode.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ffunicode.o.d" -o ${OBJECTDIR}/_ext/411819097/ffunicode.o ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ffunicode.o.d" -o ${OBJECTDIR}/_ext/411819097/ffunicode.o ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/565198302/diskio.o: ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c  .generated_files/flags/default/c6fa63e91dbc0ccca894ee1bf2baf622a85644d2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/565198302" 
 	@${RM} ${OBJECTDIR}/_ext/565198302/diskio.o.d 
 	@${RM} ${OBJECTDIR}/_ext/565198302/diskio.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/565198302/diskio.o.d" -o ${OBJECTDIR}/_ext/565198302/diskio.o ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/565198302/diskio.o.d" -o ${OBJECTDIR}/_ext/565198302/diskio.o ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o: ../src/config/default/system/fs/src/sys_fs_fat_interface.c  .generated_files/flags/default/bf985e1a3e54679e590f8829e652ae3f3e041226 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ../src/config/default/system/fs/src/sys_fs_fat_interface.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ../src/config/default/system/fs/src/sys_fs_fat_interface.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o: ../src/config/default/system/fs/src/sys_fs_media_manager.c  .generated_files/flags/default/52d8d0206f696a1ed15347758172bbad9f3c91f1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ../src/config/default/system/fs/src/sys_fs_media_manager.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ../src/config/default/system/fs/src/sys_fs_media_manager.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs.o: ../src/config/default/system/fs/src/sys_fs.c  .generated_files/flags/default/a0389751b208e6710471242e42cdcd1cba8b5cf5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ../src/config/default/system/fs/src/sys_fs.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ../src/config/default/system/fs/src/sys_fs.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1881668453/sys_int.o: ../src/config/default/system/int/src/sys_int.c  .generated_files/flags/default/964b4fdb7f00b8bd21685f1e99024a39604b7a11 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1881668453" 
 	@${RM} ${OBJECTDIR}/_ext/1881668453/sys_int.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1881668453/sys_int.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1881668453/sys_int.o.d" -o ${OBJECTDIR}/_ext/1881668453/sys_int.o ../src/config/default/system/int/src/sys_int.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1881668453/sys_int.o.d" -o ${OBJECTDIR}/_ext/1881668453/sys_int.o ../src/config/default/system/int/src/sys_int.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/101884895/sys_time.o: ../src/config/default/system/time/src/sys_time.c  .generated_files/flags/default/8f4034b56b32cf8b304a5b4a9ba2ce7f5cb6e176 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/101884895" 
 	@${RM} ${OBJECTDIR}/_ext/101884895/sys_time.o.d 
 	@${RM} ${OBJECTDIR}/_ext/101884895/sys_time.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/101884895/sys_time.o.d" -o ${OBJECTDIR}/_ext/101884895/sys_time.o ../src/config/default/system/time/src/sys_time.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/101884895/sys_time.o.d" -o ${OBJECTDIR}/_ext/101884895/sys_time.o ../src/config/default/system/time/src/sys_time.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host.o: ../src/config/default/usb/src/usb_host.c  .generated_files/flags/default/3a11828ff8c0a87fcd3dd18398ee5c25abbcff27 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host.o ../src/config/default/usb/src/usb_host.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host.o ../src/config/default/usb/src/usb_host.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o: ../src/config/default/usb/src/usb_host_scsi.c  .generated_files/flags/default/8c931088419090ff9dcbb74b38cf0b3bfae088ca .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ../src/config/default/usb/src/usb_host_scsi.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ../src/config/default/usb/src/usb_host_scsi.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host_msd.o: ../src/config/default/usb/src/usb_host_msd.c  .generated_files/flags/default/fa91bc665ee8745ac72111afa7d3d4c591c9c63b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_msd.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ../src/config/default/usb/src/usb_host_msd.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ../src/config/default/usb/src/usb_host_msd.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/initialization.o: ../src/config/default/initialization.c  .generated_files/flags/default/baae4f30d42cd3a35a99bc4f4f89221c6fab29c2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/initialization.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/initialization.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/initialization.o.d" -o ${OBJECTDIR}/_ext/1171490990/initialization.o ../src/config/default/initialization.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/initialization.o.d" -o ${OBJECTDIR}/_ext/1171490990/initialization.o ../src/config/default/initialization.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/tasks.o: ../src/config/default/tasks.c  .generated_files/flags/default/69f58465abbc244eeea65c0b081e73943159d72f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/tasks.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/tasks.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/tasks.o.d" -o ${OBJECTDIR}/_ext/1171490990/tasks.o ../src/config/default/tasks.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/tasks.o.d" -o ${OBJECTDIR}/_ext/1171490990/tasks.o ../src/config/default/tasks.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o: ../src/config/default/usb_host_init_data.c  .generated_files/flags/default/9e8d0136a436e8250e5d4e7a2581d522cd469b2a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d" -o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ../src/config/default/usb_host_init_data.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d" -o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ../src/config/default/usb_host_init_data.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/fault_handlers.o: ../src/config/default/fault_handlers.c  .generated_files/flags/default/78d5dfb10b9f9b69455234ab70db258f28ee2536 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/fault_handlers.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d" -o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ../src/config/default/fault_handlers.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d" -o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ../src/config/default/fault_handlers.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/interrupts.o: ../src/config/default/interrupts.c  .generated_files/flags/default/7f35a8e01a42db582adec7197661a1cd26e076f5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/interrupts.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/interrupts.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/interrupts.o.d" -o ${OBJECTDIR}/_ext/1171490990/interrupts.o ../src/config/default/interrupts.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/interrupts.o.d" -o ${OBJECTDIR}/_ext/1171490990/interrupts.o ../src/config/default/interrupts.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/398855315/common.o: ../src/third_party/tflite-micro/tensorflow/lite/c/common.c  .generated_files/flags/default/d6ffb9c94748ebb896bc0d9d78851b8c234e9f9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/398855315" 
 	@${RM} ${OBJECTDIR}/_ext/398855315/common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/398855315/common.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/398855315/common.o.d" -o ${OBJECTDIR}/_ext/398855315/common.o ../src/third_party/tflite-micro/tensorflow/lite/c/common.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/398855315/common.o.d" -o ${OBJECTDIR}/_ext/398855315/common.o ../src/third_party/tflite-micro/tensorflow/lite/c/common.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/app.o: ../src/app.c  .generated_files/flags/default/992d3df304d05e7e785b066e062d3d2da85d2e75 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1360937237/bmp_input.o: ../src/bmp_input.c  .generated_files/flags/default/992d3df304d05e7e785b066e062d3d2da85d2e75 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/bmp_input.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/bmp_input.o 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/bmp_input.o.d" -o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ../src/bmp_input.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/main.o: ../src/main.c  .generated_files/flags/default/8f6fd93f69e699975c97d2d6bf2271a4ed26f7e8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/model.o: ../src/model.c  .generated_files/flags/default/b2ff74a21ee2e0518c29d66d7e197d933dca3461 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/model.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/model.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/model.o.d" -o ${OBJECTDIR}/_ext/1360937237/model.o ../src/model.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/model.o.d" -o ${OBJECTDIR}/_ext/1360937237/model.o ../src/model.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/debug_log.o: ../src/config/default/debug_log.c  .generated_files/flags/default/d139e7f6d72d10677ef000028e630fed7c17e5a0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/debug_log.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/debug_log.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/debug_log.o.d" -o ${OBJECTDIR}/_ext/1171490990/debug_log.o ../src/config/default/debug_log.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/debug_log.o.d" -o ${OBJECTDIR}/_ext/1171490990/debug_log.o ../src/config/default/debug_log.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 else
 ${OBJECTDIR}/_ext/1434821282/bsp.o: ../src/config/default/bsp/bsp.c  .generated_files/flags/default/d65641296c523baed25fd728118a2d88c06e5b3b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1434821282" 
 	@${RM} ${OBJECTDIR}/_ext/1434821282/bsp.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1434821282/bsp.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1434821282/bsp.o.d" -o ${OBJECTDIR}/_ext/1434821282/bsp.o ../src/config/default/bsp/bsp.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1434821282/bsp.o.d" -o ${OBJECTDIR}/_ext/1434821282/bsp.o ../src/config/default/bsp/bsp.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o: ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c  .generated_files/flags/default/66cf70e4e09c1e091edc3eab00e77bab59d990f5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1535495969" 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ohci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ohci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o: ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c  .generated_files/flags/default/7a48e89d761976d66f89980cb4e5d83526cb56d6 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1535495969" 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o.d" -o ${OBJECTDIR}/_ext/1535495969/drv_usb_ehci.o ../src/config/default/driver/usb/uhp/src/drv_usb_ehci.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60163497/plib_aic.o: ../src/config/default/peripheral/aic/plib_aic.c  .generated_files/flags/default/55557a621259f56743ee668c36941cdae376d28d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60163497" 
 	@${RM} ${OBJECTDIR}/_ext/60163497/plib_aic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60163497/plib_aic.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60163497/plib_aic.o.d" -o ${OBJECTDIR}/_ext/60163497/plib_aic.o ../src/config/default/peripheral/aic/plib_aic.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60163497/plib_aic.o.d" -o ${OBJECTDIR}/_ext/60163497/plib_aic.o ../src/config/default/peripheral/aic/plib_aic.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60165520/plib_clk.o: ../src/config/default/peripheral/clk/plib_clk.c  .generated_files/flags/default/5a3235a402032b5b958969b432ba1f86698bfeb0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60165520" 
 	@${RM} ${OBJECTDIR}/_ext/60165520/plib_clk.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60165520/plib_clk.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60165520/plib_clk.o.d" -o ${OBJECTDIR}/_ext/60165520/plib_clk.o ../src/config/default/peripheral/clk/plib_clk.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60165520/plib_clk.o.d" -o ${OBJECTDIR}/_ext/60165520/plib_clk.o ../src/config/default/peripheral/clk/plib_clk.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1666157715/plib_matrix.o: ../src/config/default/peripheral/matrix/plib_matrix.c  .generated_files/flags/default/bfc99bcc2069ff5ba63c17b01f1751661f31bbd9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1666157715" 
 	@${RM} ${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1666157715/plib_matrix.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d" -o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ../src/config/default/peripheral/matrix/plib_matrix.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1666157715/plib_matrix.o.d" -o ${OBJECTDIR}/_ext/1666157715/plib_matrix.o ../src/config/default/peripheral/matrix/plib_matrix.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60175171/plib_mmu.o: ../src/config/default/peripheral/mmu/plib_mmu.c  .generated_files/flags/default/48e716c3b315e4d54218617285f9e9301bea3525 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60175171" 
 	@${RM} ${OBJECTDIR}/_ext/60175171/plib_mmu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60175171/plib_mmu.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60175171/plib_mmu.o.d" -o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ../src/config/default/peripheral/mmu/plib_mmu.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60175171/plib_mmu.o.d" -o ${OBJECTDIR}/_ext/60175171/plib_mmu.o ../src/config/default/peripheral/mmu/plib_mmu.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/60177924/plib_pio.o: ../src/config/default/peripheral/pio/plib_pio.c  .generated_files/flags/default/1f06b6da95f6c4a9cbdf023762f6308149f125f1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/60177924" 
 	@${RM} ${OBJECTDIR}/_ext/60177924/plib_pio.o.d 
 	@${RM} ${OBJECTDIR}/_ext/60177924/plib_pio.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60177924/plib_pio.o.d" -o ${OBJECTDIR}/_ext/60177924/plib_pio.o ../src/config/default/peripheral/pio/plib_pio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/60177924/plib_pio.o.d" -o ${OBJECTDIR}/_ext/60177924/plib_pio.o ../src/config/default/peripheral/pio/plib_pio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/829342655/plib_tc0.o: ../src/config/default/peripheral/tc/plib_tc0.c  .generated_files/flags/default/e90a3e884801fa2089dc8083f4ec65639ed01823 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/829342655" 
 	@${RM} ${OBJECTDIR}/_ext/829342655/plib_tc0.o.d 
 	@${RM} ${OBJECTDIR}/_ext/829342655/plib_tc0.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/829342655/plib_tc0.o.d" -o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ../src/config/default/peripheral/tc/plib_tc0.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/829342655/plib_tc0.o.d" -o ${OBJECTDIR}/_ext/829342655/plib_tc0.o ../src/config/default/peripheral/tc/plib_tc0.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1865657120/plib_uart1.o: ../src/config/default/peripheral/uart/plib_uart1.c  .generated_files/flags/default/5d7b1b8d9c3e3a6fabad7923a3100a0787162aeb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1865657120" 
 	@${RM} ${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1865657120/plib_uart1.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d" -o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ../src/config/default/peripheral/uart/plib_uart1.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1865657120/plib_uart1.o.d" -o ${OBJECTDIR}/_ext/1865657120/plib_uart1.o ../src/config/default/peripheral/uart/plib_uart1.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/163028504/xc32_monitor.o: ../src/config/default/stdio/xc32_monitor.c  .generated_files/flags/default/4264579793dfafc3a35e69ff7b52c8782a28460c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/163028504" 
 	@${RM} ${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/163028504/xc32_monitor.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d" -o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ../src/config/default/stdio/xc32_monitor.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/163028504/xc32_monitor.o.d" -o ${OBJECTDIR}/_ext/163028504/xc32_monitor.o ../src/config/default/stdio/xc32_monitor.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1014039709/sys_cache.o: ../src/config/default/system/cache/sys_cache.c  .generated_files/flags/default/e9755c688f662cb49123210c1d10fea875f170de .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1014039709" 
 	@${RM} ${OBJECTDIR}/_ext/1014039709/sys_cache.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1014039709/sys_cache.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1014039709/sys_cache.o.d" -o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ../src/config/default/system/cache/sys_cache.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1014039709/sys_cache.o.d" -o ${OBJECTDIR}/_ext/1014039709/sys_cache.o ../src/config/default/system/cache/sys_cache.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/411819097/ff.o: ../src/config/default/system/fs/fat_fs/file_system/ff.c  .generated_files/flags/default/e961f86e093a10b84d13f9e2010ecfebc92a4bb3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/411819097" 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ff.o.d 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ff.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ff.o.d" -o ${OBJECTDIR}/_ext/411819097/ff.o ../src/config/default/system/fs/fat_fs/file_system/ff.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ff.o.d" -o ${OBJECTDIR}/_ext/411819097/ff.o ../src/config/default/system/fs/fat_fs/file_system/ff.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/411819097/ffunicode.o: ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c  .generated_files/flags/default/8ef103389582f7d7fad4654de7eaa05a5eddfe5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/411819097" 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ffunicode.o.d 
 	@${RM} ${OBJECTDIR}/_ext/411819097/ffunicode.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ffunicode.o.d" -o ${OBJECTDIR}/_ext/411819097/ffunicode.o ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/411819097/ffunicode.o.d" -o ${OBJECTDIR}/_ext/411819097/ffunicode.o ../src/config/default/system/fs/fat_fs/file_system/ffunicode.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/565198302/diskio.o: ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c  .generated_files/flags/default/93d96be84cd4c4894e0ee9a18ce7ef843ddf92df .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/565198302" 
 	@${RM} ${OBJECTDIR}/_ext/565198302/diskio.o.d 
 	@${RM} ${OBJECTDIR}/_ext/565198302/diskio.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/565198302/diskio.o.d" -o ${OBJECTDIR}/_ext/565198302/diskio.o ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/565198302/diskio.o.d" -o ${OBJECTDIR}/_ext/565198302/diskio.o ../src/config/default/system/fs/fat_fs/hardware_access/diskio.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o: ../src/config/default/system/fs/src/sys_fs_fat_interface.c  .generated_files/flags/default/f9bdc352a56b3d2529d1e5cf2bcc3867881c55b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ../src/config/default/system/fs/src/sys_fs_fat_interface.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_fat_interface.o ../src/config/default/system/fs/src/sys_fs_fat_interface.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o: ../src/config/default/system/fs/src/sys_fs_media_manager.c  .generated_files/flags/default/3da1e73e04c0d905aeb119ce30cd7fc3b2826574 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ../src/config/default/system/fs/src/sys_fs_media_manager.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs_media_manager.o ../src/config/default/system/fs/src/sys_fs_media_manager.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1269487135/sys_fs.o: ../src/config/default/system/fs/src/sys_fs.c  .generated_files/flags/default/d03daba7bc1d2462cfacaeef0b36ea8bc7f8ce75 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1269487135" 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1269487135/sys_fs.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ../src/config/default/system/fs/src/sys_fs.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1269487135/sys_fs.o.d" -o ${OBJECTDIR}/_ext/1269487135/sys_fs.o ../src/config/default/system/fs/src/sys_fs.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1881668453/sys_int.o: ../src/config/default/system/int/src/sys_int.c  .generated_files/flags/default/6ec4fd8118fc44559c934f6107faede7400a4d76 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1881668453" 
 	@${RM} ${OBJECTDIR}/_ext/1881668453/sys_int.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1881668453/sys_int.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1881668453/sys_int.o.d" -o ${OBJECTDIR}/_ext/1881668453/sys_int.o ../src/config/default/system/int/src/sys_int.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1881668453/sys_int.o.d" -o ${OBJECTDIR}/_ext/1881668453/sys_int.o ../src/config/default/system/int/src/sys_int.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/101884895/sys_time.o: ../src/config/default/system/time/src/sys_time.c  .generated_files/flags/default/a061f5fcf66da9643ce664e1a8315e5f78c1a156 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/101884895" 
 	@${RM} ${OBJECTDIR}/_ext/101884895/sys_time.o.d 
 	@${RM} ${OBJECTDIR}/_ext/101884895/sys_time.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/101884895/sys_time.o.d" -o ${OBJECTDIR}/_ext/101884895/sys_time.o ../src/config/default/system/time/src/sys_time.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/101884895/sys_time.o.d" -o ${OBJECTDIR}/_ext/101884895/sys_time.o ../src/config/default/system/time/src/sys_time.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host.o: ../src/config/default/usb/src/usb_host.c  .generated_files/flags/default/ebc2813a21e2f18dd17c320cfa610cec04c8caf7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host.o ../src/config/default/usb/src/usb_host.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host.o ../src/config/default/usb/src/usb_host.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o: ../src/config/default/usb/src/usb_host_scsi.c  .generated_files/flags/default/89239a8804fe9931004ab3157d2269f007abdc77 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ../src/config/default/usb/src/usb_host_scsi.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_scsi.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_scsi.o ../src/config/default/usb/src/usb_host_scsi.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/308758920/usb_host_msd.o: ../src/config/default/usb/src/usb_host_msd.c  .generated_files/flags/default/97ac89c68846d6f345e13cdc1c96442f58129aa5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/308758920" 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/308758920/usb_host_msd.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ../src/config/default/usb/src/usb_host_msd.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/308758920/usb_host_msd.o.d" -o ${OBJECTDIR}/_ext/308758920/usb_host_msd.o ../src/config/default/usb/src/usb_host_msd.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/initialization.o: ../src/config/default/initialization.c  .generated_files/flags/default/adb63f090dfd73633759f86572f9bfa690c90b47 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/initialization.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/initialization.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/initialization.o.d" -o ${OBJECTDIR}/_ext/1171490990/initialization.o ../src/config/default/initialization.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/initialization.o.d" -o ${OBJECTDIR}/_ext/1171490990/initialization.o ../src/config/default/initialization.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/tasks.o: ../src/config/default/tasks.c  .generated_files/flags/default/f53efc742404c42f26820784f6c950e65f4f273f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/tasks.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/tasks.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/tasks.o.d" -o ${OBJECTDIR}/_ext/1171490990/tasks.o ../src/config/default/tasks.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/tasks.o.d" -o ${OBJECTDIR}/_ext/1171490990/tasks.o ../src/config/default/tasks.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o: ../src/config/default/usb_host_init_data.c  .generated_files/flags/default/980af18b4334f29ba4808b49a335b5c058675074 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d" -o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ../src/config/default/usb_host_init_data.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o.d" -o ${OBJECTDIR}/_ext/1171490990/usb_host_init_data.o ../src/config/default/usb_host_init_data.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/fault_handlers.o: ../src/config/default/fault_handlers.c  .generated_files/flags/default/9ee34cdadf785dcdfbb55feb724c0c4954df574e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/fault_handlers.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d" -o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ../src/config/default/fault_handlers.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/fault_handlers.o.d" -o ${OBJECTDIR}/_ext/1171490990/fault_handlers.o ../src/config/default/fault_handlers.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/interrupts.o: ../src/config/default/interrupts.c  .generated_files/flags/default/375ab872bcccab8f38e81748387968e3f90523a8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/interrupts.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/interrupts.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/interrupts.o.d" -o ${OBJECTDIR}/_ext/1171490990/interrupts.o ../src/config/default/interrupts.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/interrupts.o.d" -o ${OBJECTDIR}/_ext/1171490990/interrupts.o ../src/config/default/interrupts.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/398855315/common.o: ../src/third_party/tflite-micro/tensorflow/lite/c/common.c  .generated_files/flags/default/c10d11670cacec32da79d16c296351ab5afabd96 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/398855315" 
 	@${RM} ${OBJECTDIR}/_ext/398855315/common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/398855315/common.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/398855315/common.o.d" -o ${OBJECTDIR}/_ext/398855315/common.o ../src/third_party/tflite-micro/tensorflow/lite/c/common.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/398855315/common.o.d" -o ${OBJECTDIR}/_ext/398855315/common.o ../src/third_party/tflite-micro/tensorflow/lite/c/common.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/app.o: ../src/app.c  .generated_files/flags/default/694718ff15933f5d9e81c7c56e9085a875e39930 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/app.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/app.o.d" -o ${OBJECTDIR}/_ext/1360937237/app.o ../src/app.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1360937237/bmp_input.o: ../src/bmp_input.c  .generated_files/flags/default/694718ff15933f5d9e81c7c56e9085a875e39930 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/bmp_input.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1360937237/bmp_input.o 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/bmp_input.o.d" -o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ../src/bmp_input.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/main.o: ../src/main.c  .generated_files/flags/default/85be0301cee636bf759d7b95435d2de37bce69c1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/main.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/main.o.d" -o ${OBJECTDIR}/_ext/1360937237/main.o ../src/main.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/model.o: ../src/model.c  .generated_files/flags/default/24bd09489df476c01dedb704c68ee97e62360446 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/model.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/model.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/model.o.d" -o ${OBJECTDIR}/_ext/1360937237/model.o ../src/model.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/model.o.d" -o ${OBJECTDIR}/_ext/1360937237/model.o ../src/model.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1171490990/debug_log.o: ../src/config/default/debug_log.c  .generated_files/flags/default/f83005c9d3e459ee0e0a4bcd7f06c53a3886d681 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/debug_log.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1171490990/debug_log.o 
-	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/debug_log.o.d" -o ${OBJECTDIR}/_ext/1171490990/debug_log.o ../src/config/default/debug_log.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -ffunction-sections -fdata-sections -fno-common -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/debug_log.o.d" -o ${OBJECTDIR}/_ext/1171490990/debug_log.o ../src/config/default/debug_log.c    -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 endif
 
@@ -526,1334 +538,1394 @@ ${OBJECTDIR}/_ext/970912416/error_reporter.o: ../src/third_party/tflite-micro/te
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/error_reporter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/error_reporter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/error_reporter.o.d" -o ${OBJECTDIR}/_ext/970912416/error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/error_reporter.o.d" -o ${OBJECTDIR}/_ext/970912416/error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/tensor_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp  .generated_files/flags/default/56d26104a5c9ea089fa5ce6b3e60ef9d04aebb35 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/tensor_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/tensor_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/tensor_utils.o.d" -o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/tensor_utils.o.d" -o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp  .generated_files/flags/default/328e759f799256f6dbdd76d9680215217bf2ee80 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1859847800" 
 	@${RM} ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d" -o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d" -o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/2119355252/quantization_util.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp  .generated_files/flags/default/3039ca554e4842f3f53157a441c18d4d56a51965 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2119355252" 
 	@${RM} ${OBJECTDIR}/_ext/2119355252/quantization_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2119355252/quantization_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2119355252/quantization_util.o.d" -o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2119355252/quantization_util.o.d" -o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/2084290720/kernel_util.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp  .generated_files/flags/default/7a3a6b9e54d2351fdebbbdf829b6af0987bf756f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2084290720" 
 	@${RM} ${OBJECTDIR}/_ext/2084290720/kernel_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2084290720/kernel_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2084290720/kernel_util.o.d" -o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2084290720/kernel_util.o.d" -o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/activations.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp  .generated_files/flags/default/2fbfd5e7c10b3a4d8e338af26ab5f18ae3a48231 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/activations_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp  .generated_files/flags/default/5a3f98d4b7388549c23c4593a9aa7f7ae3facde9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp  .generated_files/flags/default/6b98811cca46716b01770812f5348ffe638a4780 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add.o.d" -o ${OBJECTDIR}/_ext/1222731669/add.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add.o.d" -o ${OBJECTDIR}/_ext/1222731669/add.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp  .generated_files/flags/default/fa7961f30267d37ac2fce83b407248b40f094f3f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add_n.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp  .generated_files/flags/default/f09ec01054e970f56b5102d594b00552241522a2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_n.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_n.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_n.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_n.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_n.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_n.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/arg_min_max.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp  .generated_files/flags/default/cd69e74185bada9e7ddb6dc5d1b1ddc46368f1e1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/arg_min_max.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d" -o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d" -o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/assign_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp  .generated_files/flags/default/8f06f8ceb12ffa891d5afceeefd069bc0a3de74d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/assign_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/assign_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/assign_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/assign_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp  .generated_files/flags/default/94f5f8ee0b2b4c590b861a1fc7c36e8b51d6b202 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/call_once.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp  .generated_files/flags/default/c52fdff32fd76dc726bfc72c2693884028477783 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/call_once.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/call_once.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/call_once.o.d" -o ${OBJECTDIR}/_ext/1222731669/call_once.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/call_once.o.d" -o ${OBJECTDIR}/_ext/1222731669/call_once.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/cast.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp  .generated_files/flags/default/f53e68c03cde35fb399f7f1e3e470f7734f85bee .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cast.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cast.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cast.o.d" -o ${OBJECTDIR}/_ext/1222731669/cast.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cast.o.d" -o ${OBJECTDIR}/_ext/1222731669/cast.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/ceil.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp  .generated_files/flags/default/c272c1f309e5d65776092f9e7156893657a8d6e4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ceil.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ceil.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ceil.o.d" -o ${OBJECTDIR}/_ext/1222731669/ceil.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ceil.o.d" -o ${OBJECTDIR}/_ext/1222731669/ceil.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/circular_buffer.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp  .generated_files/flags/default/dfcd096e0387dfc8087d95a7929ad3f0669b5e7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp  .generated_files/flags/default/dc21b37d746022be72282bd7164098be4c3743d0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/comparisons.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp  .generated_files/flags/default/3485fdb8b687d144fe3fcac5ecb41cd5d6198d85 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/comparisons.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/comparisons.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/comparisons.o.d" -o ${OBJECTDIR}/_ext/1222731669/comparisons.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/comparisons.o.d" -o ${OBJECTDIR}/_ext/1222731669/comparisons.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/concatenation.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp  .generated_files/flags/default/c74a45e5daf0f553d3b539b1fc6ae006f48b7f46 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/concatenation.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/concatenation.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/concatenation.o.d" -o ${OBJECTDIR}/_ext/1222731669/concatenation.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/concatenation.o.d" -o ${OBJECTDIR}/_ext/1222731669/concatenation.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp  .generated_files/flags/default/d7064154e01d2d3a1625ccf3cb6089dc78668ac5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/conv_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp  .generated_files/flags/default/4ccf3d65628d087d0c8b6de4c571764281691431 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/cumsum.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp  .generated_files/flags/default/f9c1eb196c4490f0b85e98477223c6d433a52265 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cumsum.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cumsum.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cumsum.o.d" -o ${OBJECTDIR}/_ext/1222731669/cumsum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cumsum.o.d" -o ${OBJECTDIR}/_ext/1222731669/cumsum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depth_to_space.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp  .generated_files/flags/default/c93f21d7a92ce449140da3d5cc4514267d137e46 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depth_to_space.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d" -o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d" -o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp  .generated_files/flags/default/a21c8f96440186554e7859d30307e361252551cd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp  .generated_files/flags/default/1309193bc40194b717ebed04883de2f1356fea70 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/dequantize.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp  .generated_files/flags/default/ee425e71df686b45fa16794dab3b3eb37393c5bd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/dequantize_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp  .generated_files/flags/default/e4cf85f4f00ce70f7672bb0f22aa6a73301fcae7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp  .generated_files/flags/default/da2b4cb8f31b08939ae1dfdcccfe33b74eeeb5a2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d" -o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d" -o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/elementwise.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp  .generated_files/flags/default/e441cfcfa1feeaae940152140934b751bf2ca6e6 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elementwise.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elementwise.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elementwise.o.d" -o ${OBJECTDIR}/_ext/1222731669/elementwise.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elementwise.o.d" -o ${OBJECTDIR}/_ext/1222731669/elementwise.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/elu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp  .generated_files/flags/default/437ace26f1be375d0a34a2efd9ab473d65628767 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elu.o.d" -o ${OBJECTDIR}/_ext/1222731669/elu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elu.o.d" -o ${OBJECTDIR}/_ext/1222731669/elu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/ethosu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp  .generated_files/flags/default/f48982f342d2dfa4115ca74c5c24d1bc2888d70 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ethosu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ethosu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ethosu.o.d" -o ${OBJECTDIR}/_ext/1222731669/ethosu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ethosu.o.d" -o ${OBJECTDIR}/_ext/1222731669/ethosu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/exp.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp  .generated_files/flags/default/fce9517e384aac3c44bcddff26f0dd43143e3a7e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/exp.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/exp.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/exp.o.d" -o ${OBJECTDIR}/_ext/1222731669/exp.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/exp.o.d" -o ${OBJECTDIR}/_ext/1222731669/exp.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/expand_dims.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp  .generated_files/flags/default/b4c3fc17245b3e95c8ebcb7ea0c0d0e106b800a5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/expand_dims.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/expand_dims.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/expand_dims.o.d" -o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/expand_dims.o.d" -o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp  .generated_files/flags/default/fc3e21f1cf097f945419f5b38b1ae6d3fb8870d8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor_div.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp  .generated_files/flags/default/c260f4afdbf4f7a27e7bba3755427216e94bc6bb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_div.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_div.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_div.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_div.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_div.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_div.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor_mod.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp  .generated_files/flags/default/5d4bbfe57a0efa0cffd339e2484c1eb1d83b4c8b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_mod.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_mod.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_mod.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_mod.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/fully_connected.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp  .generated_files/flags/default/11cc78abdb71b55d6a2dd0d82c133651addacb4a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp  .generated_files/flags/default/f737c9b420847dba553a63449c793147707b782a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/gather.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp  .generated_files/flags/default/23c801e1b2245d3273e9358243b3bcf10c2bd911 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/gather_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp  .generated_files/flags/default/88e79ba5b0f30cdfae5b981d07550f64f59f6010 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/hard_swish.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp  .generated_files/flags/default/102659e656c4018a35ba97173c33c15d1271572b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp  .generated_files/flags/default/34e7a0216c5f5078b84dda34ac37369fa8d98ff1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/if.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp  .generated_files/flags/default/23147f8a0b1fa7f328bd3deb488d89e75b7a161 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/if.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/if.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/if.o.d" -o ${OBJECTDIR}/_ext/1222731669/if.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/if.o.d" -o ${OBJECTDIR}/_ext/1222731669/if.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/kernel_util.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp  .generated_files/flags/default/b62df4676eedfe798d13aac72accfcf3cde1c428 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/kernel_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/kernel_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/kernel_util.o.d" -o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/kernel_util.o.d" -o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp  .generated_files/flags/default/1161686a34b354f0ddad3bc4082866ef2cb68939 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/l2norm.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp  .generated_files/flags/default/bfdb6dbaffe84e6fe61fdd90210896694881e25 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2norm.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2norm.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2norm.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2norm.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2norm.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2norm.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/leaky_relu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp  .generated_files/flags/default/d464884efefcd17d37c4ba0b53739d20ba7d14f4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp  .generated_files/flags/default/b60479629984995effe458ede4bda967536406ce .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/log_softmax.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp  .generated_files/flags/default/d66a04032c31af891d24507035b0870a2fe16211 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/log_softmax.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/log_softmax.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/log_softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/log_softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logical.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp  .generated_files/flags/default/ad2caa11da0b96b8f7cc66d1ada2e6fe8278f03d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logical_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp  .generated_files/flags/default/64d061304f5fe1fff99a8e635dbca42b692cac61 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logistic.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp  .generated_files/flags/default/ea027a9249c788da1d3cb094aa2fb92fd328bebd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logistic_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp  .generated_files/flags/default/7d2a31bdc4c2e1ab567f9f5b0abd7673334db97 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp  .generated_files/flags/default/ac9a0134eed42b245d2be1363693f5fee24095f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d" -o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d" -o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/mul.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp  .generated_files/flags/default/3f76695c5d64bd1988cdcc6b1f641e0bcc5a6d34 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/mul_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp  .generated_files/flags/default/55c9160269d3ba5b544318423344f3180deb625c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/neg.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp  .generated_files/flags/default/2e8aeed2c94397c4ceb40d6fa7d1e0a551aa24a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/neg.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/neg.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/neg.o.d" -o ${OBJECTDIR}/_ext/1222731669/neg.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/neg.o.d" -o ${OBJECTDIR}/_ext/1222731669/neg.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pack.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp  .generated_files/flags/default/b8c95f195f2acb7955e6ebe75dd83f3f90d34043 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pack.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pack.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pack.o.d" -o ${OBJECTDIR}/_ext/1222731669/pack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pack.o.d" -o ${OBJECTDIR}/_ext/1222731669/pack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pad.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp  .generated_files/flags/default/7200dd14a233d24463643f989297fee9cd0da309 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pad.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pad.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pad.o.d" -o ${OBJECTDIR}/_ext/1222731669/pad.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pad.o.d" -o ${OBJECTDIR}/_ext/1222731669/pad.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pooling.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp  .generated_files/flags/default/8d4618b3f7485f8a09efb924ee32ef7aff9e346c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pooling_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp  .generated_files/flags/default/a6b93dd79b393cd9e9982169707ec8091b818f78 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/prelu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp  .generated_files/flags/default/5dc36af86850616173a4782c2587656c5671cf76 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/prelu_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp  .generated_files/flags/default/355f5383cd47c3b386a2b6a8ef5f6b1053c5bcb3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/quantize.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp  .generated_files/flags/default/a1ec79f25cb52d80c2ccd5e06c35b5de51c4337f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/quantize_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp  .generated_files/flags/default/8f92c417a61930955c9c34a99c288ba6a32cf485 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/read_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp  .generated_files/flags/default/13c186f87f9548ae54bc9fbc4acfb60d807bf359 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/read_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/read_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/read_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/read_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/read_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/read_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/reduce.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp  .generated_files/flags/default/47021b6092e8347fd4e878ec1ca2a5f616cfc1a1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reduce.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reduce.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reduce.o.d" -o ${OBJECTDIR}/_ext/1222731669/reduce.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reduce.o.d" -o ${OBJECTDIR}/_ext/1222731669/reduce.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/reshape.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp  .generated_files/flags/default/5d9370a991e75ca587d1e8fecd118786841a54a2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reshape.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reshape.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reshape.o.d" -o ${OBJECTDIR}/_ext/1222731669/reshape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reshape.o.d" -o ${OBJECTDIR}/_ext/1222731669/reshape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp  .generated_files/flags/default/d565828341e7b70877f4fbb8daad6ebb01f4fbc9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp  .generated_files/flags/default/db4fea81b1dd4b55954ccc60100b9616d40fdf77 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/round.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp  .generated_files/flags/default/e31353cad4be4b262cd2ac606946f3d14cbdf4b5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/round.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/round.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/round.o.d" -o ${OBJECTDIR}/_ext/1222731669/round.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/round.o.d" -o ${OBJECTDIR}/_ext/1222731669/round.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/shape.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp  .generated_files/flags/default/2520f3640d55cbacaf55c9ca3e3b43125aa4da30 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/shape.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/shape.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/shape.o.d" -o ${OBJECTDIR}/_ext/1222731669/shape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/shape.o.d" -o ${OBJECTDIR}/_ext/1222731669/shape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/slice.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp  .generated_files/flags/default/96b139c394ffc25b0338b8755686828439f692b2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/slice.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/slice.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/softmax.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp  .generated_files/flags/default/c568e47ede7567eaeddcd8f7a2d7e203350deaaa .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/softmax_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp  .generated_files/flags/default/7ed9c4af6a53bcb2c6ddcbc713ebaaba38be6f6f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp  .generated_files/flags/default/f0e278b78d3c9280c3d4849582917280dd95ad3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/space_to_depth.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp  .generated_files/flags/default/7eedb362d754b4e4c27b36a9eca6dc91fcf874e2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_depth.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/split.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp  .generated_files/flags/default/d34ebde83e177125361568d6075ffac954fd79cd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split.o.d" -o ${OBJECTDIR}/_ext/1222731669/split.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split.o.d" -o ${OBJECTDIR}/_ext/1222731669/split.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/split_v.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp  .generated_files/flags/default/55791ac59aeccf942cbf7d101e876dc716031eae .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split_v.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split_v.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split_v.o.d" -o ${OBJECTDIR}/_ext/1222731669/split_v.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split_v.o.d" -o ${OBJECTDIR}/_ext/1222731669/split_v.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/squeeze.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp  .generated_files/flags/default/91d3849a5645b7af90a9ce21fdcc0ba45771ac8c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/squeeze.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/squeeze.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/squeeze.o.d" -o ${OBJECTDIR}/_ext/1222731669/squeeze.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/squeeze.o.d" -o ${OBJECTDIR}/_ext/1222731669/squeeze.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/strided_slice.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp  .generated_files/flags/default/4169c7cdf018d18ec04f10be7901eebfc6a07101 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/strided_slice.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/strided_slice.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/strided_slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/strided_slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/sub.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp  .generated_files/flags/default/1059658fa5c1a7baa6153b739dc9bb23bc40261 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/sub_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp  .generated_files/flags/default/9e72ac03d67a6b8cd538932b0c0c241c1c01203e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/svdf.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp  .generated_files/flags/default/7af28e98a5cccb978e07b91685eccb011baa3eca .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/svdf_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp  .generated_files/flags/default/a5f909222326598c54d0c89c26f106280b371f32 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/tanh.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp  .generated_files/flags/default/84baf4f29aa2b11bc4fd0cc0d357f73879d69e0f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/tanh.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/tanh.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/tanh.o.d" -o ${OBJECTDIR}/_ext/1222731669/tanh.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/tanh.o.d" -o ${OBJECTDIR}/_ext/1222731669/tanh.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/transpose.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp  .generated_files/flags/default/40b6046e88f8aa4261fa725d6c26f3011e896cbf .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/transpose_conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp  .generated_files/flags/default/33c7162768b143f9845e1ac60e1467e4f449c04e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose_conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/unpack.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp  .generated_files/flags/default/a5c5a4907b42b9ced5f422aaf11c8477bb48f8f2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/unpack.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/unpack.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/unpack.o.d" -o ${OBJECTDIR}/_ext/1222731669/unpack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/unpack.o.d" -o ${OBJECTDIR}/_ext/1222731669/unpack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/var_handle.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp  .generated_files/flags/default/b9666e16467be493345d1c6e4d2507592ebd397a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/var_handle.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/var_handle.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/var_handle.o.d" -o ${OBJECTDIR}/_ext/1222731669/var_handle.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/var_handle.o.d" -o ${OBJECTDIR}/_ext/1222731669/var_handle.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/zeros_like.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp  .generated_files/flags/default/58dc52805cbd7e2b6335e71cf2340007a1ae99ee .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/zeros_like.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/zeros_like.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/zeros_like.o.d" -o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/zeros_like.o.d" -o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp  .generated_files/flags/default/84900703c3652aa8124c224e9541ba2ea05e492c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/493921269" 
 	@${RM} ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d 
 	@${RM} ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp  .generated_files/flags/default/1bd36731874ee48790a5bf87ce5dc409aea7899 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/493921269" 
 	@${RM} ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d 
 	@${RM} ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/memory_helpers.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp  .generated_files/flags/default/d9c7dc01b553adc2097efa25b57876eafd29b884 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/memory_helpers.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d" -o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d" -o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_allocator.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp  .generated_files/flags/default/c471a079562d1a5b819138159ec0ec73dc3ff451 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_allocator.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_context.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp  .generated_files/flags/default/b74aaab159dac9fa3b20fe2c7fd183dd295cd305 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_context.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_context.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_context.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_context.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_context.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_context.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp  .generated_files/flags/default/424c5fd6306519e2b47c984794e49ac1c670d530 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_graph.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp  .generated_files/flags/default/b9c8e12ebaab463d538dad29c6599a654d6282ba .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_graph.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_graph.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_graph.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_graph.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1966695218/micro_fusion.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp  .generated_files/flags/default/b9c8e12ebaab463d538dad29c6599a654d6282ba .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_fusion.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_fusion.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_fusion.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp  .generated_files/flags/default/3f2ba9a53e95ac609ad1fd760268da15f26b5c1c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp  .generated_files/flags/default/240b311e4a56b443d071e490a634ca6bf217b1bc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_string.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp  .generated_files/flags/default/dc917b46fe3aab9f4f679cf21ece49a7610c2a56 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_string.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_string.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_string.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_string.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_string.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_string.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1966695218/micro_profiler.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp  .generated_files/flags/default/dc917b46fe3aab9f4f679cf21ece49a7610c2a56 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_profiler.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_profiler.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
-${OBJECTDIR}/_ext/1966695218/micro_time.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp  .generated_files/flags/default/237bb9340ae25926ca99ff448f85cbd99b5d512f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp  .generated_files/flags/default/dc917b46fe3aab9f4f679cf21ece49a7610c2a56 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
-	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_time.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_time.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_time.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_time.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp  .generated_files/flags/default/dc917b46fe3aab9f4f679cf21ece49a7610c2a56 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1212356873" 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o.d" -o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp  .generated_files/flags/default/dc917b46fe3aab9f4f679cf21ece49a7610c2a56 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1212356873" 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o.d" -o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp  .generated_files/flags/default/38c615e438d046923544bb266f6463a85ba71990 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp  .generated_files/flags/default/e5d4190eb8b92da18c11b4ea3c6e03aa485bc56d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/system_setup.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp  .generated_files/flags/default/6895357a771f47af7aacbb5da7c3c126099ebaac .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/system_setup.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/system_setup.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/system_setup.o.d" -o ${OBJECTDIR}/_ext/1966695218/system_setup.o ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/system_setup.o.d" -o ${OBJECTDIR}/_ext/1966695218/system_setup.o ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp  .generated_files/flags/default/3a179b2866aa21250c0e14f0db1cb46be4f514b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o: ../src/mlapp_ssd_mobilenet.cpp  .generated_files/flags/default/91fd29a48bcbbffaf26f988013e9b7418fa50b13 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d" -o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ../src/mlapp_ssd_mobilenet.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d" -o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ../src/mlapp_ssd_mobilenet.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1171490990/micro_time.o: ../src/config/default/micro_time.cpp  .generated_files/flags/default/91fd29a48bcbbffaf26f988013e9b7418fa50b13 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
+	@${RM} ${OBJECTDIR}/_ext/1171490990/micro_time.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1171490990/micro_time.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/micro_time.o.d" -o ${OBJECTDIR}/_ext/1171490990/micro_time.o ../src/config/default/micro_time.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp  .generated_files/flags/default/2c95aab3dc326c0175380c4e81b8b9cbd7c2395a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d" -o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d" -o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/op_resolver.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp  .generated_files/flags/default/df1861c896aefb92a37434a2a378934a0b93348c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/op_resolver.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/op_resolver.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/op_resolver.o.d" -o ${OBJECTDIR}/_ext/970912416/op_resolver.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/op_resolver.o.d" -o ${OBJECTDIR}/_ext/970912416/op_resolver.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/671639337/schema_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp  .generated_files/flags/default/8b19a649bca07262ad44d0c3ad30b95fa8f7d4f8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/671639337" 
 	@${RM} ${OBJECTDIR}/_ext/671639337/schema_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/671639337/schema_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/671639337/schema_utils.o.d" -o ${OBJECTDIR}/_ext/671639337/schema_utils.o ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE) -g -D__DEBUG   -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/671639337/schema_utils.o.d" -o ${OBJECTDIR}/_ext/671639337/schema_utils.o ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 else
 ${OBJECTDIR}/_ext/970912416/error_reporter.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp  .generated_files/flags/default/caf3ef5a55e740aa114962f68aaa6c70b2201e0 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/error_reporter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/error_reporter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/error_reporter.o.d" -o ${OBJECTDIR}/_ext/970912416/error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/error_reporter.o.d" -o ${OBJECTDIR}/_ext/970912416/error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/tensor_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp  .generated_files/flags/default/1ff8650ed79a3cb96d99597c89fd39461cbadb33 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/tensor_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/tensor_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/tensor_utils.o.d" -o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/tensor_utils.o.d" -o ${OBJECTDIR}/_ext/970912416/tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp  .generated_files/flags/default/9d8d1a86b6763bed3f68fa2279488b8f3a339e98 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1859847800" 
 	@${RM} ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d" -o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o.d" -o ${OBJECTDIR}/_ext/1859847800/portable_tensor_utils.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/reference/portable_tensor_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/2119355252/quantization_util.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp  .generated_files/flags/default/cc05608b7a7f3af4403fbd581fe93ce76caa85ce .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2119355252" 
 	@${RM} ${OBJECTDIR}/_ext/2119355252/quantization_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2119355252/quantization_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2119355252/quantization_util.o.d" -o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2119355252/quantization_util.o.d" -o ${OBJECTDIR}/_ext/2119355252/quantization_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/internal/quantization_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/2084290720/kernel_util.o: ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp  .generated_files/flags/default/8c9d2467cb86b111134579f811595d99ac683390 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/2084290720" 
 	@${RM} ${OBJECTDIR}/_ext/2084290720/kernel_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/2084290720/kernel_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2084290720/kernel_util.o.d" -o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/2084290720/kernel_util.o.d" -o ${OBJECTDIR}/_ext/2084290720/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/activations.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp  .generated_files/flags/default/503e4f7f552c6df5e0f7b30fd17ccf45923dcfe1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/activations_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp  .generated_files/flags/default/1afb59583d1c924292a537826aa1644a2422279d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/activations_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/activations_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/activations_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/activations_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp  .generated_files/flags/default/1f2d9885abab7f8bb20be2c1a9f3283461a95ff4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add.o.d" -o ${OBJECTDIR}/_ext/1222731669/add.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add.o.d" -o ${OBJECTDIR}/_ext/1222731669/add.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp  .generated_files/flags/default/cbbf6b7628d09782b347c9f3fc7c7104fc1b43a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/add_n.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp  .generated_files/flags/default/f7a365863af4046f77c4005ed9092f9c12fdba91 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_n.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/add_n.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_n.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_n.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/add_n.o.d" -o ${OBJECTDIR}/_ext/1222731669/add_n.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/add_n.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/arg_min_max.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp  .generated_files/flags/default/9ef8b7f3d068049b5e8bb259a91503c076ac7abf .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/arg_min_max.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d" -o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/arg_min_max.o.d" -o ${OBJECTDIR}/_ext/1222731669/arg_min_max.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/arg_min_max.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/assign_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp  .generated_files/flags/default/fb712645b99d2decae32fcc755f52fbd05f66b05 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/assign_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/assign_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/assign_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/assign_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/assign_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/assign_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp  .generated_files/flags/default/fdde266c9f7532e5c3f71afc153be55aa9413a82 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/batch_to_space_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/batch_to_space_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/call_once.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp  .generated_files/flags/default/63efbcb3871f79b2c894e02de89b8140b4aa75e9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/call_once.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/call_once.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/call_once.o.d" -o ${OBJECTDIR}/_ext/1222731669/call_once.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/call_once.o.d" -o ${OBJECTDIR}/_ext/1222731669/call_once.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/call_once.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/cast.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp  .generated_files/flags/default/d3be7856e2fe07e3320d8e837c32b2769e014e5a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cast.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cast.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cast.o.d" -o ${OBJECTDIR}/_ext/1222731669/cast.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cast.o.d" -o ${OBJECTDIR}/_ext/1222731669/cast.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cast.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/ceil.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp  .generated_files/flags/default/c415ac6e7831dfbfc3c34d16703610adc819072 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ceil.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ceil.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ceil.o.d" -o ${OBJECTDIR}/_ext/1222731669/ceil.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ceil.o.d" -o ${OBJECTDIR}/_ext/1222731669/ceil.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ceil.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/circular_buffer.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp  .generated_files/flags/default/76be94fbfe1efbd104e7c615176d0a8973911c6a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp  .generated_files/flags/default/93c7a680f75fd79b6482bc1b00061d3b0a203645 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/circular_buffer_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/circular_buffer_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/comparisons.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp  .generated_files/flags/default/a760b789c9541d32c5e2095b9edb182b10fc5857 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/comparisons.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/comparisons.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/comparisons.o.d" -o ${OBJECTDIR}/_ext/1222731669/comparisons.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/comparisons.o.d" -o ${OBJECTDIR}/_ext/1222731669/comparisons.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/comparisons.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/concatenation.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp  .generated_files/flags/default/775d6221ac3ff5bbe33453e461adb63762c6542d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/concatenation.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/concatenation.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/concatenation.o.d" -o ${OBJECTDIR}/_ext/1222731669/concatenation.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/concatenation.o.d" -o ${OBJECTDIR}/_ext/1222731669/concatenation.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/concatenation.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp  .generated_files/flags/default/8c8164f63978c9c54e5e04be267a9343a0fe95c9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/conv_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp  .generated_files/flags/default/5851d4987c6d2b05afd8185cbe5d0d4fc223a976 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/conv_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/cumsum.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp  .generated_files/flags/default/369f6c3945b2fa641f5a5a198cebd0e23c26143b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cumsum.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/cumsum.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cumsum.o.d" -o ${OBJECTDIR}/_ext/1222731669/cumsum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/cumsum.o.d" -o ${OBJECTDIR}/_ext/1222731669/cumsum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/cumsum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depth_to_space.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp  .generated_files/flags/default/bc11736f9592515b418e7b800a3a343f45e11d3d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depth_to_space.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d" -o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depth_to_space.o.d" -o ${OBJECTDIR}/_ext/1222731669/depth_to_space.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depth_to_space.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp  .generated_files/flags/default/17d89e0e21b79625b66bdf9dcd43ba5af04a47f6 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp  .generated_files/flags/default/ad19a78f13a0ff0291a222d6a79691c7e2f960b5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/depthwise_conv_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/depthwise_conv_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/dequantize.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp  .generated_files/flags/default/afd3d88b0352aefa0d9fd0e6f0d9829b7b9613e5 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/dequantize_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp  .generated_files/flags/default/c610af170fcf77f4abb66b329e0c29d88289f5e8 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/dequantize_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/dequantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/dequantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/dequantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp  .generated_files/flags/default/ba5517e80640679ebd47e6b9a40fbc72533fba7c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d" -o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/detection_postprocess.o.d" -o ${OBJECTDIR}/_ext/1222731669/detection_postprocess.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/detection_postprocess.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/elementwise.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp  .generated_files/flags/default/6857efb001b57ac3ec7b3326db279542983df722 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elementwise.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elementwise.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elementwise.o.d" -o ${OBJECTDIR}/_ext/1222731669/elementwise.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elementwise.o.d" -o ${OBJECTDIR}/_ext/1222731669/elementwise.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elementwise.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/elu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp  .generated_files/flags/default/e8be0f06eeed6834eea98777ac456d0eae8c0ef7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/elu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elu.o.d" -o ${OBJECTDIR}/_ext/1222731669/elu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/elu.o.d" -o ${OBJECTDIR}/_ext/1222731669/elu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/elu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/ethosu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp  .generated_files/flags/default/741267a669ed2268bb0607b0cded866fd05e58de .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ethosu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/ethosu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ethosu.o.d" -o ${OBJECTDIR}/_ext/1222731669/ethosu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/ethosu.o.d" -o ${OBJECTDIR}/_ext/1222731669/ethosu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/ethosu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/exp.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp  .generated_files/flags/default/59bd55ccbb20906986fff189595a91464e3fb8bf .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/exp.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/exp.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/exp.o.d" -o ${OBJECTDIR}/_ext/1222731669/exp.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/exp.o.d" -o ${OBJECTDIR}/_ext/1222731669/exp.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/exp.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/expand_dims.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp  .generated_files/flags/default/7f7538d2c3c0c92416c6dd505d99f5e2a507dfd4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/expand_dims.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/expand_dims.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/expand_dims.o.d" -o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/expand_dims.o.d" -o ${OBJECTDIR}/_ext/1222731669/expand_dims.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/expand_dims.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp  .generated_files/flags/default/d4ee08e67aea1e4430598ebd679b27a2940acdbd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor_div.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp  .generated_files/flags/default/4fadf60708760aec3739ee7b6908ed7926b42444 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_div.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_div.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_div.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_div.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_div.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_div.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_div.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/floor_mod.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp  .generated_files/flags/default/680504af338ae6c14fdbbf5acd3ec5762d380455 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_mod.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/floor_mod.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_mod.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/floor_mod.o.d" -o ${OBJECTDIR}/_ext/1222731669/floor_mod.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/floor_mod.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/fully_connected.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp  .generated_files/flags/default/bbcb908a0a389c7901e2f3ad8fa12a241b998118 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp  .generated_files/flags/default/ebba8967d7ef5738e29bd38e6ffdafde321c22db .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/fully_connected_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/fully_connected_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/fully_connected_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/gather.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp  .generated_files/flags/default/c6c3eb6d81e901f5b996e0fd60f32d18e2515fc7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/gather_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp  .generated_files/flags/default/153d4f10c87dc7ff47e9d50e7730f4cc3cc77f34 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/gather_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/gather_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/gather_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/gather_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/hard_swish.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp  .generated_files/flags/default/eb6c3adcabc772035072ce90f4dd4ff8b133a9d7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp  .generated_files/flags/default/bc4a1487f8fc9fd67f6566524b53999da0d2da42 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/hard_swish_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/hard_swish_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/hard_swish_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/if.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp  .generated_files/flags/default/4b84d1928cdf1ee1c22b35e3fd118cdf5874a13c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/if.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/if.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/if.o.d" -o ${OBJECTDIR}/_ext/1222731669/if.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/if.o.d" -o ${OBJECTDIR}/_ext/1222731669/if.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/if.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/kernel_util.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp  .generated_files/flags/default/2af67201055b1e0bc8171fe32ac0ef7bdbe544de .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/kernel_util.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/kernel_util.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/kernel_util.o.d" -o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/kernel_util.o.d" -o ${OBJECTDIR}/_ext/1222731669/kernel_util.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/kernel_util.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp  .generated_files/flags/default/511eb1d164810b045fc61fe23fb121157daeb978 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2_pool_2d.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2_pool_2d.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/l2norm.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp  .generated_files/flags/default/dd3d767adc44af79343386ab065dea9d18bd3782 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2norm.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/l2norm.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2norm.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2norm.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/l2norm.o.d" -o ${OBJECTDIR}/_ext/1222731669/l2norm.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/l2norm.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/leaky_relu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp  .generated_files/flags/default/c77b359c07d2d7624ff6538681b22458b47bb98 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp  .generated_files/flags/default/c70dcc85d22172073f398282666bddfecb81e230 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/leaky_relu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/leaky_relu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/log_softmax.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp  .generated_files/flags/default/30bf0fe81baf394883daf56e49a874e39f9c9ede .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/log_softmax.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/log_softmax.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/log_softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/log_softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/log_softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/log_softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logical.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp  .generated_files/flags/default/90862e9ce87851bca309dbd8a108743da04da6a7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logical_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp  .generated_files/flags/default/b36942936dca121f41648bc1d847b922daab4897 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logical_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logical_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logical_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logical_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logistic.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp  .generated_files/flags/default/c9b92ad135e130ab6c954c662f599d63c3a52bdc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/logistic_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp  .generated_files/flags/default/4aee362d5732e30065265631c3e85c52d239c011 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/logistic_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/logistic_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/logistic_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/logistic_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp  .generated_files/flags/default/a6ac2d0723747a96ebbf87c6eb22ab829a360c48 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d" -o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/maximum_minimum.o.d" -o ${OBJECTDIR}/_ext/1222731669/maximum_minimum.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/maximum_minimum.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/mul.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp  .generated_files/flags/default/f578cd7af298275e546577334e265f449da1deaa .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/mul_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp  .generated_files/flags/default/a8708f446d52b04522fa5cf2bd5427f11e104657 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/mul_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/mul_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/mul_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/mul_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/neg.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp  .generated_files/flags/default/136309a53b254359157d0ccd24d1454e5a879430 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/neg.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/neg.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/neg.o.d" -o ${OBJECTDIR}/_ext/1222731669/neg.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/neg.o.d" -o ${OBJECTDIR}/_ext/1222731669/neg.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/neg.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pack.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp  .generated_files/flags/default/96fc6cb5cf4544d4982d02c026ea3d2c72e176da .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pack.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pack.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pack.o.d" -o ${OBJECTDIR}/_ext/1222731669/pack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pack.o.d" -o ${OBJECTDIR}/_ext/1222731669/pack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pad.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp  .generated_files/flags/default/b6f5d434893a6fb8f20fcd118457e49e6dd6c3f3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pad.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pad.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pad.o.d" -o ${OBJECTDIR}/_ext/1222731669/pad.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pad.o.d" -o ${OBJECTDIR}/_ext/1222731669/pad.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pad.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pooling.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp  .generated_files/flags/default/85520917a5df9dc3d402e34f4c1c2621b82f8f0a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/pooling_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp  .generated_files/flags/default/17b21e238f80fc314a698b9fa3cb8db6253acd4e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/pooling_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/pooling_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/pooling_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/prelu.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp  .generated_files/flags/default/de02ad50b90f325e255bad6253ea05b4841d322a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/prelu_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp  .generated_files/flags/default/856275c23f58d44b6f76debadfe4ef8526f69c20 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/prelu_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/prelu_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/prelu_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/quantize.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp  .generated_files/flags/default/d67e18eb31422748a587c98cf12d8f14f801dd61 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/quantize_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp  .generated_files/flags/default/3140c4e3f5d35f9914e06077227f82886160e133 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/quantize_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/quantize_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/quantize_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/read_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp  .generated_files/flags/default/2a6f1febd99b156ae264900ad93aa6d09b701b9d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/read_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/read_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/read_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/read_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/read_variable.o.d" -o ${OBJECTDIR}/_ext/1222731669/read_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/read_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/reduce.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp  .generated_files/flags/default/4ceae785e9471f03bc9c5a3224238197e9a22e95 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reduce.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reduce.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reduce.o.d" -o ${OBJECTDIR}/_ext/1222731669/reduce.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reduce.o.d" -o ${OBJECTDIR}/_ext/1222731669/reduce.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reduce.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/reshape.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp  .generated_files/flags/default/670abe6b2b9761552fbf3413fce0a84193175803 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reshape.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/reshape.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reshape.o.d" -o ${OBJECTDIR}/_ext/1222731669/reshape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/reshape.o.d" -o ${OBJECTDIR}/_ext/1222731669/reshape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/reshape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp  .generated_files/flags/default/8a653ba3546eb573711ce84aca5adf801407bf83 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_bilinear.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_bilinear.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp  .generated_files/flags/default/b45730145dd14fe19d013f819e182b3f30baeb88 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o.d" -o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/resize_nearest_neighbor.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/round.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp  .generated_files/flags/default/d536ee12e43cfa2b37e172a0e7da0cb9c8875f15 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/round.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/round.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/round.o.d" -o ${OBJECTDIR}/_ext/1222731669/round.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/round.o.d" -o ${OBJECTDIR}/_ext/1222731669/round.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/round.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/shape.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp  .generated_files/flags/default/bba533c985827ad9fc86222786dca06ce5245be4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/shape.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/shape.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/shape.o.d" -o ${OBJECTDIR}/_ext/1222731669/shape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/shape.o.d" -o ${OBJECTDIR}/_ext/1222731669/shape.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/shape.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/slice.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp  .generated_files/flags/default/a7c6b7249461db79c5c450afbbb32b55931f8af6 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/slice.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/slice.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/softmax.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp  .generated_files/flags/default/edeee907c8ddc3f66dae96acb88b27dc1bfcb78e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/softmax_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp  .generated_files/flags/default/13c874ee8f1a0ca223361d50668527eb6bdac21b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/softmax_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/softmax_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/softmax_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp  .generated_files/flags/default/4d6bde9901f3416ed17f653dea7a2c95ed20eafd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_batch_nd.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/space_to_depth.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp  .generated_files/flags/default/5ef658302ef043c6d0b7289f98a8bfe56c1094eb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/space_to_depth.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/space_to_depth.o.d" -o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/space_to_depth.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/split.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp  .generated_files/flags/default/f918ee5f31facd03b8ba96e701f69242bd9c4c63 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split.o.d" -o ${OBJECTDIR}/_ext/1222731669/split.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split.o.d" -o ${OBJECTDIR}/_ext/1222731669/split.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/split_v.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp  .generated_files/flags/default/6df5c8b756a1ea51b890e3584744f624bde28baa .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split_v.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/split_v.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split_v.o.d" -o ${OBJECTDIR}/_ext/1222731669/split_v.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/split_v.o.d" -o ${OBJECTDIR}/_ext/1222731669/split_v.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/split_v.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/squeeze.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp  .generated_files/flags/default/5938991a2311be8cb96c8db8e1d626b5ac82c568 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/squeeze.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/squeeze.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/squeeze.o.d" -o ${OBJECTDIR}/_ext/1222731669/squeeze.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/squeeze.o.d" -o ${OBJECTDIR}/_ext/1222731669/squeeze.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/squeeze.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/strided_slice.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp  .generated_files/flags/default/91d03db43b48d9960cf898ffb27763a6999899e3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/strided_slice.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/strided_slice.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/strided_slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/strided_slice.o.d" -o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/strided_slice.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/sub.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp  .generated_files/flags/default/1fc38b0205f6d0d2b6f2c4ce1f96043a5fb58080 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/sub_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp  .generated_files/flags/default/fbab2b1ebc0092c3d8e957974b65604ee6515ac2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/sub_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/sub_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/sub_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/sub_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/svdf.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp  .generated_files/flags/default/99270455b213439940bdc3ece435987b19506c79 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/svdf_common.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp  .generated_files/flags/default/ff66a8f5fafa0ce3c3ee8ae4d24b93db0d0226b1 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf_common.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/svdf_common.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/svdf_common.o.d" -o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/svdf_common.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/tanh.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp  .generated_files/flags/default/622f2dd4281488b44252ae38e8d52156df222cb7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/tanh.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/tanh.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/tanh.o.d" -o ${OBJECTDIR}/_ext/1222731669/tanh.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/tanh.o.d" -o ${OBJECTDIR}/_ext/1222731669/tanh.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/tanh.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/transpose.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp  .generated_files/flags/default/7d65564634176ec6dda879593752dad80c743be .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/transpose_conv.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp  .generated_files/flags/default/86ffdd689bc8252451ec25ee9e86fd54edef0c72 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/transpose_conv.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/transpose_conv.o.d" -o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/transpose_conv.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/unpack.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp  .generated_files/flags/default/dbea6f4efd252de9cdd0fe05d5e215aca159bc76 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/unpack.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/unpack.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/unpack.o.d" -o ${OBJECTDIR}/_ext/1222731669/unpack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/unpack.o.d" -o ${OBJECTDIR}/_ext/1222731669/unpack.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/unpack.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/var_handle.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp  .generated_files/flags/default/a4366e136daed77e1dcf7cacd0522c49ca029703 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/var_handle.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/var_handle.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/var_handle.o.d" -o ${OBJECTDIR}/_ext/1222731669/var_handle.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/var_handle.o.d" -o ${OBJECTDIR}/_ext/1222731669/var_handle.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/var_handle.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1222731669/zeros_like.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp  .generated_files/flags/default/b8db5705a6cdb0ec0369b082327134618ff44468 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1222731669" 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/zeros_like.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1222731669/zeros_like.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/zeros_like.o.d" -o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1222731669/zeros_like.o.d" -o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ../src/third_party/tflite-micro/tensorflow/lite/micro/kernels/zeros_like.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp  .generated_files/flags/default/8f30642691552a05db4de0fb73a0e2d59fcb9b55 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/493921269" 
 	@${RM} ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d 
 	@${RM} ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp  .generated_files/flags/default/ea089f1c6991b553ee6960b1ba6ca69c5ad1067a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/493921269" 
 	@${RM} ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d 
 	@${RM} ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o.d" -o ${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/memory_helpers.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp  .generated_files/flags/default/eeb8d68a76212bddae2cda55a06a8914ae79bd3b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/memory_helpers.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d" -o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/memory_helpers.o.d" -o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ../src/third_party/tflite-micro/tensorflow/lite/micro/memory_helpers.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_allocator.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp  .generated_files/flags/default/8b5da29b6245319680dcf57c809079230ed7c94f .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_allocator.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_context.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp  .generated_files/flags/default/e8debf289f9f4bb3c9484872bd276aa8a50de197 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_context.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_context.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_context.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_context.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_context.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_context.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_context.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp  .generated_files/flags/default/1bdbfdeb911c50f8aa8399c0883b884a2dd174d3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_error_reporter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_graph.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp  .generated_files/flags/default/a1ef6a8d27c05effcf122a84b8f6ee8492384097 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_graph.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_graph.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_graph.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_graph.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_graph.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1966695218/micro_fusion.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp  .generated_files/flags/default/a1ef6a8d27c05effcf122a84b8f6ee8492384097 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_fusion.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_fusion.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_fusion.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_fusion.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp  .generated_files/flags/default/abc881a107eb6bfb4f758fe8860f26575a468e10 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_interpreter.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_interpreter.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp  .generated_files/flags/default/88c74cd827289153660316ce717be906488efdd7 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_resource_variable.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_string.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp  .generated_files/flags/default/bbad3aad0c30430e189c0d7c4ddbf63f4584eab4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_string.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_string.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_string.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_string.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_string.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_string.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_string.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
-${OBJECTDIR}/_ext/1966695218/micro_time.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp  .generated_files/flags/default/daa317e3cecb9f09c04b59f200d667637517f886 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+${OBJECTDIR}/_ext/1966695218/micro_profiler.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp  .generated_files/flags/default/bbad3aad0c30430e189c0d7c4ddbf63f4584eab4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
-	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_time.o.d 
-	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_time.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_time.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_time.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_time.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_profiler.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_profiler.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_profiler.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp  .generated_files/flags/default/bbad3aad0c30430e189c0d7c4ddbf63f4584eab4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_op_profiler.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp  .generated_files/flags/default/bbad3aad0c30430e189c0d7c4ddbf63f4584eab4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1212356873" 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o.d" -o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp  .generated_files/flags/default/bbad3aad0c30430e189c0d7c4ddbf63f4584eab4 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1212356873" 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o.d" -o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ../src/third_party/tflite-micro/tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/micro_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp  .generated_files/flags/default/ae4727a68e5a2b76e74885c12394481919d4a8b2 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/micro_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/micro_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/micro_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/micro_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp  .generated_files/flags/default/597773f8cc041f6efc1bbf212ced29ee20be139 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o.d" -o ${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ../src/third_party/tflite-micro/tensorflow/lite/micro/simple_memory_allocator.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/system_setup.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp  .generated_files/flags/default/7cfc8185f44bec073bea7058f538cf5077574d1a .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/system_setup.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/system_setup.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/system_setup.o.d" -o ${OBJECTDIR}/_ext/1966695218/system_setup.o ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/system_setup.o.d" -o ${OBJECTDIR}/_ext/1966695218/system_setup.o ../src/third_party/tflite-micro/tensorflow/lite/micro/system_setup.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp  .generated_files/flags/default/6f01d17a072da7f460313938a14b0defdc5f3b21 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1966695218" 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o.d" -o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ../src/third_party/tflite-micro/tensorflow/lite/micro/flatbuffer_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o: ../src/mlapp_ssd_mobilenet.cpp  .generated_files/flags/default/2e4b9bdda834e6a46f75323cdff403c313b448f9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/1360937237" 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d" -o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ../src/mlapp_ssd_mobilenet.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o.d" -o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ../src/mlapp_ssd_mobilenet.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	
+${OBJECTDIR}/_ext/1171490990/micro_time.o: ../src/config/default/micro_time.cpp  .generated_files/flags/default/2e4b9bdda834e6a46f75323cdff403c313b448f9 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/_ext/1171490990" 
+	@${RM} ${OBJECTDIR}/_ext/1171490990/micro_time.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1171490990/micro_time.o 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/1171490990/micro_time.o.d" -o ${OBJECTDIR}/_ext/1171490990/micro_time.o ../src/config/default/micro_time.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp  .generated_files/flags/default/d544ed68423fec08b06849f5307538833a5c946e .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d" -o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o.d" -o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/flatbuffer_conversions.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/970912416/op_resolver.o: ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp  .generated_files/flags/default/6ee3ea27ed0c58dc6c578591dca6ec65b8dff3b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/970912416" 
 	@${RM} ${OBJECTDIR}/_ext/970912416/op_resolver.o.d 
 	@${RM} ${OBJECTDIR}/_ext/970912416/op_resolver.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/op_resolver.o.d" -o ${OBJECTDIR}/_ext/970912416/op_resolver.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/970912416/op_resolver.o.d" -o ${OBJECTDIR}/_ext/970912416/op_resolver.o ../src/third_party/tflite-micro/tensorflow/lite/core/api/op_resolver.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 ${OBJECTDIR}/_ext/671639337/schema_utils.o: ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp  .generated_files/flags/default/3292057228f74748626b98c0d35bc0ac6ae4a60c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/_ext/671639337" 
 	@${RM} ${OBJECTDIR}/_ext/671639337/schema_utils.o.d 
 	@${RM} ${OBJECTDIR}/_ext/671639337/schema_utils.o 
-	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/671639337/schema_utils.o.d" -o ${OBJECTDIR}/_ext/671639337/schema_utils.o ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
+	${MP_CPPC} $(MP_EXTRA_CC_PRE)  -g -x c++ -c -mprocessor=$(MP_PROCESSOR_OPTION)  -frtti -fexceptions -fno-check-new -fenforce-eh-specs -ffunction-sections -O1 -DTF_LITE_STATIC_MEMORY -I"../src/third_party/tflite-micro" -I"../src/third_party/tflite-micro/third_party/flatbuffers/include" -I"../src/third_party/tflite-micro/third_party/gemmlowp" -I"../src/third_party/tflite-micro/third_party/ruy" -I"../src/third_party/tflite-micro/third_party/kissfft" -I"../src" -I"../src/config/default" -I"../src/config/default/system/fs/fat_fs/file_system" -I"../src/config/default/system/fs/fat_fs/hardware_access" -I"../src/packs/ATSAMA5D27CD1G_DFP" -I"../src/packs/CMSIS/" -I"../src/packs/CMSIS/CMSIS/Core_A/Include" -MP -MMD -MF "${OBJECTDIR}/_ext/671639337/schema_utils.o.d" -o ${OBJECTDIR}/_ext/671639337/schema_utils.o ../src/third_party/tflite-micro/tensorflow/lite/schema/schema_utils.cpp   -DXPRJ_default=$(CND_CONF)  $(COMPARISON_BUILD)  -marm -mfpu=neon-vfpv4 -mfloat-abi=softfp -mdfp="${DFP_DIR}" ${PACK_COMMON_OPTIONS} 
 	
 endif
 
@@ -1876,8 +1948,8 @@ nbproject/$(CND_CONF).$(IMAGE_TYPE):   nbproject/Makefile-${CND_CONF}.mk    ../s
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o " >> nbproject/default.debug"
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o " >> nbproject/default.debug"
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o " >> nbproject/default.debug"
-	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_time.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o " >> nbproject/default.debug"
-	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o " >> nbproject/default.debug"
+	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o " >> nbproject/default.debug"
+	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/1171490990/micro_time.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o " >> nbproject/default.debug"
 	@cmd /C "gnuecho -n "-DXPRJ_default=$(CND_CONF) " >> nbproject/default.debug"
 	@cmd /C "gnuecho -n "" >> nbproject/default.debug"
 	@cmd /C "gnuecho -n " -Wl,--defsym=__MPLAB_BUILD=1" >> nbproject/default.debug"
@@ -1907,8 +1979,8 @@ nbproject/$(CND_CONF).$(IMAGE_TYPE):   nbproject/Makefile-${CND_CONF}.mk   ../sr
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/mul.o ${OBJECTDIR}/_ext/1222731669/mul_common.o ${OBJECTDIR}/_ext/1222731669/neg.o ${OBJECTDIR}/_ext/1222731669/pack.o ${OBJECTDIR}/_ext/1222731669/pad.o ${OBJECTDIR}/_ext/1222731669/pooling.o ${OBJECTDIR}/_ext/1222731669/pooling_common.o ${OBJECTDIR}/_ext/1222731669/prelu.o ${OBJECTDIR}/_ext/1222731669/prelu_common.o ${OBJECTDIR}/_ext/1222731669/quantize.o ${OBJECTDIR}/_ext/1222731669/quantize_common.o ${OBJECTDIR}/_ext/1222731669/read_variable.o ${OBJECTDIR}/_ext/1222731669/reduce.o " >> nbproject/default.production"
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/reshape.o ${OBJECTDIR}/_ext/1222731669/resize_bilinear.o ${OBJECTDIR}/_ext/1222731669/resize_nearest_neighbor.o ${OBJECTDIR}/_ext/1222731669/round.o ${OBJECTDIR}/_ext/1222731669/shape.o ${OBJECTDIR}/_ext/1222731669/slice.o ${OBJECTDIR}/_ext/1222731669/softmax.o ${OBJECTDIR}/_ext/1222731669/softmax_common.o ${OBJECTDIR}/_ext/1222731669/space_to_batch_nd.o ${OBJECTDIR}/_ext/1222731669/space_to_depth.o ${OBJECTDIR}/_ext/1222731669/split.o ${OBJECTDIR}/_ext/1222731669/split_v.o " >> nbproject/default.production"
 	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1222731669/squeeze.o ${OBJECTDIR}/_ext/1222731669/strided_slice.o ${OBJECTDIR}/_ext/1222731669/sub.o ${OBJECTDIR}/_ext/1222731669/sub_common.o ${OBJECTDIR}/_ext/1222731669/svdf.o ${OBJECTDIR}/_ext/1222731669/svdf_common.o ${OBJECTDIR}/_ext/1222731669/tanh.o ${OBJECTDIR}/_ext/1222731669/transpose.o ${OBJECTDIR}/_ext/1222731669/transpose_conv.o ${OBJECTDIR}/_ext/1222731669/unpack.o ${OBJECTDIR}/_ext/1222731669/var_handle.o ${OBJECTDIR}/_ext/1222731669/zeros_like.o ${OBJECTDIR}/_ext/493921269/greedy_memory_planner.o " >> nbproject/default.production"
-	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_time.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o " >> nbproject/default.production"
-	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o " >> nbproject/default.production"
+	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/493921269/linear_memory_planner.o ${OBJECTDIR}/_ext/1966695218/memory_helpers.o ${OBJECTDIR}/_ext/1966695218/micro_allocator.o ${OBJECTDIR}/_ext/1966695218/micro_context.o ${OBJECTDIR}/_ext/1966695218/micro_error_reporter.o ${OBJECTDIR}/_ext/1966695218/micro_graph.o ${OBJECTDIR}/_ext/1966695218/micro_fusion.o ${OBJECTDIR}/_ext/1966695218/micro_interpreter.o ${OBJECTDIR}/_ext/1966695218/micro_resource_variable.o ${OBJECTDIR}/_ext/1966695218/micro_string.o ${OBJECTDIR}/_ext/1966695218/micro_profiler.o ${OBJECTDIR}/_ext/1966695218/micro_op_profiler.o ${OBJECTDIR}/_ext/1212356873/ssd_kernel_benchmark.o ${OBJECTDIR}/_ext/1212356873/micro_kernel_benchmark.o ${OBJECTDIR}/_ext/1966695218/micro_utils.o " >> nbproject/default.production"
+	@cmd /C "gnuecho -n "${OBJECTDIR}/_ext/1966695218/simple_memory_allocator.o ${OBJECTDIR}/_ext/1966695218/system_setup.o ${OBJECTDIR}/_ext/1966695218/flatbuffer_utils.o ${OBJECTDIR}/_ext/1360937237/app.o ${OBJECTDIR}/_ext/1360937237/bmp_input.o ${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/model.o ${OBJECTDIR}/_ext/1360937237/mlapp_ssd_mobilenet.o ${OBJECTDIR}/_ext/1171490990/micro_time.o ${OBJECTDIR}/_ext/970912416/flatbuffer_conversions.o ${OBJECTDIR}/_ext/1171490990/debug_log.o ${OBJECTDIR}/_ext/970912416/op_resolver.o ${OBJECTDIR}/_ext/671639337/schema_utils.o " >> nbproject/default.production"
 	@cmd /C "gnuecho -n "-DXPRJ_default=$(CND_CONF) " >> nbproject/default.production"
 	@cmd /C "gnuecho -n "" >> nbproject/default.production"
 	@cmd /C "gnuecho -n " -Wl,--defsym=__MPLAB_BUILD=1" >> nbproject/default.production"
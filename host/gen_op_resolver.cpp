@@ -0,0 +1,514 @@
+/*******************************************************************************
+  Op resolver generator
+
+  Summary:
+    Writes a header with an op resolver for exactly the operators a .tflite
+    model uses.
+
+  Description:
+    usage: gen_op_resolver <model.tflite> <model_op_resolver.h>
+
+    MicroMutableOpResolver is filled at run time and looks every node up with
+    a linear scan over the registered ops. The generated ModelOpResolver
+    instead keeps the model's operators in constexpr tables: builtin
+    operators are found by indexing a table with the BuiltinOperator code, and
+    only custom operators are compared by name. It only references the
+    Register_*() and Parse*() functions of those operators, so the linker
+    drops every other kernel.
+
+    The kernels known here are the ones MicroMutableOpResolver can register in
+    this tree; a model using anything else is rejected.
+*******************************************************************************/
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace {
+
+struct BuiltinKernel {
+  tflite::BuiltinOperator code;
+  const char* registration;
+  const char* parser;
+};
+
+struct CustomKernel {
+  const char* name;
+  // Expression returning a TfLiteRegistration*.
+  const char* registration;
+  // Declaration needed for registration, if any.
+  const char* declaration;
+};
+
+// Same kernels as the MicroMutableOpResolver::Add*() functions.
+const BuiltinKernel kBuiltinKernels[] = {
+    {tflite::BuiltinOperator_ABS, "tflite::ops::micro::Register_ABS()",
+     "ParseAbs"},
+    {tflite::BuiltinOperator_ADD, "tflite::Register_ADD()", "ParseAdd"},
+    {tflite::BuiltinOperator_ADD_N, "tflite::Register_ADD_N()", "ParseAddN"},
+    {tflite::BuiltinOperator_ARG_MAX, "tflite::ops::micro::Register_ARG_MAX()",
+     "ParseArgMax"},
+    {tflite::BuiltinOperator_ARG_MIN, "tflite::ops::micro::Register_ARG_MIN()",
+     "ParseArgMin"},
+    {tflite::BuiltinOperator_ASSIGN_VARIABLE,
+     "tflite::Register_ASSIGN_VARIABLE()", "ParseAssignVariable"},
+    {tflite::BuiltinOperator_AVERAGE_POOL_2D,
+     "tflite::Register_AVERAGE_POOL_2D()", "ParsePool"},
+    {tflite::BuiltinOperator_BATCH_TO_SPACE_ND,
+     "tflite::Register_BATCH_TO_SPACE_ND()", "ParseBatchToSpaceNd"},
+    {tflite::BuiltinOperator_CALL_ONCE, "tflite::Register_CALL_ONCE()",
+     "ParseCallOnce"},
+    {tflite::BuiltinOperator_CAST, "tflite::Register_CAST()", "ParseCast"},
+    {tflite::BuiltinOperator_CEIL, "tflite::ops::micro::Register_CEIL()",
+     "ParseCeil"},
+    {tflite::BuiltinOperator_CONCATENATION,
+     "tflite::ops::micro::Register_CONCATENATION()", "ParseConcatenation"},
+    {tflite::BuiltinOperator_CONV_2D, "tflite::Register_CONV_2D()",
+     "ParseConv2D"},
+    {tflite::BuiltinOperator_COS, "tflite::ops::micro::Register_COS()",
+     "ParseCos"},
+    {tflite::BuiltinOperator_CUMSUM, "tflite::Register_CUMSUM()",
+     "ParseCumsum"},
+    {tflite::BuiltinOperator_DEPTHWISE_CONV_2D,
+     "tflite::Register_DEPTHWISE_CONV_2D()", "ParseDepthwiseConv2D"},
+    {tflite::BuiltinOperator_DEPTH_TO_SPACE,
+     "tflite::Register_DEPTH_TO_SPACE()", "ParseDepthToSpace"},
+    {tflite::BuiltinOperator_DEQUANTIZE, "tflite::Register_DEQUANTIZE()",
+     "ParseDequantize"},
+    {tflite::BuiltinOperator_ELU, "tflite::Register_ELU()", "ParseElu"},
+    {tflite::BuiltinOperator_EQUAL, "tflite::ops::micro::Register_EQUAL()",
+     "ParseEqual"},
+    {tflite::BuiltinOperator_EXP, "tflite::Register_EXP()", "ParseExp"},
+    {tflite::BuiltinOperator_EXPAND_DIMS, "tflite::Register_EXPAND_DIMS()",
+     "ParseExpandDims"},
+    {tflite::BuiltinOperator_FILL, "tflite::Register_FILL()", "ParseFill"},
+    {tflite::BuiltinOperator_FLOOR, "tflite::ops::micro::Register_FLOOR()",
+     "ParseFloor"},
+    {tflite::BuiltinOperator_FLOOR_DIV, "tflite::Register_FLOOR_DIV()",
+     "ParseFloorDiv"},
+    {tflite::BuiltinOperator_FLOOR_MOD, "tflite::Register_FLOOR_MOD()",
+     "ParseFloorMod"},
+    {tflite::BuiltinOperator_FULLY_CONNECTED,
+     "tflite::Register_FULLY_CONNECTED()", "ParseFullyConnected"},
+    {tflite::BuiltinOperator_GATHER, "tflite::Register_GATHER()",
+     "ParseGather"},
+    {tflite::BuiltinOperator_GATHER_ND, "tflite::Register_GATHER_ND()",
+     "ParseGatherNd"},
+    {tflite::BuiltinOperator_GREATER, "tflite::ops::micro::Register_GREATER()",
+     "ParseGreater"},
+    {tflite::BuiltinOperator_GREATER_EQUAL,
+     "tflite::ops::micro::Register_GREATER_EQUAL()", "ParseGreaterEqual"},
+    {tflite::BuiltinOperator_HARD_SWISH, "tflite::Register_HARD_SWISH()",
+     "ParseHardSwish"},
+    {tflite::BuiltinOperator_IF, "tflite::Register_IF()", "ParseIf"},
+    {tflite::BuiltinOperator_L2_NORMALIZATION,
+     "tflite::ops::micro::Register_L2_NORMALIZATION()", "ParseL2Normalization"},
+    {tflite::BuiltinOperator_L2_POOL_2D, "tflite::Register_L2_POOL_2D()",
+     "ParsePool"},
+    {tflite::BuiltinOperator_LEAKY_RELU, "tflite::Register_LEAKY_RELU()",
+     "ParseLeakyRelu"},
+    {tflite::BuiltinOperator_LESS, "tflite::ops::micro::Register_LESS()",
+     "ParseLess"},
+    {tflite::BuiltinOperator_LESS_EQUAL,
+     "tflite::ops::micro::Register_LESS_EQUAL()", "ParseLessEqual"},
+    {tflite::BuiltinOperator_LOG, "tflite::ops::micro::Register_LOG()",
+     "ParseLog"},
+    {tflite::BuiltinOperator_LOGICAL_AND, "tflite::Register_LOGICAL_AND()",
+     "ParseLogicalAnd"},
+    {tflite::BuiltinOperator_LOGICAL_NOT,
+     "tflite::ops::micro::Register_LOGICAL_NOT()", "ParseLogicalNot"},
+    {tflite::BuiltinOperator_LOGICAL_OR, "tflite::Register_LOGICAL_OR()",
+     "ParseLogicalOr"},
+    {tflite::BuiltinOperator_LOGISTIC, "tflite::Register_LOGISTIC()",
+     "ParseLogistic"},
+    {tflite::BuiltinOperator_MAXIMUM, "tflite::ops::micro::Register_MAXIMUM()",
+     "ParseMaximum"},
+    {tflite::BuiltinOperator_MAX_POOL_2D, "tflite::Register_MAX_POOL_2D()",
+     "ParsePool"},
+    {tflite::BuiltinOperator_MEAN, "tflite::ops::micro::Register_MEAN()",
+     "ParseReducer"},
+    {tflite::BuiltinOperator_MINIMUM, "tflite::ops::micro::Register_MINIMUM()",
+     "ParseMinimum"},
+    {tflite::BuiltinOperator_MIRROR_PAD, "tflite::Register_MIRROR_PAD()",
+     "ParseMirrorPad"},
+    {tflite::BuiltinOperator_MUL, "tflite::Register_MUL()", "ParseMul"},
+    {tflite::BuiltinOperator_NEG, "tflite::ops::micro::Register_NEG()",
+     "ParseNeg"},
+    {tflite::BuiltinOperator_NOT_EQUAL,
+     "tflite::ops::micro::Register_NOT_EQUAL()", "ParseNotEqual"},
+    {tflite::BuiltinOperator_PACK, "tflite::ops::micro::Register_PACK()",
+     "ParsePack"},
+    {tflite::BuiltinOperator_PAD, "tflite::ops::micro::Register_PAD()",
+     "ParsePad"},
+    {tflite::BuiltinOperator_PADV2, "tflite::ops::micro::Register_PADV2()",
+     "ParsePadV2"},
+    {tflite::BuiltinOperator_PRELU, "tflite::Register_PRELU()", "ParsePrelu"},
+    {tflite::BuiltinOperator_QUANTIZE, "tflite::Register_QUANTIZE()",
+     "ParseQuantize"},
+    {tflite::BuiltinOperator_READ_VARIABLE, "tflite::Register_READ_VARIABLE()",
+     "ParseReadVariable"},
+    {tflite::BuiltinOperator_REDUCE_MAX,
+     "tflite::ops::micro::Register_REDUCE_MAX()", "ParseReducer"},
+    {tflite::BuiltinOperator_RELU, "tflite::Register_RELU()", "ParseRelu"},
+    {tflite::BuiltinOperator_RELU6, "tflite::Register_RELU6()", "ParseRelu6"},
+    {tflite::BuiltinOperator_RESHAPE, "tflite::ops::micro::Register_RESHAPE()",
+     "ParseReshape"},
+    {tflite::BuiltinOperator_RESIZE_BILINEAR,
+     "tflite::Register_RESIZE_BILINEAR()", "ParseResizeBilinear"},
+    {tflite::BuiltinOperator_RESIZE_NEAREST_NEIGHBOR,
+     "tflite::ops::micro::Register_RESIZE_NEAREST_NEIGHBOR()",
+     "ParseResizeNearestNeighbor"},
+    {tflite::BuiltinOperator_ROUND, "tflite::ops::micro::Register_ROUND()",
+     "ParseRound"},
+    {tflite::BuiltinOperator_RSQRT, "tflite::ops::micro::Register_RSQRT()",
+     "ParseRsqrt"},
+    {tflite::BuiltinOperator_SHAPE, "tflite::Register_SHAPE()", "ParseShape"},
+    {tflite::BuiltinOperator_SIN, "tflite::ops::micro::Register_SIN()",
+     "ParseSin"},
+    {tflite::BuiltinOperator_SLICE, "tflite::Register_SLICE()", "ParseSlice"},
+    {tflite::BuiltinOperator_SOFTMAX, "tflite::Register_SOFTMAX()",
+     "ParseSoftmax"},
+    {tflite::BuiltinOperator_SPACE_TO_BATCH_ND,
+     "tflite::Register_SPACE_TO_BATCH_ND()", "ParseSpaceToBatchNd"},
+    {tflite::BuiltinOperator_SPACE_TO_DEPTH,
+     "tflite::Register_SPACE_TO_DEPTH()", "ParseSpaceToDepth"},
+    {tflite::BuiltinOperator_SPLIT, "tflite::ops::micro::Register_SPLIT()",
+     "ParseSplit"},
+    {tflite::BuiltinOperator_SPLIT_V, "tflite::ops::micro::Register_SPLIT_V()",
+     "ParseSplitV"},
+    {tflite::BuiltinOperator_SQRT, "tflite::ops::micro::Register_SQRT()",
+     "ParseSqrt"},
+    {tflite::BuiltinOperator_SQUARE, "tflite::ops::micro::Register_SQUARE()",
+     "ParseSquare"},
+    {tflite::BuiltinOperator_SQUEEZE, "tflite::Register_SQUEEZE()",
+     "ParseSqueeze"},
+    {tflite::BuiltinOperator_STRIDED_SLICE,
+     "tflite::ops::micro::Register_STRIDED_SLICE()", "ParseStridedSlice"},
+    {tflite::BuiltinOperator_SUB, "tflite::Register_SUB()", "ParseSub"},
+    {tflite::BuiltinOperator_SVDF, "tflite::Register_SVDF()", "ParseSvdf"},
+    {tflite::BuiltinOperator_TANH, "tflite::ops::micro::Register_TANH()",
+     "ParseTanh"},
+    {tflite::BuiltinOperator_TRANSPOSE, "tflite::Register_TRANSPOSE()",
+     "ParseTranspose"},
+    {tflite::BuiltinOperator_TRANSPOSE_CONV,
+     "tflite::Register_TRANSPOSE_CONV()", "ParseTransposeConv"},
+    {tflite::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM,
+     "tflite::ops::micro::Register_UNIDIRECTIONAL_SEQUENCE_LSTM()",
+     "ParseUnidirectionalSequenceLSTM"},
+    {tflite::BuiltinOperator_UNPACK, "tflite::ops::micro::Register_UNPACK()",
+     "ParseUnpack"},
+    {tflite::BuiltinOperator_VAR_HANDLE, "tflite::Register_VAR_HANDLE()",
+     "ParseVarHandle"},
+    {tflite::BuiltinOperator_ZEROS_LIKE, "tflite::Register_ZEROS_LIKE()",
+     "ParseZerosLike"},
+};
+
+const CustomKernel kCustomKernels[] = {
+    {"CIRCULAR_BUFFER", "tflite::Register_CIRCULAR_BUFFER()", nullptr},
+    {"TFLite_Detection_PostProcess",
+     "tflite::Register_DETECTION_POSTPROCESS()",
+     "TfLiteRegistration* Register_DETECTION_POSTPROCESS();"},
+};
+
+const BuiltinKernel* FindBuiltinKernel(tflite::BuiltinOperator code) {
+  for (const BuiltinKernel& kernel : kBuiltinKernels) {
+    if (kernel.code == code) {
+      return &kernel;
+    }
+  }
+  return nullptr;
+}
+
+const CustomKernel* FindCustomKernel(const std::string& name) {
+  for (const CustomKernel& kernel : kCustomKernels) {
+    if (name == kernel.name) {
+      return &kernel;
+    }
+  }
+  return nullptr;
+}
+
+bool ReadFile(const char* path, std::vector<uint8_t>* data) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  uint8_t chunk[4096];
+  size_t read;
+  while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data->insert(data->end(), chunk, chunk + read);
+  }
+  const bool ok = ferror(file) == 0;
+  fclose(file);
+  return ok;
+}
+
+const char* BaseName(const char* path) {
+  const char* slash = strrchr(path, '/');
+  return slash != nullptr ? slash + 1 : path;
+}
+
+void WriteHeader(FILE* out, const char* model_name,
+                 const std::vector<const BuiltinKernel*>& builtins,
+                 const std::vector<const CustomKernel*>& customs) {
+  const int op_count = static_cast<int>(builtins.size() + customs.size());
+  const int table_size =
+      builtins.empty() ? 0 : static_cast<int>(builtins.back()->code) + 1;
+
+  fprintf(out,
+          "/*************************************************************"
+          "******************\n"
+          "  Op resolver for the model\n"
+          "\n"
+          "  Generated by host/gen_op_resolver from %s; do not edit.\n"
+          "  Regenerate with \"make -C host resolver\" when the model "
+          "changes.\n"
+          "**************************************************************"
+          "*****************/\n",
+          model_name);
+  fprintf(out,
+          "#ifndef MODEL_OP_RESOLVER_H\n"
+          "#define MODEL_OP_RESOLVER_H\n"
+          "\n"
+          "#include <cstdint>\n"
+          "#include <cstring>\n"
+          "\n"
+          "#include \"tensorflow/lite/c/common.h\"\n"
+          "#include \"tensorflow/lite/core/api/flatbuffer_conversions.h\"\n"
+          "#include \"tensorflow/lite/micro/compatibility.h\"\n"
+          "#include \"tensorflow/lite/micro/kernels/conv.h\"\n"
+          "#include \"tensorflow/lite/micro/kernels/fully_connected.h\"\n"
+          "#include \"tensorflow/lite/micro/kernels/micro_ops.h\"\n"
+          "#include \"tensorflow/lite/micro/kernels/softmax.h\"\n"
+          "#include \"tensorflow/lite/micro/micro_op_resolver.h\"\n"
+          "#include \"tensorflow/lite/schema/schema_generated.h\"\n"
+          "\n");
+
+  bool declared = false;
+  for (const CustomKernel* kernel : customs) {
+    if (kernel->declaration != nullptr) {
+      if (!declared) {
+        fprintf(out, "namespace tflite {\n");
+        declared = true;
+      }
+      fprintf(out, "%s\n", kernel->declaration);
+    }
+  }
+  if (declared) {
+    fprintf(out, "}  // namespace tflite\n\n");
+  }
+
+  fprintf(out,
+          "namespace model_op_resolver {\n"
+          "\n"
+          "struct ModelOp {\n"
+          "  tflite::BuiltinOperator code;\n"
+          "  const char* custom_name;\n"
+          "  tflite::MicroOpResolver::BuiltinParseFunction parser;\n"
+          "};\n"
+          "\n"
+          "// Builtin operators in BuiltinOperator order, then custom "
+          "operators.\n"
+          "constexpr int kOpCount = %d;\n"
+          "constexpr int kBuiltinOpCount = %d;\n"
+          "constexpr ModelOp kOps[kOpCount] = {\n",
+          op_count, static_cast<int>(builtins.size()));
+  for (const BuiltinKernel* kernel : builtins) {
+    const std::string code =
+        std::string("tflite::BuiltinOperator_") +
+        tflite::EnumNameBuiltinOperator(kernel->code);
+    const std::string parser = std::string("tflite::") + kernel->parser;
+    // Wrapped like clang-format would, to keep the header within 80 columns.
+    const bool wrap = 4 + 1 + code.size() + 11 + parser.size() + 2 > 80;
+    fprintf(out, "    {%s, nullptr,%s%s},\n", code.c_str(),
+            wrap ? "\n     " : " ", parser.c_str());
+  }
+  for (const CustomKernel* kernel : customs) {
+    fprintf(out, "    {tflite::BuiltinOperator_CUSTOM, \"%s\", nullptr},\n",
+            kernel->name);
+  }
+  fprintf(out,
+          "};\n"
+          "\n"
+          "// Index into kOps for each BuiltinOperator up to the largest one "
+          "used,\n"
+          "// kOpCount for the ones the model does not use.\n"
+          "constexpr int kBuiltinIndexSize = %d;\n"
+          "constexpr uint8_t kBuiltinIndex[kBuiltinIndexSize] = {\n",
+          table_size);
+  for (int code = 0; code < table_size; ++code) {
+    int index = op_count;
+    for (size_t i = 0; i < builtins.size(); ++i) {
+      if (static_cast<int>(builtins[i]->code) == code) {
+        index = static_cast<int>(i);
+      }
+    }
+    const std::string entry =
+        index < op_count ? std::to_string(index) + "," : "kOpCount,";
+    fprintf(out, "    %-10s // %s\n", entry.c_str(),
+            tflite::EnumNameBuiltinOperator(
+                static_cast<tflite::BuiltinOperator>(code)));
+  }
+  fprintf(out,
+          "};\n"
+          "\n"
+          "}  // namespace model_op_resolver\n"
+          "\n"
+          "// Resolves the operators of the model in constant time; builtin "
+          "operators\n"
+          "// are not registered at run time, and unused kernels are not "
+          "linked in.\n"
+          "class ModelOpResolver : public tflite::MicroOpResolver {\n"
+          " public:\n"
+          "  TF_LITE_REMOVE_VIRTUAL_DELETE\n"
+          "\n"
+          "  ModelOpResolver()\n"
+          "      : registrations_{\n");
+  for (const BuiltinKernel* kernel : builtins) {
+    fprintf(out, "            %s,\n", kernel->registration);
+  }
+  for (const CustomKernel* kernel : customs) {
+    fprintf(out, "            *%s,\n", kernel->registration);
+  }
+  fprintf(
+      out,
+      "        } {\n"
+      "    for (int i = 0; i < model_op_resolver::kOpCount; ++i) {\n"
+      "      registrations_[i].builtin_code = "
+      "model_op_resolver::kOps[i].code;\n"
+      "      registrations_[i].custom_name =\n"
+      "          model_op_resolver::kOps[i].custom_name;\n"
+      "    }\n"
+      "  }\n"
+      "\n"
+      "  const TfLiteRegistration* FindOp(\n"
+      "      tflite::BuiltinOperator op) const override {\n"
+      "    const int index = BuiltinIndex(op);\n"
+      "    return index < model_op_resolver::kOpCount\n"
+      "               ? &registrations_[index]\n"
+      "               : nullptr;\n"
+      "  }\n"
+      "\n"
+      "  const TfLiteRegistration* FindOp(const char* op) const override {\n"
+      "    for (int i = model_op_resolver::kBuiltinOpCount;\n"
+      "         i < model_op_resolver::kOpCount; ++i) {\n"
+      "      if (strcmp(model_op_resolver::kOps[i].custom_name, op) == 0) {\n"
+      "        return &registrations_[i];\n"
+      "      }\n"
+      "    }\n"
+      "    return nullptr;\n"
+      "  }\n"
+      "\n"
+      "  BuiltinParseFunction GetOpDataParser(\n"
+      "      tflite::BuiltinOperator op) const override {\n"
+      "    const int index = BuiltinIndex(op);\n"
+      "    return index < model_op_resolver::kOpCount\n"
+      "               ? model_op_resolver::kOps[index].parser\n"
+      "               : nullptr;\n"
+      "  }\n"
+      "\n"
+      " private:\n"
+      "  static int BuiltinIndex(tflite::BuiltinOperator op) {\n"
+      "    const int code = static_cast<int>(op);\n"
+      "    return code >= 0 && code < model_op_resolver::kBuiltinIndexSize\n"
+      "               ? model_op_resolver::kBuiltinIndex[code]\n"
+      "               : model_op_resolver::kOpCount;\n"
+      "  }\n"
+      "\n"
+      "  TfLiteRegistration registrations_[model_op_resolver::kOpCount];\n"
+      "};\n"
+      "\n"
+      "#endif  // MODEL_OP_RESOLVER_H\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <model.tflite> <model_op_resolver.h>\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+  std::vector<uint8_t> file;
+  if (!ReadFile(argv[1], &file)) {
+    fprintf(stderr, "Cannot read %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  flatbuffers::Verifier verifier(file.data(), file.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid .tflite model\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  const tflite::Model* model = tflite::GetModel(file.data());
+
+  // Only the operator codes referenced by an operator count: converters can
+  // leave unused entries in operator_codes.
+  std::vector<const BuiltinKernel*> builtins;
+  std::vector<const CustomKernel*> customs;
+  bool supported = true;
+  for (const tflite::SubGraph* subgraph : *model->subgraphs()) {
+    if (subgraph->operators() == nullptr) {
+      continue;
+    }
+    for (const tflite::Operator* op : *subgraph->operators()) {
+      const tflite::OperatorCode* opcode =
+          model->operator_codes()->Get(op->opcode_index());
+      const tflite::BuiltinOperator code = tflite::GetBuiltinCode(opcode);
+      if (code == tflite::BuiltinOperator_CUSTOM) {
+        const std::string name = opcode->custom_code() != nullptr
+                                     ? opcode->custom_code()->str()
+                                     : std::string();
+        const CustomKernel* kernel = FindCustomKernel(name);
+        if (kernel == nullptr) {
+          fprintf(stderr, "No kernel for custom operator '%s'\n",
+                  name.c_str());
+          supported = false;
+        } else if (std::find(customs.begin(), customs.end(), kernel) ==
+                   customs.end()) {
+          customs.push_back(kernel);
+        }
+        continue;
+      }
+      const BuiltinKernel* kernel = FindBuiltinKernel(code);
+      if (kernel == nullptr) {
+        fprintf(stderr, "No kernel for operator %s\n",
+                tflite::EnumNameBuiltinOperator(code));
+        supported = false;
+      } else if (std::find(builtins.begin(), builtins.end(), kernel) ==
+                 builtins.end()) {
+        builtins.push_back(kernel);
+      }
+    }
+  }
+  if (!supported) {
+    return EXIT_FAILURE;
+  }
+  if (builtins.size() + customs.size() > UINT8_MAX) {
+    fprintf(stderr, "Too many operators\n");
+    return EXIT_FAILURE;
+  }
+  std::sort(builtins.begin(), builtins.end(),
+            [](const BuiltinKernel* a, const BuiltinKernel* b) {
+              return a->code < b->code;
+            });
+
+  FILE* out = fopen(argv[2], "w");
+  if (out == nullptr) {
+    fprintf(stderr, "Cannot write %s\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+  WriteHeader(out, BaseName(argv[1]), builtins, customs);
+  if (fclose(out) != 0) {
+    fprintf(stderr, "Cannot write %s\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+  printf("%s: %d builtin and %d custom operators\n", argv[2],
+         static_cast<int>(builtins.size()), static_cast<int>(customs.size()));
+  return EXIT_SUCCESS;
+}
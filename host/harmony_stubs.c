@@ -0,0 +1,169 @@
+/*******************************************************************************
+  Host build: stdio-backed stand-ins for the Harmony services used by app.c
+
+  Summary:
+    The USB bus "enables" immediately and mounts a drive holding image.bmp,
+    image1.bmp... (host_image_paths) and optionally detect.snp
+    (host_snapshot_path), so APP_Tasks runs through its normal state
+    sequence.
+*******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "app.h"
+#include "definitions.h"
+#include "harmony_stubs.h"
+
+const char **host_image_paths;
+const char *host_snapshot_path;
+bool host_app_done;
+bool host_app_failed;
+
+typedef void (*SYS_FS_EVENT_HANDLER)(SYS_FS_EVENT event, void *eventData, uintptr_t context);
+
+static SYS_FS_EVENT_HANDLER fsEventHandler;
+static uintptr_t fsEventContext;
+static SYS_FS_ERROR fsError = SYS_FS_ERROR_OK;
+
+void SYS_FS_EventHandlerSet(const void * eventHandler, const uintptr_t context)
+{
+    fsEventHandler = (SYS_FS_EVENT_HANDLER)eventHandler;
+    fsEventContext = context;
+}
+
+/* Returns the host file of image index, or NULL past the last one. */
+static const char *ImagePath(unsigned index)
+{
+    unsigned i;
+    for (i = 0; i < index; ++i)
+    {
+        if (host_image_paths[i] == NULL)
+        {
+            return NULL;
+        }
+    }
+    return host_image_paths[index];
+}
+
+SYS_FS_HANDLE SYS_FS_FileOpen(const char* fname, SYS_FS_FILE_OPEN_ATTRIBUTES attributes)
+{
+    static const char imagePrefix[] = "/mnt/myDrive1/image";
+    const char *path = NULL;
+    FILE *file = NULL;
+    char *end;
+    if (strcmp(fname, "/mnt/myDrive1/image.bmp") == 0)
+    {
+        path = ImagePath(0);
+    }
+    else if (strncmp(fname, imagePrefix, sizeof(imagePrefix) - 1) == 0)
+    {
+        unsigned long index =
+            strtoul(fname + sizeof(imagePrefix) - 1, &end, 10);
+        if (index > 0 && strcmp(end, ".bmp") == 0)
+        {
+            path = ImagePath((unsigned)index);
+        }
+    }
+    else if (strcmp(fname, "/mnt/myDrive1/detect.snp") == 0)
+    {
+        path = host_snapshot_path;
+    }
+    if (path != NULL)
+    {
+        file = fopen(path, attributes == SYS_FS_FILE_OPEN_WRITE ? "wb" : "rb");
+    }
+    if (file == NULL)
+    {
+        fsError = SYS_FS_ERROR_NO_FILE;
+        return SYS_FS_HANDLE_INVALID;
+    }
+    return (SYS_FS_HANDLE)file;
+}
+
+int32_t SYS_FS_FileSize(SYS_FS_HANDLE handle)
+{
+    FILE *file = (FILE *)handle;
+    long size;
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0)
+    {
+        return -1;
+    }
+    rewind(file);
+    return (int32_t)size;
+}
+
+size_t SYS_FS_FileRead(SYS_FS_HANDLE handle, void *buf, size_t nbyte)
+{
+    FILE *file = (FILE *)handle;
+    size_t n = fread(buf, 1, nbyte, file);
+    return ferror(file) ? (size_t)-1 : n;
+}
+
+size_t SYS_FS_FileWrite(SYS_FS_HANDLE handle, const void *buf, size_t nbyte)
+{
+    FILE *file = (FILE *)handle;
+    size_t n = fwrite(buf, 1, nbyte, file);
+    return ferror(file) ? (size_t)-1 : n;
+}
+
+int32_t SYS_FS_FileSeek(SYS_FS_HANDLE handle, int32_t offset, SYS_FS_FILE_SEEK_CONTROL whence)
+{
+    static const int origin[] = { SEEK_SET, SEEK_CUR, SEEK_END };
+    return fseek((FILE *)handle, offset, origin[whence]) == 0 ? offset : -1;
+}
+
+SYS_FS_RESULT SYS_FS_FileClose(SYS_FS_HANDLE handle)
+{
+    return fclose((FILE *)handle) == 0 ? SYS_FS_RES_SUCCESS : SYS_FS_RES_FAILURE;
+}
+
+SYS_FS_ERROR SYS_FS_Error(void)
+{
+    return fsError;
+}
+
+SYS_FS_RESULT SYS_FS_Unmount(const char *fname)
+{
+    (void)fname;
+    host_app_failed = true;
+    return SYS_FS_RES_SUCCESS;
+}
+
+USB_HOST_RESULT USB_HOST_EventHandlerSet(USB_HOST_EVENT_HANDLER eventHandler, uintptr_t context)
+{
+    (void)eventHandler;
+    (void)context;
+    return USB_HOST_RESULT_SUCCESS;
+}
+
+USB_HOST_RESULT USB_HOST_BusEnable(USB_HOST_BUS bus)
+{
+    (void)bus;
+    /* The "drive" is mounted as soon as the bus is up. */
+    if (fsEventHandler != NULL)
+    {
+        fsEventHandler(SYS_FS_EVENT_MOUNT, NULL, fsEventContext);
+    }
+    return USB_HOST_RESULT_SUCCESS;
+}
+
+USB_HOST_RESULT USB_HOST_BusIsEnabled(USB_HOST_BUS bus)
+{
+    (void)bus;
+    return USB_HOST_RESULT_TRUE;
+}
+
+void SYS_Tasks(void)
+{
+    /* No USB stack or file system tasks to run on the host */
+    APP_Tasks();
+}
+
+void LED1_On(void)
+{
+    host_app_done = true;
+}
+
+void LED1_Off(void)
+{
+}
@@ -0,0 +1,23 @@
+/*******************************************************************************
+  Host build: stdio-backed stand-ins for the Harmony services used by app.c
+*******************************************************************************/
+#ifndef HARMONY_STUBS_H
+#define HARMONY_STUBS_H
+
+#include <stdbool.h>
+
+/* Files served for "/mnt/myDrive1/image.bmp", "image1.bmp", "image2.bmp" and
+   so on, up to the first NULL entry. */
+extern const char **host_image_paths;
+
+/* File served for "/mnt/myDrive1/detect.snp", the interpreter snapshot; the
+   drive has no snapshot if NULL. */
+extern const char *host_snapshot_path;
+
+/* Set by LED1_On() once APP_Tasks has finished an image. */
+extern bool host_app_done;
+
+/* Set by SYS_FS_Unmount(), which app.c only calls from APP_STATE_ERROR. */
+extern bool host_app_failed;
+
+#endif // HARMONY_STUBS_H
@@ -0,0 +1,66 @@
+/*******************************************************************************
+  Host build entry point
+
+  Summary:
+    Runs the application state machine (app.c) on one or more BMP files and
+    reports the wall-clock time of the whole pipeline.
+
+  Description:
+    usage: ssd_host [-s snapshot] <image.bmp>...
+
+    The images are served as image.bmp, image1.bmp... in the order given, so
+    each one after the first is read while the model runs on the previous one,
+    as on the board.
+
+    Everything app.c prints (detections, per-op profile) goes to stdout; the
+    regression script compares the "Object ..." lines against golden files.
+
+    With a snapshot file the interpreter state is restored from it, or saved
+    to it if it does not match, as the board does with detect.snp on the USB
+    drive. A snapshot holds absolute addresses, so it only matches across
+    runs with address space randomization off (setarch -R).
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "app.h"
+#include "harmony_stubs.h"
+
+static double ElapsedMs(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e3 +
+           (end->tv_nsec - start->tv_nsec) / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    struct timespec start, end;
+
+    int first = 1;
+
+    if (argc > 3 && strcmp(argv[1], "-s") == 0)
+    {
+        host_snapshot_path = argv[2];
+        first = 3;
+    }
+    if (first >= argc || argv[first][0] == '-')
+    {
+        fprintf(stderr, "usage: %s [-s snapshot] <image.bmp>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    /* argv[argc] is NULL, which ends the list */
+    host_image_paths = (const char **)&argv[first];
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    APP_Initialize();
+    while (!host_app_done && !host_app_failed)
+    {
+        SYS_Tasks();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("Wall clock: %.1f ms\n", ElapsedMs(&start, &end));
+    return host_app_failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
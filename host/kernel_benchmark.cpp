@@ -0,0 +1,80 @@
+/*******************************************************************************
+  Host kernel micro-benchmarks
+
+  Summary:
+    Runs the SSD kernel micro-benchmarks (micro/benchmarks/
+    ssd_kernel_benchmark.h) as a micro_test binary, one test per op.
+
+  Description:
+    usage: kernel_benchmark [cpu_mhz]
+
+    With cpu_mhz the Cycles and per-cycle columns are CPU cycles at that
+    clock; without it they are clock() ticks, i.e. microseconds. A test fails
+    if any of its kernels fails to prepare or invoke.
+*******************************************************************************/
+#include <cstdint>
+#include <cstdlib>
+
+#include "tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace {
+
+// Enough for the float32 variants of the largest layers.
+constexpr size_t kArenaSize = 16 * 1024 * 1024;
+uint8_t arena[kArenaSize];
+
+}  // namespace
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+const tflite::SsdKernelBenchmarkConfig config = {
+    arena, kArenaSize,
+    argc > 1 ? static_cast<uint32_t>(atof(argv[1]) * 1e6) : 0u,
+    /*min_iterations=*/1,
+    /*min_ticks=*/tflite::ticks_per_second() / 10};
+tflite::LogSsdKernelBenchmarkHeader();
+
+TF_LITE_MICRO_TEST(Conv2D) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdConv2D(config));
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv2D) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdDepthwiseConv2D(config));
+}
+
+TF_LITE_MICRO_TEST(AveragePool2D) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdAveragePool2D(config));
+}
+
+TF_LITE_MICRO_TEST(MaxPool2D) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdMaxPool2D(config));
+}
+
+TF_LITE_MICRO_TEST(Softmax) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdSoftmax(config));
+}
+
+TF_LITE_MICRO_TEST(Reshape) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdReshape(config));
+}
+
+TF_LITE_MICRO_TEST(FullyConnected) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdFullyConnected(config));
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocess) {
+  TF_LITE_MICRO_EXPECT_EQ(0,
+                          tflite::BenchmarkSsdDetectionPostprocess(config));
+}
+
+TF_LITE_MICRO_TEST(Logistic) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdLogistic(config));
+}
+
+TF_LITE_MICRO_TEST(Add) {
+  TF_LITE_MICRO_EXPECT_EQ(0, tflite::BenchmarkSsdAdd(config));
+}
+
+TF_LITE_MICRO_TESTS_END
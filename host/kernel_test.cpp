@@ -0,0 +1,595 @@
+/*******************************************************************************
+  Host kernel tests
+
+  Summary:
+    Checks the optimized kernels against the reference kernels they replace,
+    as a micro_test binary.
+
+  Description:
+    usage: kernel_test
+
+    Every test runs an optimized kernel and its reference on the same
+    pseudo-random shapes, quantization parameters and data, and expects the
+    results the optimized kernel documents (bit-exact unless stated
+    otherwise). The Neon paths are only exercised when the tests are built
+    for a Neon-capable ARM core, e.g. with CXX=arm-linux-gnueabihf-g++
+    OPT="-O2 -mfpu=neon-vfpv4"; on other hosts the portable paths are tested.
+*******************************************************************************/
+#include <cstdint>
+#include <type_traits>
+
+#include "tensorflow/lite/kernels/internal/optimized/depthwiseconv_uint8.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h"
+#include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+
+namespace tflite {
+namespace {
+
+// Number of random cases per test.
+constexpr int kTrials = 200;
+
+// Largest tensors the random shapes can produce.
+constexpr int kMaxSpatial = 12;
+constexpr int kMaxDepth = 40;
+constexpr int kMaxDepthMultiplier = 3;
+constexpr int kMaxFilterSize = 5;
+constexpr int kMaxElements =
+    kMaxSpatial * kMaxSpatial * kMaxDepth * kMaxDepthMultiplier;
+constexpr int kMaxChannels = kMaxDepth * kMaxDepthMultiplier;
+
+// Convolutions mix all input channels, so their filters are kept smaller.
+constexpr int kMaxConvInputDepth = 16;
+constexpr int kMaxConvOutputDepth = 24;
+constexpr int kMaxConvFilterSize = 3;
+constexpr int kMaxConvPatch =
+    kMaxConvFilterSize * kMaxConvFilterSize * kMaxConvInputDepth;
+// Fully connected layers reuse the convolution buffers.
+constexpr int kMaxFcBatches = 4;
+
+int8_t input_int8[kMaxElements];
+int8_t filter_int8[kMaxFilterSize * kMaxFilterSize * kMaxChannels];
+int8_t expected_int8[kMaxElements];
+int8_t actual_int8[kMaxElements];
+uint8_t input_uint8[kMaxElements];
+uint8_t filter_uint8[kMaxFilterSize * kMaxFilterSize * kMaxChannels];
+uint8_t expected_uint8[kMaxElements];
+uint8_t actual_uint8[kMaxElements];
+int8_t conv_filter_int8[kMaxConvOutputDepth * kMaxConvPatch];
+uint8_t conv_filter_uint8[kMaxConvOutputDepth * kMaxConvPatch];
+int8_t packed_int8[kMaxConvOutputDepth * kMaxConvPatch];
+uint8_t packed_uint8[kMaxConvOutputDepth * kMaxConvPatch];
+// Packed 3x3 depthwise filters of uint8 layers hold int16 taps.
+int16_t packed_int16[3 * 3 * kMaxDepth];
+int8_t im2col_int8[kMaxSpatial * kMaxSpatial * kMaxConvPatch];
+uint8_t im2col_uint8[kMaxSpatial * kMaxSpatial * kMaxConvPatch];
+int32_t bias[kMaxChannels];
+int32_t effective_bias[kMaxChannels];
+int32_t output_multiplier[kMaxChannels];
+int32_t output_shift[kMaxChannels];
+
+uint32_t seed = 1;
+
+uint32_t NextRandom() {
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+// Uniform in [min, max].
+int RandomInt(int min, int max) {
+  return min + static_cast<int>(NextRandom() % (max - min + 1));
+}
+
+template <typename T>
+void FillRandom(T* data, int count) {
+  for (int i = 0; i < count; ++i) {
+    data[i] = static_cast<T>(NextRandom());
+  }
+}
+
+void FillRandomBias(int count) {
+  for (int i = 0; i < count; ++i) {
+    bias[i] = RandomInt(-20000, 20000);
+  }
+}
+
+// Random multipliers and shifts that scale the accumulators of the test
+// shapes into the 8-bit range, as a real model would.
+void FillRandomQuantization(int count, int32_t* multiplier, int* shift) {
+  *multiplier = RandomInt(1 << 30, 0x7fffffff);
+  *shift = RandomInt(-12, -6);
+  for (int i = 0; i < count; ++i) {
+    output_multiplier[i] = RandomInt(1 << 30, 0x7fffffff);
+    output_shift[i] = RandomInt(-12, -6);
+  }
+}
+
+void SetShape(RuntimeShape* shape, int d0, int d1, int d2, int d3) {
+  const int32_t dims[4] = {d0, d1, d2, d3};
+  shape->ReplaceWith(4, dims);
+}
+
+void SetShape(RuntimeShape* shape, int d0, int d1) {
+  const int32_t dims[2] = {d0, d1};
+  shape->ReplaceWith(2, dims);
+}
+
+void SetShape(RuntimeShape* shape, int d0) { shape->ReplaceWith(1, &d0); }
+
+// Output size of a convolution of input_size with a filter of filter_size
+// taps dilation apart, padded by pad on both sides.
+int OutputSize(int input_size, int filter_size, int dilation, int stride,
+               int pad) {
+  const int effective_filter = (filter_size - 1) * dilation + 1;
+  return (input_size + 2 * pad - effective_filter) / stride + 1;
+}
+
+template <typename T>
+bool Equal(const T* expected, const T* actual, int count) {
+  for (int i = 0; i < count; ++i) {
+    if (expected[i] != actual[i]) {
+      MicroPrintf("element %d: expected %d, got %d", i, expected[i],
+                  actual[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// Random depthwise convolution of a height x width x depth input. With
+// is_3x3 the filter is the 3x3, depth multiplier 1, undilated one of the
+// specialized kernels, with SAME-style padding of 0 or 1 so that both border
+// and interior pixels occur.
+struct DepthwiseCase {
+  DepthwiseParams params;
+  RuntimeShape input_shape;
+  RuntimeShape filter_shape;
+  RuntimeShape bias_shape;
+  RuntimeShape output_shape;
+};
+
+bool RandomDepthwiseCase(bool is_3x3, int stride, bool is_uint8,
+                         DepthwiseCase* test_case) {
+  DepthwiseParams& params = test_case->params;
+  const int height = RandomInt(1, kMaxSpatial);
+  const int width = RandomInt(1, kMaxSpatial);
+  const int depth = RandomInt(1, kMaxDepth);
+  const int filter_size = is_3x3 ? 3 : RandomInt(1, kMaxFilterSize);
+  const int dilation = is_3x3 ? 1 : RandomInt(1, 2);
+  const int pad = RandomInt(0, filter_size / 2);
+  params.depth_multiplier = is_3x3 ? 1 : RandomInt(1, kMaxDepthMultiplier);
+  params.stride_width = params.stride_height = stride;
+  params.dilation_width_factor = params.dilation_height_factor = dilation;
+  params.padding_values.width = params.padding_values.height = pad;
+  const int output_height = OutputSize(height, filter_size, dilation, stride,
+                                       pad);
+  const int output_width = OutputSize(width, filter_size, dilation, stride,
+                                      pad);
+  if (output_height <= 0 || output_width <= 0) {
+    return false;
+  }
+  const int output_depth = depth * params.depth_multiplier;
+
+  params.input_offset = is_uint8 ? -RandomInt(0, 255) : RandomInt(-127, 128);
+  params.weights_offset = is_uint8 ? -RandomInt(0, 255) : 0;
+  params.output_offset = is_uint8 ? RandomInt(0, 255) : RandomInt(-128, 127);
+  FillRandomQuantization(output_depth, &params.output_multiplier,
+                         &params.output_shift);
+  if (is_uint8) {
+    // uint8 layers have one multiplier, repeated per channel for the 3x3
+    // kernels.
+    for (int c = 0; c < output_depth; ++c) {
+      output_multiplier[c] = params.output_multiplier;
+      output_shift[c] = params.output_shift;
+    }
+  }
+  params.quantized_activation_min = is_uint8 ? RandomInt(0, 64)
+                                             : RandomInt(-128, -64);
+  params.quantized_activation_max = is_uint8 ? RandomInt(192, 255)
+                                             : RandomInt(64, 127);
+
+  SetShape(&test_case->input_shape, 1, height, width, depth);
+  SetShape(&test_case->filter_shape, 1, filter_size, filter_size,
+           output_depth);
+  SetShape(&test_case->bias_shape, output_depth);
+  SetShape(&test_case->output_shape, 1, output_height, output_width,
+           output_depth);
+  const int filter_count = test_case->filter_shape.FlatSize();
+  if (is_uint8) {
+    FillRandom(input_uint8, test_case->input_shape.FlatSize());
+    FillRandom(filter_uint8, filter_count);
+  } else {
+    FillRandom(input_int8, test_case->input_shape.FlatSize());
+    FillRandom(filter_int8, filter_count);
+    // int8 filters are symmetric.
+    for (int i = 0; i < filter_count; ++i) {
+      if (filter_int8[i] == -128) {
+        filter_int8[i] = -127;
+      }
+    }
+  }
+  FillRandomBias(output_depth);
+  return true;
+}
+
+// Runs the int8 reference depthwise convolution into expected_int8.
+void ReferenceDepthwiseInt8(const DepthwiseCase& c) {
+  reference_integer_ops::DepthwiseConvPerChannel(
+      c.params, output_multiplier, output_shift, c.input_shape, input_int8,
+      c.filter_shape, filter_int8, c.bias_shape, bias, c.output_shape,
+      expected_int8);
+}
+
+// Runs optimized_integer_ops::DepthwiseConv3x3PerChannel<kStride> on c, from
+// a filter packed by Pack3x3Filter() when packed is set. The random shapes
+// have both border pixels, which read the filter as it is, and interior
+// pixels, which read the packed groups.
+template <int kStride, typename T, typename PackedT>
+void OptimizedDepthwise3x3(const DepthwiseCase& c, const T* input,
+                           const T* filter, bool packed, PackedT* packed_filter,
+                           T* output) {
+  const PackedT* packed_data = nullptr;
+  const int32_t* effective_bias_data = nullptr;
+  if (packed) {
+    optimized_integer_ops::Pack3x3Filter(
+        filter, c.filter_shape.Dims(3), bias, c.params.input_offset,
+        c.params.weights_offset, packed_filter, effective_bias);
+    packed_data = packed_filter;
+    effective_bias_data = effective_bias;
+  }
+  optimized_integer_ops::DepthwiseConv3x3PerChannel<kStride>(
+      c.params, output_multiplier, output_shift, c.input_shape, input,
+      c.filter_shape, filter, c.bias_shape, bias, c.output_shape, output,
+      packed_data, effective_bias_data);
+}
+
+template <int kStride>
+bool Depthwise3x3Int8MatchesReference(bool packed) {
+  DepthwiseCase c;
+  if (!RandomDepthwiseCase(/*is_3x3=*/true, kStride, /*is_uint8=*/false,
+                           &c)) {
+    return true;
+  }
+  ReferenceDepthwiseInt8(c);
+  OptimizedDepthwise3x3<kStride>(c, input_int8, filter_int8, packed,
+                                 packed_int8, actual_int8);
+  return Equal(expected_int8, actual_int8, c.output_shape.FlatSize());
+}
+
+template <int kStride>
+bool Depthwise3x3Uint8MatchesReference(bool packed) {
+  DepthwiseCase c;
+  if (!RandomDepthwiseCase(/*is_3x3=*/true, kStride, /*is_uint8=*/true,
+                           &c)) {
+    return true;
+  }
+  reference_ops::DepthwiseConv(c.params, c.input_shape, input_uint8,
+                               c.filter_shape, filter_uint8, c.bias_shape,
+                               bias, c.output_shape, expected_uint8);
+  OptimizedDepthwise3x3<kStride>(c, input_uint8, filter_uint8, packed,
+                                 packed_int16, actual_uint8);
+  return Equal(expected_uint8, actual_uint8, c.output_shape.FlatSize());
+}
+
+bool DepthwiseConvPerChannelInt8MatchesReference() {
+  DepthwiseCase c;
+  if (!RandomDepthwiseCase(/*is_3x3=*/false, RandomInt(1, 2),
+                           /*is_uint8=*/false, &c)) {
+    return true;
+  }
+  ReferenceDepthwiseInt8(c);
+  optimized_integer_ops::DepthwiseConvPerChannel(
+      c.params, output_multiplier, output_shift, c.input_shape, input_int8,
+      c.filter_shape, filter_int8, c.bias_shape, bias, c.output_shape,
+      actual_int8);
+  return Equal(expected_int8, actual_int8, c.output_shape.FlatSize());
+}
+
+bool DepthwiseConvUint8MatchesReference() {
+  DepthwiseCase c;
+  if (!RandomDepthwiseCase(/*is_3x3=*/false, RandomInt(1, 2),
+                           /*is_uint8=*/true, &c)) {
+    return true;
+  }
+  reference_ops::DepthwiseConv(c.params, c.input_shape, input_uint8,
+                               c.filter_shape, filter_uint8, c.bias_shape,
+                               bias, c.output_shape, expected_uint8);
+  optimized_ops::DepthwiseConv(c.params, c.input_shape, input_uint8,
+                               c.filter_shape, filter_uint8, c.bias_shape,
+                               bias, c.output_shape, actual_uint8);
+  return Equal(expected_uint8, actual_uint8, c.output_shape.FlatSize());
+}
+
+
+// Random convolution of a height x width x depth input with a square filter
+// of up to kMaxConvFilterSize taps, stride 1 or 2 and padding of up to half
+// the filter, so that 1x1 pointwise, strided and padded cases all occur.
+// im2col_rows is a random band height for the im2col path.
+struct ConvCase {
+  ConvParams params;
+  RuntimeShape input_shape;
+  RuntimeShape filter_shape;
+  RuntimeShape bias_shape;
+  RuntimeShape output_shape;
+  RuntimeShape im2col_shape;
+  bool pointwise;
+};
+
+template <typename T>
+bool RandomConvCase(T* input, T* filter, ConvCase* test_case) {
+  const bool is_uint8 = std::is_same<T, uint8_t>::value;
+  ConvParams& params = test_case->params;
+  const int height = RandomInt(1, kMaxSpatial);
+  const int width = RandomInt(1, kMaxSpatial);
+  const int input_depth = RandomInt(1, kMaxConvInputDepth);
+  const int output_depth = RandomInt(1, kMaxConvOutputDepth);
+  const int filter_size = RandomInt(1, kMaxConvFilterSize);
+  const int stride = RandomInt(1, 2);
+  const int pad = RandomInt(0, filter_size / 2);
+  params.stride_width = params.stride_height = stride;
+  params.dilation_width_factor = params.dilation_height_factor = 1;
+  params.padding_values.width = params.padding_values.height = pad;
+  const int output_height = OutputSize(height, filter_size, 1, stride, pad);
+  const int output_width = OutputSize(width, filter_size, 1, stride, pad);
+  if (output_height <= 0 || output_width <= 0) {
+    return false;
+  }
+
+  params.input_offset = is_uint8 ? -RandomInt(0, 255) : RandomInt(-127, 128);
+  params.weights_offset = is_uint8 ? -RandomInt(0, 255) : 0;
+  params.output_offset = is_uint8 ? RandomInt(0, 255) : RandomInt(-128, 127);
+  FillRandomQuantization(output_depth, &params.output_multiplier,
+                         &params.output_shift);
+  if (is_uint8) {
+    // uint8 convolutions have one multiplier, repeated per channel.
+    for (int c = 0; c < output_depth; ++c) {
+      output_multiplier[c] = params.output_multiplier;
+      output_shift[c] = params.output_shift;
+    }
+  }
+  params.quantized_activation_min = is_uint8 ? RandomInt(0, 64)
+                                             : RandomInt(-128, -64);
+  params.quantized_activation_max = is_uint8 ? RandomInt(192, 255)
+                                             : RandomInt(64, 127);
+
+  SetShape(&test_case->input_shape, 1, height, width, input_depth);
+  SetShape(&test_case->filter_shape, output_depth, filter_size, filter_size,
+           input_depth);
+  SetShape(&test_case->bias_shape, output_depth);
+  SetShape(&test_case->output_shape, 1, output_height, output_width,
+           output_depth);
+  SetShape(&test_case->im2col_shape, 1, RandomInt(1, output_height),
+           output_width, filter_size * filter_size * input_depth);
+  test_case->pointwise = optimized_integer_ops::ConvIsPointwise(
+      params, test_case->filter_shape);
+  FillRandom(input, test_case->input_shape.FlatSize());
+  FillRandom(filter, test_case->filter_shape.FlatSize());
+  if (!is_uint8) {
+    for (int i = 0; i < test_case->filter_shape.FlatSize(); ++i) {
+      if (filter[i] == -128) {
+        filter[i] = -127;
+      }
+    }
+  }
+  FillRandomBias(output_depth);
+  return true;
+}
+
+// Runs optimized_integer_ops::ConvPerChannel on c, from a filter packed by
+// PackFilter() when packed is set.
+template <typename T>
+void OptimizedConv(const ConvCase& c, const T* input, const T* filter,
+                   bool packed, T* packed_filter, T* im2col, T* output) {
+  const T* packed_data = nullptr;
+  const int32_t* effective_bias_data = nullptr;
+  if (packed) {
+    const int cols = c.filter_shape.Dims(0);
+    const int depth = c.filter_shape.FlatSize() / cols;
+    optimized_integer_ops::PackFilter(filter, cols, depth, bias,
+                                      c.params.input_offset,
+                                      c.params.weights_offset, packed_filter,
+                                      effective_bias);
+    packed_data = packed_filter;
+    effective_bias_data = effective_bias;
+  }
+  optimized_integer_ops::ConvPerChannel(
+      c.params, output_multiplier, output_shift, c.input_shape, input,
+      c.filter_shape, filter, c.bias_shape, bias, c.output_shape, output,
+      c.im2col_shape, c.pointwise ? nullptr : im2col, packed_data,
+      effective_bias_data);
+}
+
+bool ConvPerChannelInt8MatchesReference(bool packed) {
+  ConvCase c;
+  if (!RandomConvCase(input_int8, conv_filter_int8, &c)) {
+    return true;
+  }
+  reference_integer_ops::ConvPerChannel(
+      c.params, output_multiplier, output_shift, c.input_shape, input_int8,
+      c.filter_shape, conv_filter_int8, c.bias_shape, bias, c.output_shape,
+      expected_int8);
+  OptimizedConv(c, input_int8, conv_filter_int8, packed, packed_int8,
+                im2col_int8, actual_int8);
+  return Equal(expected_int8, actual_int8, c.output_shape.FlatSize());
+}
+
+bool ConvUint8MatchesReference(bool packed) {
+  ConvCase c;
+  if (!RandomConvCase(input_uint8, conv_filter_uint8, &c)) {
+    return true;
+  }
+  reference_ops::Conv(c.params, c.input_shape, input_uint8, c.filter_shape,
+                      conv_filter_uint8, c.bias_shape, bias, c.output_shape,
+                      expected_uint8, c.im2col_shape, nullptr, nullptr);
+  OptimizedConv(c, input_uint8, conv_filter_uint8, packed, packed_uint8,
+                im2col_uint8, actual_uint8);
+  return Equal(expected_uint8, actual_uint8, c.output_shape.FlatSize());
+}
+
+// Random fully connected layer of up to kMaxFcBatches rows, with up to
+// kMaxConvOutputDepth output channels and a depth of up to kMaxConvPatch,
+// so that partial panels and depth tails both occur.
+struct FullyConnectedCase {
+  FullyConnectedParams params;
+  RuntimeShape input_shape;
+  RuntimeShape filter_shape;
+  RuntimeShape bias_shape;
+  RuntimeShape output_shape;
+};
+
+template <typename T>
+void RandomFullyConnectedCase(T* input, T* filter,
+                              FullyConnectedCase* test_case) {
+  const bool is_uint8 = std::is_same<T, uint8_t>::value;
+  FullyConnectedParams& params = test_case->params;
+  const int batches = RandomInt(1, kMaxFcBatches);
+  const int output_depth = RandomInt(1, kMaxConvOutputDepth);
+  const int accum_depth = RandomInt(1, kMaxConvPatch);
+
+  params.input_offset = is_uint8 ? -RandomInt(0, 255) : RandomInt(-127, 128);
+  params.weights_offset = is_uint8 ? -RandomInt(0, 255) : 0;
+  params.output_offset = is_uint8 ? RandomInt(0, 255) : RandomInt(-128, 127);
+  FillRandomQuantization(0, &params.output_multiplier, &params.output_shift);
+  // Fully connected layers have one multiplier, repeated per channel.
+  for (int c = 0; c < output_depth; ++c) {
+    output_multiplier[c] = params.output_multiplier;
+    output_shift[c] = params.output_shift;
+  }
+  params.quantized_activation_min = is_uint8 ? RandomInt(0, 64)
+                                             : RandomInt(-128, -64);
+  params.quantized_activation_max = is_uint8 ? RandomInt(192, 255)
+                                             : RandomInt(64, 127);
+
+  SetShape(&test_case->input_shape, batches, accum_depth);
+  SetShape(&test_case->filter_shape, output_depth, accum_depth);
+  SetShape(&test_case->bias_shape, output_depth);
+  SetShape(&test_case->output_shape, batches, output_depth);
+  FillRandom(input, test_case->input_shape.FlatSize());
+  FillRandom(filter, test_case->filter_shape.FlatSize());
+  if (!is_uint8) {
+    for (int i = 0; i < test_case->filter_shape.FlatSize(); ++i) {
+      if (filter[i] == -128) {
+        filter[i] = -127;
+      }
+    }
+  }
+  FillRandomBias(output_depth);
+}
+
+// Runs optimized_integer_ops::FullyConnected on c, or FullyConnectedPacked
+// on a copy of the weights packed by PackFilter() when packed is set.
+template <typename T>
+void OptimizedFullyConnected(const FullyConnectedCase& c, const T* input,
+                             const T* filter, bool packed, T* packed_filter,
+                             T* output) {
+  if (!packed) {
+    optimized_integer_ops::FullyConnected(
+        c.params, output_multiplier, output_shift, c.input_shape, input,
+        c.filter_shape, filter, c.bias_shape, bias, c.output_shape, output);
+    return;
+  }
+  optimized_integer_ops::PackFilter(
+      filter, c.filter_shape.Dims(0), c.filter_shape.Dims(1), bias,
+      c.params.input_offset, c.params.weights_offset, packed_filter,
+      effective_bias);
+  optimized_integer_ops::FullyConnectedPacked(
+      c.params, output_multiplier, output_shift, c.input_shape, input,
+      c.filter_shape, packed_filter, effective_bias, c.output_shape, output);
+}
+
+bool FullyConnectedInt8MatchesReference(bool packed) {
+  FullyConnectedCase c;
+  RandomFullyConnectedCase(input_int8, conv_filter_int8, &c);
+  reference_integer_ops::FullyConnected(
+      c.params, c.input_shape, input_int8, c.filter_shape, conv_filter_int8,
+      c.bias_shape, bias, c.output_shape, expected_int8);
+  OptimizedFullyConnected(c, input_int8, conv_filter_int8, packed,
+                          packed_int8, actual_int8);
+  return Equal(expected_int8, actual_int8, c.output_shape.FlatSize());
+}
+
+bool FullyConnectedUint8MatchesReference(bool packed) {
+  FullyConnectedCase c;
+  RandomFullyConnectedCase(input_uint8, conv_filter_uint8, &c);
+  reference_ops::FullyConnected(c.params, c.input_shape, input_uint8,
+                                c.filter_shape, conv_filter_uint8,
+                                c.bias_shape, bias, c.output_shape,
+                                expected_uint8);
+  OptimizedFullyConnected(c, input_uint8, conv_filter_uint8, packed,
+                          packed_uint8, actual_uint8);
+  return Equal(expected_uint8, actual_uint8, c.output_shape.FlatSize());
+}
+
+}  // namespace
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(ConvPerChannelInt8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::ConvPerChannelInt8MatchesReference(false));
+    TF_LITE_MICRO_EXPECT(tflite::ConvPerChannelInt8MatchesReference(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(ConvUint8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::ConvUint8MatchesReference(false));
+    TF_LITE_MICRO_EXPECT(tflite::ConvUint8MatchesReference(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(FullyConnectedInt8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::FullyConnectedInt8MatchesReference(false));
+    TF_LITE_MICRO_EXPECT(tflite::FullyConnectedInt8MatchesReference(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(FullyConnectedUint8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::FullyConnectedUint8MatchesReference(false));
+    TF_LITE_MICRO_EXPECT(tflite::FullyConnectedUint8MatchesReference(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConvPerChannelInt8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(
+        tflite::DepthwiseConvPerChannelInt8MatchesReference());
+  }
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x3PerChannelInt8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Int8MatchesReference<1>(false));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Int8MatchesReference<2>(false));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Int8MatchesReference<1>(true));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Int8MatchesReference<2>(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConv3x3Uint8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Uint8MatchesReference<1>(false));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Uint8MatchesReference<2>(false));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Uint8MatchesReference<1>(true));
+    TF_LITE_MICRO_EXPECT(tflite::Depthwise3x3Uint8MatchesReference<2>(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(DepthwiseConvUint8) {
+  for (int trial = 0; trial < tflite::kTrials; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::DepthwiseConvUint8MatchesReference());
+  }
+}
+
+TF_LITE_MICRO_TESTS_END
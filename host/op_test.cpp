@@ -0,0 +1,777 @@
+/*******************************************************************************
+  Host operator tests
+
+  Summary:
+    Checks kernels whose internals are not exposed by running them, one
+    operator at a time, through MicroInterpreter, as a micro_test binary.
+
+  Description:
+    usage: op_test
+
+    Every test builds single-operator models in memory with the flatbuffers
+    API and runs them on the same pseudo-random data, either in two tensor
+    types that must give the same results, or against the reference kernel
+    the operator replaces. One builds a short chain of operators instead, to
+    check that the next input can be written during Invoke().
+*******************************************************************************/
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "flatbuffers/flexbuffers.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/reference/integer_ops/logistic.h"
+#include "tensorflow/lite/kernels/internal/reference/softmax.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/testing/micro_test.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+namespace {
+
+constexpr int kArenaSize = 256 * 1024;
+alignas(16) uint8_t arena[kArenaSize];
+
+uint32_t seed = 1;
+
+uint32_t NextRandom() {
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+// Uniform in [min, max].
+int RandomInt(int min, int max) {
+  return min + static_cast<int>(NextRandom() % (max - min + 1));
+}
+
+// A tensor of a single-operator model. Constant tensors are stored in the
+// model; the data of the others is written into the input tensors before
+// Invoke().
+struct TensorSpec {
+  TensorType type;
+  std::vector<int32_t> shape;
+  float scale;
+  int64_t zero_point;
+  bool constant;
+  std::vector<uint8_t> data;
+};
+
+template <typename T>
+TensorSpec MakeTensor(TensorType type, std::vector<int32_t> shape,
+                      float scale, int64_t zero_point, bool constant,
+                      const std::vector<T>& values) {
+  TensorSpec spec = {type, std::move(shape), scale, zero_point, constant, {}};
+  spec.data.resize(values.size() * sizeof(T));
+  if (!values.empty()) {
+    memcpy(spec.data.data(), values.data(), spec.data.size());
+  }
+  return spec;
+}
+
+// Output tensor of the given type and shape.
+TensorSpec MakeOutput(TensorType type, std::vector<int32_t> shape,
+                      float scale = 0.0f, int64_t zero_point = 0) {
+  return {type, std::move(shape), scale, zero_point, false, {}};
+}
+
+// Adds tensors to the model being built, each constant one with a buffer of
+// its own appended to buffers.
+std::vector<flatbuffers::Offset<Tensor>> CreateTensors(
+    const std::vector<TensorSpec>& tensors,
+    std::vector<flatbuffers::Offset<Buffer>>* buffers,
+    flatbuffers::FlatBufferBuilder* builder) {
+  flatbuffers::FlatBufferBuilder& b = *builder;
+  std::vector<flatbuffers::Offset<Tensor>> tensor_offsets;
+  for (const TensorSpec& spec : tensors) {
+    uint32_t buffer = 0;
+    if (spec.constant) {
+      buffer = static_cast<uint32_t>(buffers->size());
+      b.ForceVectorAlignment(spec.data.size(), sizeof(uint8_t), 16);
+      buffers->push_back(CreateBuffer(b, b.CreateVector(spec.data)));
+    }
+    flatbuffers::Offset<QuantizationParameters> quantization = 0;
+    if (spec.scale > 0.0f) {
+      quantization = CreateQuantizationParameters(
+          b, 0, 0, b.CreateVector(std::vector<float>{spec.scale}),
+          b.CreateVector(std::vector<int64_t>{spec.zero_point}));
+    }
+    tensor_offsets.push_back(CreateTensor(b, b.CreateVector(spec.shape),
+                                          spec.type, buffer, 0,
+                                          quantization));
+  }
+  return tensor_offsets;
+}
+
+// One operator (a builtin, or the custom operator custom_code) reading
+// tensors[inputs] and writing tensors[outputs]. The model inputs are the
+// operator inputs that are not constant.
+class SingleOpModel {
+ public:
+  SingleOpModel(BuiltinOperator op, const BuiltinOptionsUnion& builtin_options,
+                const std::vector<TensorSpec>& tensors,
+                const std::vector<int32_t>& inputs,
+                const std::vector<int32_t>& outputs)
+      : tensors_(tensors) {
+    Build(op, builtin_options, nullptr, {}, inputs, outputs);
+  }
+
+  SingleOpModel(const char* custom_code,
+                const std::vector<uint8_t>& custom_options,
+                const std::vector<TensorSpec>& tensors,
+                const std::vector<int32_t>& inputs,
+                const std::vector<int32_t>& outputs)
+      : tensors_(tensors) {
+    Build(BuiltinOperator_CUSTOM, BuiltinOptionsUnion(), custom_code,
+          custom_options, inputs, outputs);
+  }
+
+  // Runs the model once with op_resolver and copies the data of its
+  // outputs into outputs. Returns false, after logging why, on error.
+  bool Run(const MicroOpResolver& op_resolver,
+           std::vector<std::vector<uint8_t>>* outputs) const {
+    MicroErrorReporter error_reporter;
+    MicroInterpreter interpreter(GetModel(builder_.GetBufferPointer()),
+                                 op_resolver, arena, kArenaSize,
+                                 &error_reporter);
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+      return false;
+    }
+    for (size_t i = 0; i < model_inputs_.size(); ++i) {
+      const TensorSpec& spec = tensors_[model_inputs_[i]];
+      TfLiteTensor* input = interpreter.input(i);
+      if (input->bytes != spec.data.size()) {
+        MicroPrintf("input %d: %d bytes of data for %d", static_cast<int>(i),
+                    static_cast<int>(spec.data.size()),
+                    static_cast<int>(input->bytes));
+        return false;
+      }
+      memcpy(input->data.raw, spec.data.data(), spec.data.size());
+    }
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    outputs->clear();
+    for (size_t i = 0; i < interpreter.outputs_size(); ++i) {
+      const TfLiteTensor* output = interpreter.output(i);
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(output->data.raw);
+      outputs->emplace_back(data, data + output->bytes);
+    }
+    return true;
+  }
+
+ private:
+  void Build(BuiltinOperator op, const BuiltinOptionsUnion& builtin_options,
+             const char* custom_code,
+             const std::vector<uint8_t>& custom_options,
+             const std::vector<int32_t>& inputs,
+             const std::vector<int32_t>& outputs) {
+    const std::vector<TensorSpec>& tensors = tensors_;
+    flatbuffers::FlatBufferBuilder& b = builder_;
+    std::vector<flatbuffers::Offset<Buffer>> buffers = {CreateBuffer(b)};
+    const std::vector<flatbuffers::Offset<Tensor>> tensor_offsets =
+        CreateTensors(tensors, &buffers, &b);
+    for (const int32_t input : inputs) {
+      if (!tensors[input].constant) {
+        model_inputs_.push_back(input);
+      }
+    }
+    const auto op_code =
+        custom_code != nullptr
+            ? CreateOperatorCode(b, 0, b.CreateString(custom_code), 1,
+                                 BuiltinOperator_CUSTOM)
+            : CreateOperatorCode(b, 0, 0, 1, op);
+    const auto op_offset = CreateOperator(
+        b, 0, b.CreateVector(inputs), b.CreateVector(outputs),
+        builtin_options.type, builtin_options.Pack(b),
+        custom_options.empty() ? 0 : b.CreateVector(custom_options));
+    const auto subgraph = CreateSubGraph(
+        b, b.CreateVector(tensor_offsets), b.CreateVector(model_inputs_),
+        b.CreateVector(outputs), b.CreateVector(&op_offset, 1));
+    FinishModelBuffer(
+        b, CreateModel(b, TFLITE_SCHEMA_VERSION, b.CreateVector(&op_code, 1),
+                       b.CreateVector(&subgraph, 1), 0,
+                       b.CreateVector(buffers)));
+  }
+
+  flatbuffers::FlatBufferBuilder builder_;
+  std::vector<TensorSpec> tensors_;
+  std::vector<int32_t> model_inputs_;
+};
+
+const float* AsFloat(const std::vector<uint8_t>& data) {
+  return reinterpret_cast<const float*>(data.data());
+}
+
+template <typename T>
+TensorType QuantizedType() {
+  return std::is_same<T, uint8_t>::value ? TensorType_UINT8 : TensorType_INT8;
+}
+
+// DETECTION_POSTPROCESS on kNumAnchors anchors of kNumClasses classes plus
+// the background one. kMaxDetections does not clip the output, so every box
+// the score threshold lets through is compared.
+constexpr int kNumAnchors = 128;
+constexpr int kNumClasses = 6;
+constexpr int kMaxDetections = 100;
+
+// Box encoding scales of the detector.
+constexpr float kYScale = 10.0f;
+constexpr float kXScale = 10.0f;
+constexpr float kHScale = 5.0f;
+constexpr float kWScale = 5.0f;
+
+std::vector<uint8_t> DetectionPostprocessOptions(int max_detections,
+                                                 int num_classes,
+                                                 bool use_regular_nms,
+                                                 float score_threshold,
+                                                 float iou_threshold) {
+  flexbuffers::Builder fbb;
+  fbb.Map([&]() {
+    fbb.Int("max_detections", max_detections);
+    fbb.Int("max_classes_per_detection", 1);
+    fbb.Int("detections_per_class", 100);
+    fbb.Bool("use_regular_nms", use_regular_nms);
+    fbb.Float("nms_score_threshold", score_threshold);
+    fbb.Float("nms_iou_threshold", iou_threshold);
+    fbb.Int("num_classes", num_classes);
+    fbb.Float("y_scale", kYScale);
+    fbb.Float("x_scale", kXScale);
+    fbb.Float("h_scale", kHScale);
+    fbb.Float("w_scale", kWScale);
+  });
+  fbb.Finish();
+  return fbb.GetBuffer();
+}
+
+// Quantization of the random detector inputs: box encodings in about
+// [-6, 6], anchors and scores in [0, 1).
+constexpr float kBoxScale = 0.05f;
+constexpr float kAnchorScale = 1.0f / 255;
+constexpr float kScoreScale = 1.0f / 256;
+
+template <typename T>
+float Dequantize(T value, float scale, int zero_point) {
+  return (static_cast<float>(value) - zero_point) * scale;
+}
+
+// Runs DETECTION_POSTPROCESS on random T (uint8 or int8) box encodings,
+// class predictions and anchors, and on the same values dequantized to
+// float, and expects the same detections: the score threshold, sorting and
+// suppression in the integer domain select what the float kernel selects.
+// Boxes are decoded in both cases from the same real values, through
+// tables for T and FastExp() for float, so they agree to a few ulp.
+template <typename T>
+bool DetectionPostprocessQuantizedMatchesFloat(bool use_regular_nms) {
+  const TensorType type = QuantizedType<T>();
+  const int zero_point = std::numeric_limits<T>::min();
+  const int box_zero_point = zero_point + 128;
+  std::vector<T> boxes(kNumAnchors * 4);
+  std::vector<T> scores(kNumAnchors * (kNumClasses + 1));
+  std::vector<T> anchors(kNumAnchors * 4);
+  for (T& value : boxes) {
+    value = static_cast<T>(RandomInt(zero_point, zero_point + 255));
+  }
+  for (T& value : scores) {
+    // Mostly low scores, as in a real detector, but every value reachable.
+    value = static_cast<T>(zero_point +
+                           RandomInt(0, 255) * RandomInt(0, 255) / 255);
+  }
+  for (int i = 0; i < kNumAnchors; ++i) {
+    anchors[i * 4 + 0] = static_cast<T>(zero_point + RandomInt(0, 255));
+    anchors[i * 4 + 1] = static_cast<T>(zero_point + RandomInt(0, 255));
+    anchors[i * 4 + 2] = static_cast<T>(zero_point + RandomInt(13, 128));
+    anchors[i * 4 + 3] = static_cast<T>(zero_point + RandomInt(13, 128));
+  }
+  std::vector<float> float_boxes, float_scores, float_anchors;
+  for (const T value : boxes) {
+    float_boxes.push_back(Dequantize(value, kBoxScale, box_zero_point));
+  }
+  for (const T value : scores) {
+    float_scores.push_back(Dequantize(value, kScoreScale, zero_point));
+  }
+  for (const T value : anchors) {
+    float_anchors.push_back(Dequantize(value, kAnchorScale, zero_point));
+  }
+
+  const std::vector<TensorSpec> outputs = {
+      MakeOutput(TensorType_FLOAT32, {1, kMaxDetections, 4}),
+      MakeOutput(TensorType_FLOAT32, {1, kMaxDetections}),
+      MakeOutput(TensorType_FLOAT32, {1, kMaxDetections}),
+      MakeOutput(TensorType_FLOAT32, {1})};
+  std::vector<TensorSpec> quantized_tensors = {
+      MakeTensor(type, {1, kNumAnchors, 4}, kBoxScale, box_zero_point, false,
+                 boxes),
+      MakeTensor(type, {1, kNumAnchors, kNumClasses + 1}, kScoreScale,
+                 zero_point, false, scores),
+      MakeTensor(type, {kNumAnchors, 4}, kAnchorScale, zero_point, true,
+                 anchors)};
+  std::vector<TensorSpec> float_tensors = {
+      MakeTensor(TensorType_FLOAT32, {1, kNumAnchors, 4}, 0.0f, 0, false,
+                 float_boxes),
+      MakeTensor(TensorType_FLOAT32, {1, kNumAnchors, kNumClasses + 1}, 0.0f,
+                 0, false, float_scores),
+      MakeTensor(TensorType_FLOAT32, {kNumAnchors, 4}, 0.0f, 0, true,
+                 float_anchors)};
+  quantized_tensors.insert(quantized_tensors.end(), outputs.begin(),
+                           outputs.end());
+  float_tensors.insert(float_tensors.end(), outputs.begin(), outputs.end());
+
+  MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddDetectionPostprocess();
+  const std::vector<uint8_t> options = DetectionPostprocessOptions(
+      kMaxDetections, kNumClasses, use_regular_nms, 0.75f, 0.6f);
+  const char* custom_code = "TFLite_Detection_PostProcess";
+  std::vector<std::vector<uint8_t>> quantized, expected;
+  if (!SingleOpModel(custom_code, options, quantized_tensors, {0, 1, 2},
+                     {3, 4, 5, 6})
+           .Run(op_resolver, &quantized) ||
+      !SingleOpModel(custom_code, options, float_tensors, {0, 1, 2},
+                     {3, 4, 5, 6})
+           .Run(op_resolver, &expected)) {
+    return false;
+  }
+
+  const int count = static_cast<int>(AsFloat(expected[3])[0]);
+  if (AsFloat(quantized[3])[0] != count) {
+    MicroPrintf("%d detections, expected %d",
+                static_cast<int>(AsFloat(quantized[3])[0]), count);
+    return false;
+  }
+  for (int i = 0; i < count; ++i) {
+    if (AsFloat(quantized[1])[i] != AsFloat(expected[1])[i] ||
+        AsFloat(quantized[2])[i] != AsFloat(expected[2])[i]) {
+      MicroPrintf("detection %d: class %f score %f, expected %f %f", i,
+                  AsFloat(quantized[1])[i], AsFloat(quantized[2])[i],
+                  AsFloat(expected[1])[i], AsFloat(expected[2])[i]);
+      return false;
+    }
+    for (int k = 0; k < 4; ++k) {
+      const float actual = AsFloat(quantized[0])[i * 4 + k];
+      const float reference = AsFloat(expected[0])[i * 4 + k];
+      if (std::fabs(actual - reference) > 1e-5f) {
+        MicroPrintf("detection %d: box coordinate %d %f, expected %f", i, k,
+                    actual, reference);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Runs DETECTION_POSTPROCESS on random float box encodings of a single class
+// and expects every box to be decoded as in double precision, to about 3 ulp
+// of the terms of its coordinates: the float path computes the box sizes
+// with FastExp() instead of std::exp(). The score threshold and IoU
+// threshold let every box through, and the scores, all different, tell
+// which anchor each detection comes from.
+bool DetectionPostprocessDecodesLikeDouble() {
+  std::vector<float> boxes, scores, anchors;
+  for (int i = 0; i < kNumAnchors; ++i) {
+    // e^(h / kHScale) and e^(w / kWScale) over [e^-10, e^10].
+    boxes.push_back(RandomInt(-5000, 5000) / 1000.0f);
+    boxes.push_back(RandomInt(-5000, 5000) / 1000.0f);
+    boxes.push_back(RandomInt(-50000, 50000) / 1000.0f);
+    boxes.push_back(RandomInt(-50000, 50000) / 1000.0f);
+    scores.push_back(0.0f);
+    scores.push_back(static_cast<float>(i + 1) / (kNumAnchors + 1));
+    anchors.push_back(RandomInt(0, 1000) / 1000.0f);
+    anchors.push_back(RandomInt(0, 1000) / 1000.0f);
+    anchors.push_back(RandomInt(50, 500) / 1000.0f);
+    anchors.push_back(RandomInt(50, 500) / 1000.0f);
+  }
+  const std::vector<TensorSpec> tensors = {
+      MakeTensor(TensorType_FLOAT32, {1, kNumAnchors, 4}, 0.0f, 0, false,
+                 boxes),
+      MakeTensor(TensorType_FLOAT32, {1, kNumAnchors, 2}, 0.0f, 0, false,
+                 scores),
+      MakeTensor(TensorType_FLOAT32, {kNumAnchors, 4}, 0.0f, 0, true,
+                 anchors),
+      MakeOutput(TensorType_FLOAT32, {1, kNumAnchors, 4}),
+      MakeOutput(TensorType_FLOAT32, {1, kNumAnchors}),
+      MakeOutput(TensorType_FLOAT32, {1, kNumAnchors}),
+      MakeOutput(TensorType_FLOAT32, {1})};
+
+  MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddDetectionPostprocess();
+  std::vector<std::vector<uint8_t>> outputs;
+  if (!SingleOpModel(
+           "TFLite_Detection_PostProcess",
+           DetectionPostprocessOptions(kNumAnchors, 1, false, 0.0f, 1.0f),
+           tensors, {0, 1, 2}, {3, 4, 5, 6})
+           .Run(op_resolver, &outputs)) {
+    return false;
+  }
+
+  if (AsFloat(outputs[3])[0] != kNumAnchors) {
+    MicroPrintf("%d detections, expected %d",
+                static_cast<int>(AsFloat(outputs[3])[0]), kNumAnchors);
+    return false;
+  }
+  for (int i = 0; i < kNumAnchors; ++i) {
+    const float score = AsFloat(outputs[2])[i];
+    const int anchor =
+        static_cast<int>(std::lround(score * (kNumAnchors + 1))) - 1;
+    if (anchor < 0 || anchor >= kNumAnchors ||
+        scores[anchor * 2 + 1] != score) {
+      MicroPrintf("detection %d: unexpected score %f", i, score);
+      return false;
+    }
+    const float* box = &boxes[anchor * 4];
+    const float* a = &anchors[anchor * 4];
+    const double ycenter = box[0] / static_cast<double>(kYScale) * a[2] + a[0];
+    const double xcenter = box[1] / static_cast<double>(kXScale) * a[3] + a[1];
+    // The exponent rounded to float as in the kernel, so that only the
+    // error of e^x is measured.
+    const double half_h = 0.5 * std::exp(box[2] * (1.0f / kHScale)) * a[2];
+    const double half_w = 0.5 * std::exp(box[3] * (1.0f / kWScale)) * a[3];
+    const double expected[4] = {ycenter - half_h, xcenter - half_w,
+                                ycenter + half_h, xcenter + half_w};
+    // The size of the terms summed, for the rounding errors of the sums.
+    const double y_terms = std::fabs(ycenter - a[0]) + a[0] + half_h;
+    const double x_terms = std::fabs(xcenter - a[1]) + a[1] + half_w;
+    const double magnitude[4] = {y_terms, x_terms, y_terms, x_terms};
+    for (int k = 0; k < 4; ++k) {
+      const float actual = AsFloat(outputs[0])[i * 4 + k];
+      if (std::fabs(actual - expected[k]) > 4e-7 * magnitude[k]) {
+        MicroPrintf("anchor %d: box coordinate %d %f, expected %f", anchor, k,
+                    actual, expected[k]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// 8-bit LOGISTIC and SOFTMAX outputs are probabilities in units of 1/256,
+// from the lowest value of their type.
+constexpr float kProbabilityScale = 1.0f / 256;
+
+// Runs LOGISTIC on all 256 values of T (uint8 or int8) with the given input
+// quantization and expects exactly the outputs of the fixed-point reference
+// kernel, which uint8 runs as int8 with both zero points shifted by 128, and
+// outputs within 1 of the rounded float logistic.
+template <typename T>
+bool LogisticMatchesReference(float input_scale, int input_zero_point) {
+  constexpr int kSize = 256;
+  constexpr int kOffset = std::is_same<T, uint8_t>::value ? 128 : 0;
+  std::vector<T> input(kSize);
+  for (int i = 0; i < kSize; ++i) {
+    input[i] = static_cast<T>(std::numeric_limits<T>::min() + i);
+  }
+  const std::vector<TensorSpec> tensors = {
+      MakeTensor(QuantizedType<T>(), {1, kSize}, input_scale, input_zero_point,
+                 false, input),
+      MakeOutput(QuantizedType<T>(), {1, kSize}, kProbabilityScale,
+                 std::numeric_limits<T>::min())};
+  MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddLogistic();
+  std::vector<std::vector<uint8_t>> outputs;
+  if (!SingleOpModel(BuiltinOperator_LOGISTIC, BuiltinOptionsUnion(), tensors,
+                     {0}, {1})
+           .Run(op_resolver, &outputs)) {
+    return false;
+  }
+  const T* output = reinterpret_cast<const T*>(outputs[0].data());
+
+  // The parameters LOGISTIC computed for the reference kernel before it ran
+  // from a table.
+  constexpr int kInputIntegerBits = 4;
+  int input_left_shift;
+  const double q = std::frexp(static_cast<double>(input_scale) *
+                                  (1 << (31 - kInputIntegerBits)),
+                              &input_left_shift);
+  const int32_t input_multiplier =
+      static_cast<int32_t>(std::round(q * (1ll << 31)));
+  const int32_t input_range_radius =
+      CalculateInputRadius(kInputIntegerBits, input_left_shift, 31);
+  int8_t reference_input[kSize];
+  int8_t reference[kSize];
+  for (int i = 0; i < kSize; ++i) {
+    reference_input[i] = static_cast<int8_t>(input[i] - kOffset);
+  }
+  reference_integer_ops::Logistic(input_zero_point - kOffset,
+                                  input_range_radius, input_multiplier,
+                                  input_left_shift, kSize, reference_input,
+                                  reference);
+
+  for (int i = 0; i < kSize; ++i) {
+    const int expected = reference[i] + kOffset;
+    const float real = (input[i] - input_zero_point) * input_scale;
+    const int exact = static_cast<int>(std::round(256 / (1 + std::exp(-real))));
+    const int actual = output[i];
+    if (actual != expected ||
+        std::abs(actual - std::numeric_limits<T>::min() -
+                 std::min(exact, 255)) > 1) {
+      MicroPrintf("logistic(%d): %d, expected %d (float %d)", input[i],
+                  actual, expected, exact + std::numeric_limits<T>::min());
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr int kSoftmaxRows = 16;
+
+// Runs SOFTMAX with the given input scale and beta on kSoftmaxRows random
+// rows of depth values of T (uint8 or int8) and expects outputs within 1 of
+// those of the fixed-point reference kernel, which int8 SOFTMAX ran before
+// it used a table.
+template <typename T>
+bool SoftmaxMatchesReference(float input_scale, float beta, int depth) {
+  const int input_zero_point = RandomInt(std::numeric_limits<T>::min(),
+                                         std::numeric_limits<T>::max());
+  std::vector<T> input(kSoftmaxRows * depth);
+  for (int i = 0; i < kSoftmaxRows; ++i) {
+    // Rows spread over the whole range and rows close to their maximum.
+    const int spread = i % 2 == 0 ? 255 : 15;
+    const int low = RandomInt(0, 255 - spread);
+    for (int j = 0; j < depth; ++j) {
+      input[i * depth + j] = static_cast<T>(std::numeric_limits<T>::min() +
+                                            low + RandomInt(0, spread));
+    }
+  }
+  const std::vector<TensorSpec> tensors = {
+      MakeTensor(QuantizedType<T>(), {kSoftmaxRows, depth}, input_scale,
+                 input_zero_point, false, input),
+      MakeOutput(QuantizedType<T>(), {kSoftmaxRows, depth}, kProbabilityScale,
+                 std::numeric_limits<T>::min())};
+  SoftmaxOptionsT softmax_options;
+  softmax_options.beta = beta;
+  BuiltinOptionsUnion builtin_options;
+  builtin_options.Set(softmax_options);
+  MicroMutableOpResolver<1> op_resolver;
+  op_resolver.AddSoftmax();
+  std::vector<std::vector<uint8_t>> outputs;
+  if (!SingleOpModel(BuiltinOperator_SOFTMAX, builtin_options, tensors, {0},
+                     {1})
+           .Run(op_resolver, &outputs)) {
+    return false;
+  }
+  const T* output = reinterpret_cast<const T*>(outputs[0].data());
+
+  // The parameters SOFTMAX computed for the int8 reference kernel.
+  constexpr int kScaledDiffIntegerBits = 5;
+  SoftmaxParams params = {};
+  int input_left_shift;
+  PreprocessSoftmaxScaling(beta, input_scale, kScaledDiffIntegerBits,
+                           &params.input_multiplier, &input_left_shift);
+  params.input_left_shift = input_left_shift;
+  params.diff_min =
+      -CalculateInputRadius(kScaledDiffIntegerBits, input_left_shift);
+  const int32_t dims[] = {kSoftmaxRows, depth};
+  const RuntimeShape shape(2, dims);
+  std::vector<T> reference(input.size());
+  reference_ops::Softmax(params, shape, input.data(), shape, reference.data());
+
+  for (size_t i = 0; i < input.size(); ++i) {
+    if (std::abs(output[i] - reference[i]) > 1) {
+      MicroPrintf("softmax row %d, column %d: %d, expected %d",
+                  static_cast<int>(i) / depth, static_cast<int>(i) % depth,
+                  output[i], reference[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// RESHAPE of the model input, LOGISTIC of the reshaped tensor and LOGISTIC of
+// that, on kInputViewSize uint8 values. The reshaped tensor is a view placed
+// in the input buffer, so the last operator to read the input is the first
+// LOGISTIC, not the RESHAPE.
+constexpr int kInputViewSize = 64;
+
+void BuildInputViewModel(flatbuffers::FlatBufferBuilder* builder) {
+  flatbuffers::FlatBufferBuilder& b = *builder;
+  const std::vector<TensorSpec> tensors = {
+      MakeTensor(TensorType_UINT8, {1, 4, 4, kInputViewSize / 16}, 0.1f, 128,
+                 false, std::vector<uint8_t>()),
+      MakeOutput(TensorType_UINT8, {1, kInputViewSize}, 0.1f, 128),
+      MakeOutput(TensorType_UINT8, {1, kInputViewSize}, kProbabilityScale, 0),
+      MakeOutput(TensorType_UINT8, {1, kInputViewSize}, kProbabilityScale, 0)};
+  std::vector<flatbuffers::Offset<Buffer>> buffers = {CreateBuffer(b)};
+  const std::vector<flatbuffers::Offset<Tensor>> tensor_offsets =
+      CreateTensors(tensors, &buffers, &b);
+  const std::vector<flatbuffers::Offset<OperatorCode>> op_codes = {
+      CreateOperatorCode(b, 0, 0, 1, BuiltinOperator_RESHAPE),
+      CreateOperatorCode(b, 0, 0, 1, BuiltinOperator_LOGISTIC)};
+  const std::vector<flatbuffers::Offset<Operator>> ops = {
+      CreateOperator(b, 0, b.CreateVector(std::vector<int32_t>{0}),
+                     b.CreateVector(std::vector<int32_t>{1})),
+      CreateOperator(b, 1, b.CreateVector(std::vector<int32_t>{1}),
+                     b.CreateVector(std::vector<int32_t>{2})),
+      CreateOperator(b, 1, b.CreateVector(std::vector<int32_t>{2}),
+                     b.CreateVector(std::vector<int32_t>{3}))};
+  const auto subgraph = CreateSubGraph(
+      b, b.CreateVector(tensor_offsets),
+      b.CreateVector(std::vector<int32_t>{0}),
+      b.CreateVector(std::vector<int32_t>{3}), b.CreateVector(ops));
+  FinishModelBuffer(
+      b, CreateModel(b, TFLITE_SCHEMA_VERSION, b.CreateVector(op_codes),
+                     b.CreateVector(&subgraph, 1), 0,
+                     b.CreateVector(buffers)));
+}
+
+// Writes next_input into the input tensor from the yield between operators,
+// as soon as the operators reading the current input have run.
+struct InputWriter {
+  MicroInterpreter* interpreter;
+  const std::vector<uint8_t>* next_input;
+  int last_input_reader;
+  int operators_run;
+  bool written;
+};
+
+void WriteNextInput(void* context) {
+  InputWriter* writer = static_cast<InputWriter*>(context);
+  if (++writer->operators_run <= writer->last_input_reader ||
+      writer->written) {
+    return;
+  }
+  memcpy(writer->interpreter->input(0)->data.raw, writer->next_input->data(),
+         writer->next_input->size());
+  writer->written = true;
+}
+
+// Runs the model of BuildInputViewModel() with the inputs preserved and
+// writes the next input during Invoke() after LastInputReader(), which must
+// follow the view to the first LOGISTIC. Expects the output of the current
+// input, and the next input to be intact for the following Invoke().
+bool InputWrittenDuringInvoke() {
+  flatbuffers::FlatBufferBuilder builder;
+  BuildInputViewModel(&builder);
+  MicroMutableOpResolver<2> op_resolver;
+  op_resolver.AddReshape();
+  op_resolver.AddLogistic();
+  MicroErrorReporter error_reporter;
+  MicroInterpreter interpreter(GetModel(builder.GetBufferPointer()),
+                               op_resolver, arena, kArenaSize,
+                               &error_reporter);
+  interpreter.SetPreserveInputs(true);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    return false;
+  }
+  const int last_input_reader = interpreter.LastInputReader(0);
+  if (last_input_reader != 1) {
+    MicroPrintf("last input reader %d, expected 1", last_input_reader);
+    return false;
+  }
+
+  std::vector<uint8_t> inputs[2];
+  std::vector<uint8_t> expected[2];
+  for (int i = 0; i < 2; ++i) {
+    for (int n = 0; n < kInputViewSize; ++n) {
+      inputs[i].push_back(static_cast<uint8_t>(RandomInt(0, 255)));
+    }
+    memcpy(interpreter.input(0)->data.raw, inputs[i].data(), kInputViewSize);
+    if (interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    const uint8_t* output = interpreter.output(0)->data.uint8;
+    expected[i].assign(output, output + kInputViewSize);
+  }
+
+  InputWriter writer = {&interpreter, &inputs[1], last_input_reader, 0, false};
+  memcpy(interpreter.input(0)->data.raw, inputs[0].data(), kInputViewSize);
+  interpreter.SetYield(WriteNextInput, &writer);
+  const TfLiteStatus status = interpreter.Invoke();
+  interpreter.SetYield(nullptr, nullptr);
+  if (status != kTfLiteOk || !writer.written) {
+    return false;
+  }
+  for (int i = 0; i < 2; ++i) {
+    if (i == 1 && interpreter.Invoke() != kTfLiteOk) {
+      return false;
+    }
+    const uint8_t* output = interpreter.output(0)->data.uint8;
+    for (int n = 0; n < kInputViewSize; ++n) {
+      if (output[n] != expected[i][n]) {
+        MicroPrintf("input %d, output %d: %d, expected %d", i, n, output[n],
+                    expected[i][n]);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+}  // namespace tflite
+
+TF_LITE_MICRO_TESTS_BEGIN
+
+TF_LITE_MICRO_TEST(DetectionPostprocessUint8) {
+  for (int trial = 0; trial < 20; ++trial) {
+    TF_LITE_MICRO_EXPECT(
+        tflite::DetectionPostprocessQuantizedMatchesFloat<uint8_t>(false));
+    TF_LITE_MICRO_EXPECT(
+        tflite::DetectionPostprocessQuantizedMatchesFloat<uint8_t>(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocessInt8) {
+  for (int trial = 0; trial < 20; ++trial) {
+    TF_LITE_MICRO_EXPECT(
+        tflite::DetectionPostprocessQuantizedMatchesFloat<int8_t>(false));
+    TF_LITE_MICRO_EXPECT(
+        tflite::DetectionPostprocessQuantizedMatchesFloat<int8_t>(true));
+  }
+}
+
+TF_LITE_MICRO_TEST(DetectionPostprocessFloatDecode) {
+  for (int trial = 0; trial < 20; ++trial) {
+    TF_LITE_MICRO_EXPECT(tflite::DetectionPostprocessDecodesLikeDouble());
+  }
+}
+
+TF_LITE_MICRO_TEST(LogisticUint8) {
+  for (const float scale : {0.01f, 0.0625f, 0.1f, 0.5f}) {
+    for (const int zero_point : {0, 100, 128, 255}) {
+      TF_LITE_MICRO_EXPECT(
+          tflite::LogisticMatchesReference<uint8_t>(scale, zero_point));
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(LogisticInt8) {
+  for (const float scale : {0.01f, 0.0625f, 0.1f, 0.5f}) {
+    for (const int zero_point : {-128, -28, 0, 127}) {
+      TF_LITE_MICRO_EXPECT(
+          tflite::LogisticMatchesReference<int8_t>(scale, zero_point));
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(SoftmaxUint8) {
+  for (const float scale : {0.01f, 0.1f, 0.25f}) {
+    for (const float beta : {0.5f, 1.0f}) {
+      for (const int depth : {1, 7, 91}) {
+        TF_LITE_MICRO_EXPECT(
+            tflite::SoftmaxMatchesReference<uint8_t>(scale, beta, depth));
+      }
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(SoftmaxInt8) {
+  for (const float scale : {0.01f, 0.1f, 0.25f}) {
+    for (const float beta : {0.5f, 1.0f}) {
+      for (const int depth : {1, 7, 91}) {
+        TF_LITE_MICRO_EXPECT(
+            tflite::SoftmaxMatchesReference<int8_t>(scale, beta, depth));
+      }
+    }
+  }
+}
+
+TF_LITE_MICRO_TEST(InputWrittenDuringInvoke) {
+  TF_LITE_MICRO_EXPECT(tflite::InputWrittenDuringInvoke());
+}
+
+TF_LITE_MICRO_TESTS_END
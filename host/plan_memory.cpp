@@ -0,0 +1,526 @@
+/*******************************************************************************
+  Offline memory planner for the tensor arena
+
+  Summary:
+    Computes a compact arena layout for a .tflite model and stores it in the
+    model's OfflineMemoryAllocation metadata, which the on-device
+    GreedyMemoryPlanner takes as fixed tensor offsets.
+
+  Description:
+    usage: plan_memory <model.tflite> <planned.tflite>
+
+    The model is prepared once with the kernels of the SSD demo (plus
+    CONCATENATION, QUANTIZE and DEQUANTIZE for other SSD exports) to record
+    the size and lifetime of every non-constant tensor and of every scratch
+    buffer the kernels request. As on the board, the model input is kept
+    allocated for the whole of Invoke(). Several placement orders are then
+    tried and refined by a local search; each candidate is scored exactly as
+    the board will see it: tensors at their offline offsets and scratch
+    buffers, which cannot be planned offline, placed around them by
+    GreedyMemoryPlanner. The search stops early once the plan reaches the
+    lower bound (the largest total size of buffers alive at the same time),
+    i.e. is optimal.
+
+    Finally the planned model is loaded again and the smallest arena that
+    AllocateTensors() accepts is found by bisection. The head (planned
+    buffers) is the same on the board; the tail (persistent interpreter and
+    kernel data) is measured with this host's pointer size, so on a 64-bit
+    host the reported arena is an upper bound for a 32-bit target. Use it
+    for TENSOR_ARENA_SIZE in mlapp_ssd_mobilenet.cpp and check the
+    "Model ready" line at boot for the exact figure.
+*******************************************************************************/
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_fusion.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace {
+
+constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
+// Arena used to record the buffers; large enough for any model that fits
+// the board.
+constexpr size_t kRecordArenaSize = 64 * 1024 * 1024;
+// Local search steps after the initial orders, unless the lower bound is
+// reached first.
+constexpr int kSearchIterations = 4000;
+
+struct PlannedBuffer {
+  int size;
+  int first_used;
+  int last_used;
+  // Index of the tensor, or -1 for a kernel scratch buffer.
+  int tensor;
+};
+
+using OpResolver = tflite::MicroMutableOpResolver<13>;
+
+void RegisterOps(OpResolver* resolver) {
+  // The ops registered by mlapp_ssd_mobilenet.cpp
+  resolver->AddDepthwiseConv2D();
+  resolver->AddConv2D();
+  resolver->AddAveragePool2D();
+  resolver->AddMaxPool2D();
+  resolver->AddSoftmax();
+  resolver->AddReshape();
+  resolver->AddFullyConnected();
+  resolver->AddDetectionPostprocess();
+  resolver->AddLogistic();
+  resolver->AddAdd();
+  resolver->AddConcatenation();
+  resolver->AddQuantize();
+  resolver->AddDequantize();
+}
+
+class SilentErrorReporter : public tflite::ErrorReporter {
+ public:
+  int Report(const char* format, va_list args) override { return 0; }
+};
+
+// GreedyMemoryPlanner that keeps a copy of every buffer it is given, in the
+// order MicroAllocator adds them: the non-constant tensors by index, then
+// the scratch buffers.
+class RecordingMemoryPlanner : public tflite::GreedyMemoryPlanner {
+ public:
+  TfLiteStatus Init(unsigned char* scratch_buffer,
+                    int scratch_buffer_size) override {
+    buffers_.clear();
+    return GreedyMemoryPlanner::Init(scratch_buffer, scratch_buffer_size);
+  }
+
+  TfLiteStatus AddBuffer(tflite::ErrorReporter* error_reporter, int size,
+                         int first_time_used, int last_time_used) override {
+    buffers_.push_back({size, first_time_used, last_time_used, -1});
+    return GreedyMemoryPlanner::AddBuffer(error_reporter, size,
+                                          first_time_used, last_time_used);
+  }
+
+  TfLiteStatus AddBuffer(tflite::ErrorReporter* error_reporter, int size,
+                         int first_time_used, int last_time_used,
+                         int offline_offset) override {
+    buffers_.push_back({size, first_time_used, last_time_used, -1});
+    return GreedyMemoryPlanner::AddBuffer(error_reporter, size,
+                                          first_time_used, last_time_used,
+                                          offline_offset);
+  }
+
+  std::vector<PlannedBuffer>& buffers() { return buffers_; }
+
+ private:
+  std::vector<PlannedBuffer> buffers_;
+};
+
+bool ReadFile(const char* path, std::vector<uint8_t>* data) {
+  FILE* file = fopen(path, "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data->insert(data->end(), chunk, chunk + n);
+  }
+  const bool ok = !ferror(file);
+  fclose(file);
+  return ok;
+}
+
+bool WriteFile(const char* path, const uint8_t* data, size_t size) {
+  FILE* file = fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+  const bool ok = fwrite(data, 1, size, file) == size;
+  return (fclose(file) == 0) && ok;
+}
+
+bool TimesOverlap(const PlannedBuffer& a, const PlannedBuffer& b) {
+  return a.first_used <= b.last_used && b.first_used <= a.last_used;
+}
+
+// Largest total size of buffers alive at the same time: no plan can need
+// less.
+int LowerBound(const std::vector<PlannedBuffer>& buffers) {
+  int last_time = 0;
+  for (const PlannedBuffer& buffer : buffers) {
+    last_time = std::max(last_time, buffer.last_used);
+  }
+  int bound = 0;
+  for (int t = 0; t <= last_time; ++t) {
+    int live = 0;
+    for (const PlannedBuffer& buffer : buffers) {
+      if (buffer.first_used <= t && t <= buffer.last_used) {
+        live += buffer.size;
+      }
+    }
+    bound = std::max(bound, live);
+  }
+  return bound;
+}
+
+// Places the buffers in the given order, each at the lowest offset (first
+// fit) or into the smallest gap (best fit) that does not collide with an
+// already placed buffer alive at the same time.
+void PlaceBuffers(const std::vector<PlannedBuffer>& buffers,
+                  const std::vector<int>& order, bool best_fit,
+                  std::vector<int>* offsets) {
+  offsets->assign(buffers.size(), -1);
+  std::vector<int> placed;  // indices, sorted by offset
+  std::vector<int> active;
+  for (int id : order) {
+    const PlannedBuffer& wanted = buffers[id];
+    active.clear();
+    for (int other : placed) {
+      if (TimesOverlap(wanted, buffers[other])) {
+        active.push_back(other);
+      }
+    }
+    int candidate = 0;
+    int best_offset = -1;
+    int best_gap = 0;
+    for (int other : active) {
+      const int gap = (*offsets)[other] - candidate;
+      if (gap >= wanted.size && (best_offset < 0 || gap < best_gap)) {
+        best_offset = candidate;
+        best_gap = gap;
+        if (!best_fit) {
+          break;
+        }
+      }
+      candidate =
+          std::max(candidate, (*offsets)[other] + buffers[other].size);
+    }
+    (*offsets)[id] = (best_offset >= 0) ? best_offset : candidate;
+    placed.insert(std::upper_bound(placed.begin(), placed.end(), id,
+                                   [&](int a, int b) {
+                                     return (*offsets)[a] < (*offsets)[b];
+                                   }),
+                  id);
+  }
+}
+
+// Arena head the board will need with the tensors at the given offsets and
+// the scratch buffers placed online by GreedyMemoryPlanner. Returns -1 if the
+// plan overlaps.
+int EvaluateOnDevice(const std::vector<PlannedBuffer>& buffers,
+                     const std::vector<int>& offsets) {
+  static std::vector<unsigned char> scratch;
+  scratch.resize(buffers.size() *
+                 tflite::GreedyMemoryPlanner::per_buffer_size());
+  SilentErrorReporter reporter;
+  tflite::GreedyMemoryPlanner planner;
+  planner.Init(scratch.data(), static_cast<int>(scratch.size()));
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const PlannedBuffer& buffer = buffers[i];
+    if (buffer.tensor >= 0) {
+      planner.AddBuffer(&reporter, buffer.size, buffer.first_used,
+                        buffer.last_used, offsets[i]);
+    } else {
+      planner.AddBuffer(&reporter, buffer.size, buffer.first_used,
+                        buffer.last_used);
+    }
+  }
+  if (planner.DoAnyBuffersOverlap(&reporter)) {
+    return -1;
+  }
+  return static_cast<int>(planner.GetMaximumMemorySize());
+}
+
+// Prepares the model with a fresh interpreter in an arena of arena_size
+// bytes. Returns the arena bytes used, or 0 if AllocateTensors() failed.
+size_t AllocateModel(const tflite::Model* model, uint8_t* arena,
+                     size_t arena_size, tflite::MicroMemoryPlanner* planner,
+                     tflite::ErrorReporter* reporter) {
+  static OpResolver resolver;
+  if (resolver.GetRegistrationLength() == 0) {
+    RegisterOps(&resolver);
+  }
+  tflite::MicroAllocator* allocator =
+      (planner != nullptr)
+          ? tflite::MicroAllocator::Create(arena, arena_size, planner,
+                                           reporter)
+          : tflite::MicroAllocator::Create(arena, arena_size, reporter);
+  if (allocator == nullptr) {
+    return 0;
+  }
+  tflite::MicroInterpreter interpreter(model, resolver, allocator, reporter);
+  // Like SsdDetector, which decodes the next image into the input tensor
+  // while Invoke() runs.
+  interpreter.SetPreserveInputs(true);
+  if (interpreter.AllocateTensors() != kTfLiteOk) {
+    return 0;
+  }
+  return interpreter.arena_used_bytes();
+}
+
+// Smallest arena (multiple of 16 bytes) in which the model can be prepared.
+size_t MinimumArenaSize(const tflite::Model* model, uint8_t* arena,
+                        size_t arena_size) {
+  SilentErrorReporter reporter;
+  // Room for the allocator objects themselves, assumed to fail.
+  size_t low = 1024;
+  size_t high = arena_size;
+  if (AllocateModel(model, arena, high, nullptr, &reporter) == 0) {
+    return 0;
+  }
+  while (high - low > 16) {
+    const size_t mid = tflite::AlignSizeUp((low + high) / 2, 16);
+    if (mid >= high) {
+      break;
+    }
+    if (AllocateModel(model, arena, mid, nullptr, &reporter) != 0) {
+      high = mid;
+    } else {
+      low = mid;
+    }
+  }
+  return high;
+}
+
+// Serializes source without any OfflineMemoryAllocation metadata and, if
+// offsets is given, with a new one holding them.
+void BuildModel(const tflite::Model* source, const std::vector<int>* offsets,
+                flatbuffers::FlatBufferBuilder* builder) {
+  tflite::ModelT model;
+  source->UnPackTo(&model);
+  for (auto it = model.metadata.begin(); it != model.metadata.end();) {
+    if ((*it)->name == kOfflineMemAllocMetadata) {
+      // The buffer is left in place, empty, so other indices stay valid.
+      model.buffers[(*it)->buffer]->data.clear();
+      it = model.metadata.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (offsets != nullptr) {
+    // Format (see micro/docs/memory_management.md upstream): version,
+    // subgraph index, number of offsets, one offset per tensor of the
+    // subgraph with -1 for tensors that are planned online.
+    std::vector<int32_t> words = {1, 0, static_cast<int32_t>(offsets->size())};
+    words.insert(words.end(), offsets->begin(), offsets->end());
+    std::unique_ptr<tflite::BufferT> buffer(new tflite::BufferT);
+    buffer->data.resize(words.size() * sizeof(int32_t));
+    for (size_t i = 0; i < words.size(); ++i) {
+      const uint32_t word = static_cast<uint32_t>(words[i]);
+      for (int b = 0; b < 4; ++b) {
+        buffer->data[i * 4 + b] = static_cast<uint8_t>(word >> (8 * b));
+      }
+    }
+    std::unique_ptr<tflite::MetadataT> metadata(new tflite::MetadataT);
+    metadata->name = kOfflineMemAllocMetadata;
+    metadata->buffer = static_cast<uint32_t>(model.buffers.size());
+    model.buffers.push_back(std::move(buffer));
+    model.metadata.push_back(std::move(metadata));
+  }
+  tflite::FinishModelBuffer(*builder, tflite::Model::Pack(*builder, &model));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: %s <model.tflite> <planned.tflite>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  std::vector<uint8_t> file;
+  if (!ReadFile(argv[1], &file)) {
+    fprintf(stderr, "Cannot read %s\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  flatbuffers::Verifier verifier(file.data(), file.size());
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    fprintf(stderr, "%s is not a valid .tflite model\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+  const tflite::Model* source = tflite::GetModel(file.data());
+  if (source->subgraphs()->size() != 1) {
+    fprintf(stderr, "Only single-subgraph models are supported\n");
+    return EXIT_FAILURE;
+  }
+
+  // Record the buffers of the model as planned online, which is also the
+  // baseline the offline plan is compared with.
+  flatbuffers::FlatBufferBuilder online_builder;
+  BuildModel(source, nullptr, &online_builder);
+  const tflite::Model* online_model =
+      tflite::GetModel(online_builder.GetBufferPointer());
+  std::vector<uint8_t> arena(kRecordArenaSize);
+  RecordingMemoryPlanner recorder;
+  tflite::MicroErrorReporter error_reporter;
+  if (AllocateModel(online_model, arena.data(), arena.size(), &recorder,
+                    &error_reporter) == 0) {
+    fprintf(stderr, "AllocateTensors() failed\n");
+    return EXIT_FAILURE;
+  }
+  std::vector<PlannedBuffer>& buffers = recorder.buffers();
+  const int online_head = static_cast<int>(recorder.GetMaximumMemorySize());
+
+  // Match the recorded buffers with the tensors MicroAllocator plans: those
+  // without constant data that are not variables and do not share the buffer
+  // of another tensor (views, concatenation inputs and tensors fused away, see
+  // FindTensorAliases() and micro_fusion.h), in index order.
+  const tflite::SubGraph* subgraph = online_model->subgraphs()->Get(0);
+  const int tensor_count = static_cast<int>(subgraph->tensors()->size());
+  std::vector<tflite::TensorAlias> aliases(tensor_count);
+  tflite::FindTensorAliases(online_model, 0, aliases.data());
+  std::vector<bool> aliased(tensor_count, false);
+  for (int i = 0; i < tensor_count; ++i) {
+    aliased[i] = aliases[i].target >= 0;
+  }
+  for (int op = 0; op < static_cast<int>(subgraph->operators()->size());
+       ++op) {
+    tflite::OperatorFusion fusion;
+    if (tflite::MatchOperatorFusion(online_model, 0, op, &fusion)) {
+      for (int i = 0; i < fusion.alias_count; ++i) {
+        aliased[fusion.aliased_tensors[i]] = true;
+      }
+    }
+  }
+  size_t next = 0;
+  for (int i = 0; i < tensor_count; ++i) {
+    const tflite::Tensor* tensor = subgraph->tensors()->Get(i);
+    const tflite::Buffer* data = online_model->buffers()->Get(tensor->buffer());
+    if ((data->data() != nullptr && data->data()->size() > 0) ||
+        tensor->is_variable() || aliased[i]) {
+      continue;
+    }
+    size_t bytes = 0;
+    size_t type_size = 0;
+    if (next >= buffers.size() ||
+        tflite::BytesRequiredForTensor(*tensor, &bytes, &type_size,
+                                       &error_reporter) != kTfLiteOk ||
+        static_cast<int>(tflite::AlignSizeUp(
+            bytes, tflite::MicroArenaBufferAlignment())) !=
+            buffers[next].size) {
+      fprintf(stderr, "Planned buffers do not match tensor %d\n", i);
+      return EXIT_FAILURE;
+    }
+    buffers[next++].tensor = i;
+  }
+  const size_t scratch_count = buffers.size() - next;
+
+  // Initial orders: by size, by area in the size/time plane, by lifetime,
+  // and in execution order, each placed first fit and best fit.
+  const int lower_bound = LowerBound(buffers);
+  auto duration = [&](int i) {
+    return buffers[i].last_used - buffers[i].first_used + 1;
+  };
+  std::vector<int> identity(buffers.size());
+  for (size_t i = 0; i < identity.size(); ++i) {
+    identity[i] = static_cast<int>(i);
+  }
+  std::vector<std::vector<int>> orders(4, identity);
+  std::stable_sort(orders[0].begin(), orders[0].end(), [&](int a, int b) {
+    return buffers[a].size > buffers[b].size;
+  });
+  std::stable_sort(orders[1].begin(), orders[1].end(), [&](int a, int b) {
+    return static_cast<int64_t>(buffers[a].size) * duration(a) >
+           static_cast<int64_t>(buffers[b].size) * duration(b);
+  });
+  std::stable_sort(orders[2].begin(), orders[2].end(), [&](int a, int b) {
+    return duration(a) != duration(b) ? duration(a) > duration(b)
+                                      : buffers[a].size > buffers[b].size;
+  });
+  std::stable_sort(orders[3].begin(), orders[3].end(), [&](int a, int b) {
+    return buffers[a].first_used < buffers[b].first_used;
+  });
+
+  std::vector<int> offsets;
+  std::vector<int> best_offsets;
+  std::vector<int> best_order;
+  bool best_fit_wins = false;
+  int best_head = -1;
+  auto try_order = [&](const std::vector<int>& order, bool best_fit) {
+    PlaceBuffers(buffers, order, best_fit, &offsets);
+    const int head = EvaluateOnDevice(buffers, offsets);
+    if (head >= 0 && (best_head < 0 || head < best_head)) {
+      best_head = head;
+      best_offsets = offsets;
+      best_order = order;
+      best_fit_wins = best_fit;
+      return true;
+    }
+    return false;
+  };
+  for (const std::vector<int>& order : orders) {
+    try_order(order, false);
+    try_order(order, true);
+  }
+
+  // Local search: move one buffer to another position in the best order
+  // and keep the change if the plan does not get bigger.
+  uint32_t seed = 1;
+  auto random = [&](int n) {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<int>((seed >> 8) % static_cast<uint32_t>(n));
+  };
+  const int n = static_cast<int>(buffers.size());
+  for (int step = 0; step < kSearchIterations && best_head > lower_bound &&
+                     n > 1;
+       ++step) {
+    std::vector<int> order = best_order;
+    const int from = random(n);
+    const int to = random(n);
+    const int id = order[from];
+    order.erase(order.begin() + from);
+    order.insert(order.begin() + to, id);
+    PlaceBuffers(buffers, order, best_fit_wins, &offsets);
+    const int head = EvaluateOnDevice(buffers, offsets);
+    if (head >= 0 && head <= best_head) {
+      best_head = head;
+      best_offsets = offsets;
+      best_order = order;
+    }
+  }
+  if (best_head < 0) {
+    fprintf(stderr, "No valid plan found\n");
+    return EXIT_FAILURE;
+  }
+
+  std::vector<int> tensor_offsets(tensor_count, tflite::kOnlinePlannedBuffer);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    if (buffers[i].tensor >= 0) {
+      tensor_offsets[buffers[i].tensor] = best_offsets[i];
+    }
+  }
+  flatbuffers::FlatBufferBuilder planned_builder;
+  BuildModel(source, &tensor_offsets, &planned_builder);
+  if (!WriteFile(argv[2], planned_builder.GetBufferPointer(),
+                 planned_builder.GetSize())) {
+    fprintf(stderr, "Cannot write %s\n", argv[2]);
+    return EXIT_FAILURE;
+  }
+
+  const tflite::Model* planned_model =
+      tflite::GetModel(planned_builder.GetBufferPointer());
+  const size_t online_arena =
+      MinimumArenaSize(online_model, arena.data(), arena.size());
+  const size_t planned_arena =
+      MinimumArenaSize(planned_model, arena.data(), arena.size());
+
+  printf("Buffers:              %d tensors, %d scratch\n",
+         static_cast<int>(buffers.size() - scratch_count),
+         static_cast<int>(scratch_count));
+  printf("Lower bound:          %d bytes\n", lower_bound);
+  printf("Online plan (head):   %d bytes\n", online_head);
+  printf("Offline plan (head):  %d bytes%s\n", best_head,
+         best_head == lower_bound ? " (optimal)" : "");
+  printf("Minimum arena:        %u bytes online, %u bytes offline planned\n",
+         static_cast<unsigned>(online_arena),
+         static_cast<unsigned>(planned_arena));
+  printf("Wrote %s (%u bytes)\n", argv[2],
+         static_cast<unsigned>(planned_builder.GetSize()));
+  return (planned_arena != 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
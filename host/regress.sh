@@ -0,0 +1,50 @@
+#!/bin/sh
+# Runs every image in ../images through the host build and compares the
+# reported detections ("Object ..." lines) with golden/<image>.txt.
+# With UPDATE_GOLDEN=1 the golden files are rewritten instead.
+#
+# usage: regress.sh <ssd_host binary>
+
+set -u
+BIN=$1
+HERE=$(dirname "$0")
+IMAGES="$HERE/../images"
+GOLDEN="$HERE/golden"
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+mkdir -p "$GOLDEN"
+if [ "${UPDATE_GOLDEN:-0}" != 1 ] && ! ls "$GOLDEN"/*.txt > /dev/null 2>&1; then
+    echo "ERROR: no golden detections in $GOLDEN, nothing to compare against." >&2
+    echo "Record them with 'make golden' from a build known to be good" >&2
+    echo "(see 'Host build and regression test' in README.md)." >&2
+    exit 1
+fi
+status=0
+for image in "$IMAGES"/*.bmp; do
+    name=$(basename "$image" .bmp)
+    if ! "$BIN" "$image" > "$OUT/$name.log" 2>&1; then
+        echo "FAIL $name: inference failed"
+        cat "$OUT/$name.log"
+        status=1
+        continue
+    fi
+    grep '^Object ' "$OUT/$name.log" > "$OUT/$name.txt"
+    wall=$(grep '^Wall clock:' "$OUT/$name.log")
+
+    if [ "${UPDATE_GOLDEN:-0}" = 1 ]; then
+        cp "$OUT/$name.txt" "$GOLDEN/$name.txt"
+        echo "UPDATED $name ($wall)"
+    elif [ ! -f "$GOLDEN/$name.txt" ]; then
+        echo "MISSING $name: no golden file, run 'make golden'"
+        status=1
+    elif diff -u "$GOLDEN/$name.txt" "$OUT/$name.txt"; then
+        echo "PASS $name ($wall)"
+    else
+        echo "FAIL $name: detections differ from golden"
+        status=1
+    fi
+    # Per-op profile of the run.
+    sed -n '/^"Count","Op"/,/^Total:/p' "$OUT/$name.log"
+done
+exit $status
@@ -0,0 +1,17 @@
+/*******************************************************************************
+  Host build stand-in for the MCC generated configuration.h
+
+  Summary:
+    Only the values used by the application sources are defined here.
+*******************************************************************************/
+#ifndef CONFIGURATION_H
+#define CONFIGURATION_H
+
+#include <time.h>
+
+/* The profiler converts timer ticks to "CPU cycles" with this frequency. On
+ * the host micro_time runs on clock(), so reporting at CLOCKS_PER_SEC makes
+ * the cycle columns read as clock() ticks (microseconds on glibc). */
+#define SYS_TIME_CPU_CLOCK_FREQUENCY                (CLOCKS_PER_SEC)
+
+#endif // CONFIGURATION_H
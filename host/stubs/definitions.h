@@ -0,0 +1,118 @@
+/*******************************************************************************
+  Host build stand-in for the MCC generated definitions.h
+
+  Summary:
+    Minimal SYS_FS, USB host, BSP and cache services used by app.c, backed by
+    stdio in harmony_stubs.c.
+*******************************************************************************/
+#ifndef DEFINITIONS_H
+#define DEFINITIONS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Toolchain / cache */
+#define CACHE_LINE_SIZE    (32u)
+#define CACHE_ALIGN        __attribute__((aligned(CACHE_LINE_SIZE)))
+#define CACHE_ALIGNED_SIZE_GET(size)     ((size) + ((((size) % (CACHE_LINE_SIZE))!= 0U)? ((CACHE_LINE_SIZE) - ((size) % (CACHE_LINE_SIZE))) : (0U)))
+#define USB_ALIGN          CACHE_ALIGN
+
+static inline void SYS_CACHE_CleanInvalidateDCache_by_Addr(void *addr, int32_t size) { (void)addr; (void)size; }
+static inline void SYS_CACHE_CleanDCache_by_Addr(void *addr, int32_t size) { (void)addr; (void)size; }
+static inline void SYS_CACHE_InvalidateDCache_by_Addr(void *addr, int32_t size) { (void)addr; (void)size; }
+
+/* File system */
+typedef uintptr_t SYS_FS_HANDLE;
+#define SYS_FS_HANDLE_INVALID ((SYS_FS_HANDLE)(-1))
+
+typedef enum
+{
+    SYS_FS_RES_SUCCESS = 0,
+    SYS_FS_RES_FAILURE = -1
+} SYS_FS_RESULT;
+
+typedef enum
+{
+    SYS_FS_ERROR_OK = 0,
+    SYS_FS_ERROR_NO_FILE = 4
+} SYS_FS_ERROR;
+
+typedef enum
+{
+    SYS_FS_FILE_OPEN_READ = 0,
+    SYS_FS_FILE_OPEN_WRITE
+} SYS_FS_FILE_OPEN_ATTRIBUTES;
+
+typedef enum
+{
+    SYS_FS_SEEK_SET,
+    SYS_FS_SEEK_CUR,
+    SYS_FS_SEEK_END
+} SYS_FS_FILE_SEEK_CONTROL;
+
+typedef enum
+{
+    SYS_FS_EVENT_MOUNT,
+    SYS_FS_EVENT_UNMOUNT,
+    SYS_FS_EVENT_ERROR
+} SYS_FS_EVENT;
+
+void SYS_FS_EventHandlerSet(const void * eventHandler, const uintptr_t context);
+SYS_FS_HANDLE SYS_FS_FileOpen(const char* fname, SYS_FS_FILE_OPEN_ATTRIBUTES attributes);
+int32_t SYS_FS_FileSize(SYS_FS_HANDLE handle);
+size_t SYS_FS_FileRead(SYS_FS_HANDLE handle, void *buf, size_t nbyte);
+size_t SYS_FS_FileWrite(SYS_FS_HANDLE handle, const void *buf, size_t nbyte);
+int32_t SYS_FS_FileSeek(SYS_FS_HANDLE handle, int32_t offset, SYS_FS_FILE_SEEK_CONTROL whence);
+SYS_FS_RESULT SYS_FS_FileClose(SYS_FS_HANDLE handle);
+SYS_FS_ERROR SYS_FS_Error(void);
+SYS_FS_RESULT SYS_FS_Unmount(const char *fname);
+
+/* USB host */
+typedef enum
+{
+    USB_HOST_RESULT_FALSE = 0,
+    USB_HOST_RESULT_TRUE = 1,
+    USB_HOST_RESULT_SUCCESS = 1
+} USB_HOST_RESULT;
+
+typedef enum
+{
+    USB_HOST_EVENT_DEVICE_UNSUPPORTED
+} USB_HOST_EVENT;
+
+typedef enum
+{
+    USB_HOST_EVENT_RESPONSE_NONE
+} USB_HOST_EVENT_RESPONSE;
+
+typedef uint32_t USB_HOST_BUS;
+#define USB_HOST_BUS_ALL ((USB_HOST_BUS)0xFF)
+
+typedef USB_HOST_EVENT_RESPONSE (*USB_HOST_EVENT_HANDLER)(USB_HOST_EVENT event, void * eventData, uintptr_t context);
+
+USB_HOST_RESULT USB_HOST_EventHandlerSet(USB_HOST_EVENT_HANDLER eventHandler, uintptr_t context);
+USB_HOST_RESULT USB_HOST_BusEnable(USB_HOST_BUS bus);
+USB_HOST_RESULT USB_HOST_BusIsEnabled(USB_HOST_BUS bus);
+
+/* System tasks: only APP_Tasks() here, called again by the application from
+   the yields between the operators of the model */
+void SYS_Tasks(void);
+
+/* BSP: the application signals completion with LED1_On() */
+void LED1_On(void);
+void LED1_Off(void);
+#define LED1_On  LED1_On
+#define LED1_Off LED1_Off
+#define LED1_Toggle()
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DEFINITIONS_H
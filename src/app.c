@@ -53,6 +53,8 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 // *****************************************************************************
 // *****************************************************************************
 
+#include <stdio.h>
+#include <string.h>
 #include "app.h"
 // *****************************************************************************
 // *****************************************************************************
@@ -62,16 +64,33 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 //#define DEBUG 1
 
 
-#define MAX_IMAGE_BUFFER 270000 //RGB 300x300
-#define MAX_IMAGE_BUFFER_HEADER 270054
-
-//uint8_t __attribute__ ((section(".region_nocache"), aligned (32))) bmpOrig[MAX_IMAGE_BUFFER] = { 0 };
-static uint8_t bmpOrig[MAX_IMAGE_BUFFER_HEADER] = { 0 };
-static uint8_t  fb0[MAX_IMAGE_BUFFER] = { 0 };
-uint32_t width ;
-uint32_t height ;
-uint32_t testbytes_num = 400;
-void _readBMP(uint8_t *buffer, long n_bytes);
+/* The BMP file is read through bmpChunk, the header first and then as many
+ * whole pixel rows at a time as fit (18 rows of a 300 pixel wide image).
+ * Each chunk is decoded straight into the model input while it is still in
+ * the cache, so the file is never held in memory as a whole. */
+#define BMP_CHUNK_SIZE (16 * 1024)
+
+/* bmpChunk is filled by the USB host controller DMA through SYS_FS, so it is
+ * cache-line aligned and padded to whole lines: cache maintenance on it must
+ * never touch a line shared with other data. */
+static uint8_t CACHE_ALIGN bmpChunk[CACHE_ALIGNED_SIZE_GET(BMP_CHUNK_SIZE)];
+
+/* The images are image.bmp, then image1.bmp, image2.bmp and so on until the
+ * first one missing. Each one is read while the model runs on the previous
+ * one (see _readerTasks). */
+#define IMAGE_FILE "/mnt/myDrive1/image.bmp"
+#define IMAGE_FILE_N "/mnt/myDrive1/image%u.bmp"
+static char imagePath[sizeof(IMAGE_FILE) + 10];
+
+/* The prepared interpreter state is kept on the drive next to the image, so
+ * that later boots restore it instead of preparing every kernel again (see
+ * object_detection_prepare). A snapshot written by other firmware or for another
+ * model is rejected and replaced. The buffer is DMA'd like bmpChunk. */
+#define SNAPSHOT_FILE "/mnt/myDrive1/detect.snp"
+#if !defined(APP_SNAPSHOT_SIZE)
+#define APP_SNAPSHOT_SIZE (256 * 1024)
+#endif
+static uint8_t CACHE_ALIGN snapshotBuffer[CACHE_ALIGNED_SIZE_GET(APP_SNAPSHOT_SIZE)];
 // *****************************************************************************
 /* Application Data
 
@@ -102,68 +121,247 @@ APP_DATA appData USB_ALIGN;
 // *****************************************************************************
 // *****************************************************************************
 
-void _readBMP(uint8_t *buffer, long n_bytes)
+static size_t _readChunk(size_t nBytes)
+{
+    size_t bytes_read;
+
+    /* Whole sectors are DMA'd straight into bmpChunk: write back and drop any
+     * cached lines first so that no dirty line is evicted on top of the DMA
+     * data, and clean/invalidate again afterwards to commit the partial
+     * sectors FatFS copied with the CPU and discard anything fetched during
+     * the transfer. */
+    SYS_CACHE_CleanInvalidateDCache_by_Addr(bmpChunk, sizeof(bmpChunk));
+    bytes_read = SYS_FS_FileRead(appData.fileHandle, bmpChunk, nBytes);
+    SYS_CACHE_CleanInvalidateDCache_by_Addr(bmpChunk, sizeof(bmpChunk));
+    return bytes_read;
+}
+
+/* Returns the size of the snapshot read from the drive into snapshotBuffer,
+ * or 0 if there is none. */
+static size_t _readSnapshot(void)
+{
+    SYS_FS_HANDLE handle;
+    int32_t size;
+    size_t bytes_read = 0;
+
+    handle = SYS_FS_FileOpen(SNAPSHOT_FILE, (SYS_FS_FILE_OPEN_READ));
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        return 0;
+    }
+    size = SYS_FS_FileSize(handle);
+    if(size > 0 && (size_t)size <= sizeof(snapshotBuffer))
+    {
+        /* Same cache maintenance as _readChunk */
+        SYS_CACHE_CleanInvalidateDCache_by_Addr(snapshotBuffer, sizeof(snapshotBuffer));
+        bytes_read = SYS_FS_FileRead(handle, snapshotBuffer, (size_t)size);
+        SYS_CACHE_CleanInvalidateDCache_by_Addr(snapshotBuffer, sizeof(snapshotBuffer));
+        if(bytes_read != (size_t)size)
+        {
+            bytes_read = 0;
+        }
+    }
+    SYS_FS_FileClose(handle);
+    return bytes_read;
+}
+
+static void _writeSnapshot(void)
 {
-    uint16_t imgType;
-    size_t nBytes;
-    uint8_t *ObufferPtr = buffer;
-    size_t x, y=0;
-    /*Reference: https://en.wikipedia.org/wiki/BMP_file_format*/
-    /* First 2 bytes should read 'BM' for bmp file format */
-    imgType = (*buffer <<8) | (*(++buffer));
-    if(imgType != 0x424D ) /* BM in hex */
+    SYS_FS_HANDLE handle;
+    size_t size;
+
+    if(!object_detection_save_snapshot(snapshotBuffer, sizeof(snapshotBuffer), &size))
+    {
+        return;
+    }
+    /* Commit it to memory for the DMA */
+    SYS_CACHE_CleanDCache_by_Addr(snapshotBuffer, sizeof(snapshotBuffer));
+    handle = SYS_FS_FileOpen(SNAPSHOT_FILE, (SYS_FS_FILE_OPEN_WRITE));
+    if(handle == SYS_FS_HANDLE_INVALID)
+    {
+        printf("Snapshot not saved, error:%d \r\n", SYS_FS_Error());
+        return;
+    }
+    if(SYS_FS_FileWrite(handle, snapshotBuffer, size) != size)
     {
-        printf("error: Not a BMP pic format\r\n");
+        printf("Snapshot not saved, error:%d \r\n", SYS_FS_Error());
     }
     else
     {
-        /* 19 through 26 bytes of the header has the W and H info.
-         * We have already read first 2 bytes */
-        width = *(buffer+=17) | *(++buffer)<<8 | *(++buffer)<<16 | *(++buffer)<<24 ;
-        height = *(++buffer) | *(++buffer)<<8 | *(++buffer)<<16 | *(++buffer)<<24 ;
-        printf("W:%d H:%d \r\n", width, height);
-        
-        /* We also need to make sure that the image is 24-bit RGB format which is 
-         * the 28th bit in the header */
-        if(*(buffer+= 3) == 24)
-        {        
-            /* First 54 bytes of the image are BMP headers. The image data starts from 54th byte
-             * onwards.  */
-            nBytes = width*height*3;
-            if(nBytes != ( n_bytes-54))
+        printf("Snapshot of %u bytes saved\r\n", (unsigned)size);
+    }
+    SYS_FS_FileClose(handle);
+}
+
+/* Starts reading image index: image.bmp for 0, imageN.bmp for N */
+static void _readerStart(uint32_t index)
+{
+    appData.imageIndex = index;
+    appData.readerState = APP_READER_OPEN_FILE;
+}
+
+/* Closes the image file if the reader has it open */
+static void _readerStop(void)
+{
+    switch(appData.readerState)
+    {
+        case APP_READER_GET_RFILE_SIZE:
+        case APP_READER_READ_BMP_HEADER:
+        case APP_READER_READ_BMP_ROWS:
+            SYS_FS_FileClose(appData.fileHandle);
+            appData.readerState = APP_READER_ERROR;
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Advances the image reader by one step: opening the file, reading the header
+ * or reading and decoding one chunk of rows. */
+static void _readerTasks(void)
+{
+    SYS_FS_ERROR err;
+    size_t bytes_read;
+
+    switch(appData.readerState)
+    {
+        case APP_READER_OPEN_FILE:
+            if(appData.imageIndex == 0)
             {
-                printf("Not sure why there are additional bytes in the pic. \r\n"
-                        "This may not work!\r\n");
+                strcpy(imagePath, IMAGE_FILE);
             }
-            ObufferPtr = ObufferPtr+54;
-                  
-            int rowStride = (width * 3 + 3) & ~3; // Each row is padded to a multiple of 4 bytes
-            printf("RowStride:%d\r\n", rowStride);
-            for ( y = 0; y < height; y++) 
+            else
+            {
+                sprintf(imagePath, IMAGE_FILE_N, (unsigned)appData.imageIndex);
+            }
+            appData.fileHandle = SYS_FS_FileOpen(imagePath, (SYS_FS_FILE_OPEN_READ));
+            if(appData.fileHandle == SYS_FS_HANDLE_INVALID)
             {
-                for ( x = 0; x < width; x++) 
+                if(appData.imageIndex > 0)
                 {
-                    int bmpIndex = y * rowStride + x * 3; // 3 bytes per pixel (BGR)
-                    int bgrIndex = (y * width + x) * 3;  // BGR in framebuffer
-                    // Copy BGR from BMP directly to framebuffer
-                    fb0[bgrIndex + 0] = ObufferPtr[bmpIndex];      // Blue
-                    fb0[bgrIndex + 1] = ObufferPtr[bmpIndex + 1];  // Green
-                    fb0[bgrIndex + 2] = ObufferPtr[bmpIndex + 2];  // Red                    
+                    /* The images are numbered without gaps */
+                    appData.readerState = APP_READER_NO_MORE_IMAGES;
+                    break;
                 }
+                /* Could not open the file. Error out*/
+                err = SYS_FS_Error();
+                printf("error:%d \r\n", err);
+                appData.readerState = APP_READER_ERROR;
             }
-           
-            /* Now appData.fbPtr is raw ARGB(8888) image buffer of bmp  */
-            printf("successfully copied pic to fb0\r\n");
-        }
-        else
+            else
+            {
+                /* File opened successfully.Get file size */
+                appData.readerState = APP_READER_GET_RFILE_SIZE;
+            }
+            break;
+
+        case APP_READER_GET_RFILE_SIZE:
+
+            appData.fileSize = SYS_FS_FileSize(appData.fileHandle);
+            if(appData.fileSize == -1)
+            {
+                /* Could not get file size. Error out*/
+                err = SYS_FS_Error();
+                printf("error:%d \r\n", err);
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_ERROR;
+            }
+            else
+            {
+                printf("%s: File Size = %d \r\n", imagePath, appData.fileSize);
+                /* File size read successfully. Read bmp file */
+                appData.readerState = APP_READER_READ_BMP_HEADER;
+            }
+            break;
+
+        case APP_READER_READ_BMP_HEADER:
+            bytes_read = _readChunk(BMP_HEADER_SIZE);
+#if defined(DEBUG)
+            printf("Number of bytes read: %d\r\n", bytes_read);
+            /* Lets just print the BMP header bytes_read*/
+            int i;
+            for(i=0;i< BMP_HEADER_SIZE; i++)
+            {
+                printf("bmpChunk[%d]: %d \r\n", i, bmpChunk[i]);
+            }
+#endif
+            if(bytes_read == -1)
+            {
+                /* Read was not successful. Close the file
+                 * and error out.*/
+                err = SYS_FS_Error();
+                printf("error:%d \r\n", err);
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_ERROR;
+            }
+            else if(!appData.modelIsReady ||
+                    !object_detection_begin_image(&appData.bmpStream,
+                                                  bmpChunk, bytes_read))
+            {
+                /* Not an image the model can take */
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_ERROR;
+            }
+            else if(SYS_FS_FileSeek(appData.fileHandle,
+                                    appData.bmpStream.info.pixelOffset,
+                                    SYS_FS_SEEK_SET) == -1)
+            {
+                err = SYS_FS_Error();
+                printf("error:%d \r\n", err);
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_ERROR;
+            }
+            else
+            {
+                appData.rowsPerRead =
+                    sizeof(bmpChunk) / appData.bmpStream.info.rowStride;
+                appData.readerState = APP_READER_READ_BMP_ROWS;
+            }
+            break;
+
+        case APP_READER_READ_BMP_ROWS:
         {
-             printf("error: Not 24 bit RGB format\r\n");
+            const BMP_INFO *info = &appData.bmpStream.info;
+            int32_t rows = BMP_StreamRowsLeft(&appData.bmpStream);
+
+            if(rows > appData.rowsPerRead)
+            {
+                rows = appData.rowsPerRead;
+            }
+            bytes_read = _readChunk(rows * info->rowStride);
+            /* The last row of the file may come without its padding */
+            if(bytes_read == -1 ||
+               bytes_read < (rows - 1) * info->rowStride + info->width * 3)
+            {
+                printf("error: BMP pixel data truncated\r\n");
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_ERROR;
+                break;
+            }
+            BMP_StreamRows(&appData.bmpStream, bmpChunk, rows);
+            if(BMP_StreamRowsLeft(&appData.bmpStream) == 0)
+            {
+                SYS_FS_FileClose(appData.fileHandle);
+                appData.readerState = APP_READER_IMAGE_READY;
+            }
+            break;
         }
-   
 
+        default:
+            /* Image ready, no more images or error: nothing to do until the
+             * reader is started again */
+            break;
     }
 }
 
+/* Called between the operators of the model. SYS_Tasks keeps the USB host
+ * and file system running and calls APP_Tasks, which then reads ahead. */
+static void _yield(void)
+{
+    SYS_Tasks();
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -183,8 +381,16 @@ void APP_Initialize ( void )
     /* Place the App state machine in its initial state. */
     appData.state = APP_STATE_BUS_ENABLE;
     appData.deviceIsConnected = false;
-    
 
+    /* The interpreter is built once, here; it is prepared on the first
+     * attach, so that its snapshot can be read from the drive. Each image
+     * then only needs Invoke() */
+    appData.modelIsReady = object_detection_init();
+    appData.modelInitDone = false;
+    appData.snapshotRestored = false;
+    appData.readerState = APP_READER_NO_MORE_IMAGES;
+    appData.imageIndex = 0;
+    appData.inferenceRunning = false;
 }
 
 USB_HOST_EVENT_RESPONSE APP_USBHostEventHandler (USB_HOST_EVENT event, void * eventData, uintptr_t context)
@@ -229,8 +435,16 @@ void APP_SYSFSEventHandler(SYS_FS_EVENT event, void * eventData, uintptr_t conte
 
 void APP_Tasks ( void )
 {
-    SYS_FS_ERROR err;
-    size_t bytes_read;
+    bool ok;
+
+    if(appData.inferenceRunning)
+    {
+        /* Called from a yield of run_object_detection, through SYS_Tasks:
+         * only read ahead */
+        _readerTasks();
+        return;
+    }
+
     switch(appData.state)
     {
         case APP_STATE_BUS_ENABLE:
@@ -264,107 +478,82 @@ void APP_Tasks ( void )
         case APP_STATE_DEVICE_CONNECTED:
 
             /* Device was connected. We can try mounting the disk */
-            appData.state = APP_STATE_OPEN_FILE;
+            _readerStart(0);
+            appData.state = appData.modelInitDone ? APP_STATE_WAIT_FOR_IMAGE :
+                                                    APP_STATE_LOAD_MODEL;
             break;
 
-        case APP_STATE_OPEN_FILE:
-
-            /* Try opening the file for append */
-            appData.fileHandle = SYS_FS_FileOpen("/mnt/myDrive1/image.bmp", (SYS_FS_FILE_OPEN_READ));
-            if(appData.fileHandle == SYS_FS_HANDLE_INVALID)
-            {
-                /* Could not open the file. Error out*/
-                err = SYS_FS_Error();
-                printf("error:%d \r\n", err);   
-                /* Could not open the file. Error out*/
-                appData.state = APP_STATE_ERROR;
+        case APP_STATE_LOAD_MODEL:
+        {
+            size_t snapshot_size = appData.modelIsReady ? _readSnapshot() : 0;
+
+            appData.modelIsReady = appData.modelIsReady &&
+                    object_detection_prepare(
+                        snapshot_size > 0 ? snapshotBuffer : NULL,
+                        snapshot_size, &appData.snapshotRestored);
+            appData.modelInitDone = true;
+            /* A model that cannot be run fails each image in
+             * APP_READER_READ_BMP_HEADER */
+            appData.state = appData.modelIsReady && !appData.snapshotRestored ?
+                    APP_STATE_SAVE_SNAPSHOT : APP_STATE_WAIT_FOR_IMAGE;
+            break;
+        }
 
-            }
-            else
-            {
-                /* File opened successfully.Get file size */
-                appData.state = APP_STATE_GET_RFILE_SIZE;
+        case APP_STATE_SAVE_SNAPSHOT:
 
-            }
+            /* Failing to save only costs the next boot the full set up */
+            _writeSnapshot();
+            appData.state = APP_STATE_WAIT_FOR_IMAGE;
             break;
 
-        case APP_STATE_GET_RFILE_SIZE:
+        case APP_STATE_WAIT_FOR_IMAGE:
 
-            appData.fileSize = SYS_FS_FileSize(appData.fileHandle);
-            if(appData.fileSize == -1)
-            {
-                /* Could not get file size. Error out*/
-                err = SYS_FS_Error();
-                printf("error:%d \r\n", err);                  
-                appData.state = APP_STATE_ERROR;
-            }
-            else
+            /* The reader may already be done if the image was read during
+             * the previous inference */
+            switch(appData.readerState)
             {
-                printf("File Size = %d \r\n", appData.fileSize);
-                /* File size read successfully. Read bmp file */
-                appData.state = APP_STATE_READ_FROM_FILE;
+                case APP_READER_IMAGE_READY:
+                    appData.state = APP_APPLY_MLMODEL_ON_IMAGE;
+                    break;
+
+                case APP_READER_NO_MORE_IMAGES:
+                    printf("%u image(s) processed\r\n",
+                           (unsigned)appData.imageIndex);
+                    /* Indicate User that File operation has been completed */
+                    LED1_On();
+                    appData.state = APP_STATE_IDLE;
+                    break;
+
+                case APP_READER_ERROR:
+                    appData.state = APP_STATE_ERROR;
+                    break;
+
+                default:
+                    /* One step per call, so that the USB stack keeps running */
+                    _readerTasks();
+                    break;
             }
-                    
             break;
 
-        case APP_STATE_READ_FROM_FILE:            
-            /* Try reading from file */
-            bytes_read = SYS_FS_FileRead(appData.fileHandle, bmpOrig, appData.fileSize );
-#if defined(DEBUG)        
-            printf("Number of bytes read: %d\r\n", bytes_read);
-            /* Lets just print the BMP header bytes_read*/
-            int i;
-            for(i=0;i< 54; i++)
-            {
-                printf("bmpOrig[%d]: %d \r\n", i, bmpOrig[i]);
-            }
-#endif
-            if(bytes_read == -1)
+        case APP_APPLY_MLMODEL_ON_IMAGE:
+            printf("Applying ML Model on image %u\r\n",
+                   (unsigned)appData.imageIndex);
+            /* The BMP rows are already decoded in the input tensor; the next
+             * image is read in the yields between the operators */
+            _readerStart(appData.imageIndex + 1);
+            appData.inferenceRunning = true;
+            ok = run_object_detection(_yield);
+            appData.inferenceRunning = false;
+            if(!ok)
             {
-                /* Read was not successful. Close the file
-                 * and error out.*/
-                err = SYS_FS_Error();
-                printf("error:%d \r\n", err);                  
-                SYS_FS_FileClose(appData.fileHandle);
+                _readerStop();
                 appData.state = APP_STATE_ERROR;
+                break;
             }
-            else
-            {
-                appData.state = APP_STATE_OBTAIN_IMAGE;
-                      
-            }
-                     
-            
-
-            break;
-        case APP_STATE_OBTAIN_IMAGE:
-            /* Close the read file handle first */
-            SYS_FS_FileClose(appData.fileHandle);
-            
-            /* Lets copy the file from bmp to fb0 */             
-            _readBMP((uint8_t*)bmpOrig, appData.fileSize ); 
-#if defined(DEBUG)        
-            printf("Printing first %d bytes \r\n", testbytes_num);
-            /* Lets just print the BMP header bytes_read*/
-            int j;
-            for(j=0;j< testbytes_num; j++)
-            {
-                printf("fb0[%d]: %d \r\n", j, fb0[j]);
-            }
-#endif            
-            appData.state = APP_APPLY_MLMODEL_ON_IMAGE;
-            
-            break;
-        case APP_APPLY_MLMODEL_ON_IMAGE:
-            printf("Applying ML Model on image\r\n");
-            run_object_detection(fb0);
-            /* Indicate User that File operation has been completed */
-            
             printf("Done\r\n");
-            LED1_On(); 
-            
-            appData.state = APP_STATE_IDLE;
+            appData.state = APP_STATE_WAIT_FOR_IMAGE;
             break;
+
         case APP_STATE_IDLE:
 
             /* The application comes here when the demo has completed
@@ -58,6 +58,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 #include <stdlib.h>
 #include "configuration.h"
 #include "definitions.h"
+#include "bmp_input.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -88,18 +89,41 @@ typedef enum
     APP_STATE_WAIT_FOR_BUS_ENABLE_COMPLETE,
     APP_STATE_WAIT_FOR_DEVICE_ATTACH,
     APP_STATE_DEVICE_CONNECTED,
+    APP_STATE_LOAD_MODEL,
+    APP_STATE_SAVE_SNAPSHOT,
     APP_STATE_MOUNT_DISK,
     APP_STATE_UNMOUNT_DISK,
-    APP_STATE_OPEN_FILE,
-    APP_STATE_GET_RFILE_SIZE,
-    APP_STATE_READ_FROM_FILE,
-    APP_STATE_OBTAIN_IMAGE,
+    APP_STATE_WAIT_FOR_IMAGE,
     APP_APPLY_MLMODEL_ON_IMAGE,
     APP_STATE_IDLE,
     APP_STATE_ERROR,
 } APP_STATES;
 
 
+// *****************************************************************************
+/* Image Reader States
+
+  Summary:
+    Image reader states enumeration
+
+  Description:
+    The images are read and decoded by a state machine of their own, one
+    step per call, so that the next image can be read in the yields between
+    the operators of the model while it runs on the current one.
+*/
+
+typedef enum
+{
+    APP_READER_OPEN_FILE = 0,
+    APP_READER_GET_RFILE_SIZE,
+    APP_READER_READ_BMP_HEADER,
+    APP_READER_READ_BMP_ROWS,
+    APP_READER_IMAGE_READY,
+    APP_READER_NO_MORE_IMAGES,
+    APP_READER_ERROR,
+} APP_READER_STATES;
+
+
 // *****************************************************************************
 /* Application Data
 
@@ -135,6 +159,33 @@ typedef struct
     bool deviceIsConnected;
        
     long fileSize;
+
+    /* Set once object_detection_prepare() has been called, on the first
+       attach */
+    bool modelInitDone;
+
+    /* Set while object_detection_init(), at boot, and then
+       object_detection_prepare() have succeeded */
+    bool modelIsReady;
+
+    /* Set if the model was set up from the snapshot on the drive */
+    bool snapshotRestored;
+
+    /* Image reader state */
+    APP_READER_STATES readerState;
+
+    /* Index of the image being read: 0 for image.bmp, N for imageN.bmp */
+    uint32_t imageIndex;
+
+    /* Set while the model runs; APP_Tasks, called again from the yields
+       between its operators, then only steps the image reader */
+    bool inferenceRunning;
+
+    /* Decoder of the BMP rows into the model input */
+    BMP_STREAM bmpStream;
+
+    /* Number of BMP rows read per SYS_FS_FileRead call */
+    int32_t rowsPerRead;
 } APP_DATA;
 
 
@@ -223,7 +274,41 @@ void APP_Tasks( void );
 extern "C" {
 #endif
 
-void run_object_detection(uint8_t* fb0);
+/* Validates the model and builds the interpreter. Called once, at boot;
+   returns false, after printing the reason, if the model cannot be run. */
+bool object_detection_init(void);
+
+/* Sets up the interpreter built by object_detection_init, from snapshot
+   (snapshot_size bytes written by object_detection_save_snapshot on an
+   earlier boot) if it matches this firmware and model, or else by allocating
+   the tensors and preparing every kernel. snapshot may be NULL; *restored
+   tells which way was taken. Called once, when the drive that may hold the
+   snapshot is first attached; returns false, after printing the reason, if
+   the model cannot be run. */
+bool object_detection_prepare(const uint8_t* snapshot, size_t snapshot_size,
+                              bool* restored);
+
+/* Writes the state set up by object_detection_prepare to buffer (buffer_size
+   bytes) and its size to *snapshot_size. Must be called before the first
+   image. Returns false if it does not fit. */
+bool object_detection_save_snapshot(uint8_t* buffer, size_t buffer_size,
+                                    size_t* snapshot_size);
+
+/* Checks the BMP header (header_size bytes) against the model input and
+   points stream at the model input tensor. The rows of the file are then
+   decoded into it with BMP_StreamRows, also from the yields of
+   run_object_detection, which only start once the operators reading the
+   current image are done. Returns false on error. */
+bool object_detection_begin_image(BMP_STREAM* stream, const uint8_t* header,
+                                  size_t header_size);
+
+/* Runs the model on the loaded image and prints the detections. yield, if not
+   NULL, is called between operators. Returns false on error. */
+bool run_object_detection(void (*yield)(void));
+
+/* Runs the kernel micro-benchmarks once and prints the results as CSV on the
+   console. Only built when APP_RUN_KERNEL_BENCHMARKS is defined. */
+void run_kernel_benchmarks(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,213 @@
+/*******************************************************************************
+  BMP decoder for the model input tensor
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    bmp_input.c
+
+  Summary:
+    Decodes 24-bit BMP images straight into a quantized RGB input tensor.
+
+  Description:
+    See bmp_input.h.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+
+#include "bmp_input.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/* Reference: https://en.wikipedia.org/wiki/BMP_file_format */
+#define BMP_OFFSET_PIXEL_DATA   10
+#define BMP_OFFSET_WIDTH        18
+#define BMP_OFFSET_HEIGHT       22
+#define BMP_OFFSET_BPP          28
+#define BMP_OFFSET_COMPRESSION  30
+
+static uint32_t _readU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t _readU16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+bool BMP_ParseHeader(const uint8_t *header, size_t size, BMP_INFO *info)
+{
+    int32_t height;
+
+    if (size < BMP_HEADER_SIZE || header[0] != 'B' || header[1] != 'M')
+    {
+        printf("error: Not a BMP pic format\r\n");
+        return false;
+    }
+    if (_readU16(header + BMP_OFFSET_BPP) != 24 ||
+        _readU32(header + BMP_OFFSET_COMPRESSION) != 0)
+    {
+        printf("error: Not 24 bit RGB format\r\n");
+        return false;
+    }
+
+    height = (int32_t)_readU32(header + BMP_OFFSET_HEIGHT);
+    info->width = (int32_t)_readU32(header + BMP_OFFSET_WIDTH);
+    info->topDown = (height < 0);
+    info->height = info->topDown ? -height : height;
+    info->pixelOffset = _readU32(header + BMP_OFFSET_PIXEL_DATA);
+    info->rowStride = ((uint32_t)info->width * 3 + 3) & ~3u;
+    if (info->width <= 0 || info->height <= 0 ||
+        info->pixelOffset < BMP_HEADER_SIZE)
+    {
+        printf("error: Bad BMP header\r\n");
+        return false;
+    }
+    return true;
+}
+
+void BMP_QuantInit(BMP_QUANT *quant, float scale, int32_t zeroPoint,
+                   bool isSigned)
+{
+    const int32_t qMin = isSigned ? -128 : 0;
+    const int32_t qMax = isSigned ? 127 : 255;
+    int32_t p;
+
+    for (p = 0; p < 256; p++)
+    {
+        const float real = (float)(p - 128) / 128.0f;
+        int32_t q = (int32_t)lroundf(real / scale) + zeroPoint;
+        q = (q < qMin) ? qMin : ((q > qMax) ? qMax : q);
+        quant->lut[p] = (uint8_t)q;
+    }
+
+    quant->xorMask = quant->lut[0];
+    quant->isXor = true;
+    for (p = 0; p < 256; p++)
+    {
+        if (quant->lut[p] != (uint8_t)(p ^ quant->xorMask))
+        {
+            quant->isXor = false;
+            break;
+        }
+    }
+}
+
+void BMP_ConvertRow(const uint8_t *bgr, uint8_t *rgb, int32_t width,
+                    const BMP_QUANT *quant)
+{
+    int32_t x = 0;
+
+    if (quant->isXor)
+    {
+#if defined(__ARM_NEON)
+        /* 16 pixels per iteration: de-interleave, swap B and R, apply the
+           quantization and interleave again. */
+        const uint8x16_t mask = vdupq_n_u8(quant->xorMask);
+        for (; x + 16 <= width; x += 16)
+        {
+            const uint8x16x3_t in = vld3q_u8(bgr + x * 3);
+            uint8x16x3_t out;
+            out.val[0] = veorq_u8(in.val[2], mask);
+            out.val[1] = veorq_u8(in.val[1], mask);
+            out.val[2] = veorq_u8(in.val[0], mask);
+            vst3q_u8(rgb + x * 3, out);
+        }
+#endif
+        for (; x < width; x++)
+        {
+            rgb[x * 3 + 0] = bgr[x * 3 + 2] ^ quant->xorMask;
+            rgb[x * 3 + 1] = bgr[x * 3 + 1] ^ quant->xorMask;
+            rgb[x * 3 + 2] = bgr[x * 3 + 0] ^ quant->xorMask;
+        }
+        return;
+    }
+
+    for (; x < width; x++)
+    {
+        rgb[x * 3 + 0] = quant->lut[bgr[x * 3 + 2]];
+        rgb[x * 3 + 1] = quant->lut[bgr[x * 3 + 1]];
+        rgb[x * 3 + 2] = quant->lut[bgr[x * 3 + 0]];
+    }
+}
+
+bool BMP_StreamBegin(BMP_STREAM *stream, const uint8_t *header, size_t size,
+                     int32_t width, int32_t height, const BMP_QUANT *quant,
+                     uint8_t *dst)
+{
+    if (!BMP_ParseHeader(header, size, &stream->info))
+    {
+        return false;
+    }
+    if (stream->info.width != width || stream->info.height != height)
+    {
+        printf("error: Image is %dx%d, the model needs %dx%d\r\n",
+               (int)stream->info.width, (int)stream->info.height, (int)width,
+               (int)height);
+        return false;
+    }
+    stream->quant = quant;
+    stream->dst = dst;
+    stream->rowsDone = 0;
+    return true;
+}
+
+void BMP_StreamRows(BMP_STREAM *stream, const uint8_t *rows,
+                    int32_t rowCount)
+{
+    const BMP_INFO *info = &stream->info;
+    const size_t dstStride = (size_t)info->width * 3;
+    int32_t i;
+
+    if (rowCount > BMP_StreamRowsLeft(stream))
+    {
+        rowCount = BMP_StreamRowsLeft(stream);
+    }
+    for (i = 0; i < rowCount; i++)
+    {
+        const int32_t row = stream->rowsDone + i;
+        const int32_t y = info->topDown ? row : (info->height - 1 - row);
+        BMP_ConvertRow(rows + (size_t)i * info->rowStride,
+                       stream->dst + (size_t)y * dstStride, info->width,
+                       stream->quant);
+    }
+    stream->rowsDone += rowCount;
+}
+
+int32_t BMP_StreamRowsLeft(const BMP_STREAM *stream)
+{
+    return stream->info.height - stream->rowsDone;
+}
+
+/*******************************************************************************
+ End of File
+ */
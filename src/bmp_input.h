@@ -0,0 +1,137 @@
+/*******************************************************************************
+  BMP decoder for the model input tensor
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    bmp_input.h
+
+  Summary:
+    Decodes 24-bit BMP images straight into a quantized RGB input tensor.
+
+  Description:
+    BMP files store pixels as BGR, rows padded to 4 bytes and, unless the
+    height in the header is negative, the bottom row first. The functions
+    below parse the header and convert rows, as they are read from the file,
+    into the top-down, RGB, int8/uint8 layout expected by the model, so that
+    neither the file nor the image ever has to be held in memory as a whole.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef _BMP_INPUT_H
+#define _BMP_INPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size of the BITMAPFILEHEADER plus BITMAPINFOHEADER fields read by
+   BMP_ParseHeader. */
+#define BMP_HEADER_SIZE 54
+
+typedef struct
+{
+    /* Image size in pixels; height is always positive. */
+    int32_t width;
+    int32_t height;
+
+    /* True if the first row in the file is the top row of the image. */
+    bool topDown;
+
+    /* File offset of the first stored row. */
+    uint32_t pixelOffset;
+
+    /* Bytes per stored row, including the padding to 4 bytes. */
+    uint32_t rowStride;
+} BMP_INFO;
+
+typedef struct
+{
+    /* Quantized model input value for each 8-bit pixel value. */
+    uint8_t lut[256];
+
+    /* Set when lut[p] == (p ^ xorMask) for every p, which is the case for
+       the usual [-1, 1) inputs with scale 1/128 (uint8: identity, int8: sign
+       bit flip) and lets BMP_ConvertRow skip the table. */
+    bool isXor;
+    uint8_t xorMask;
+} BMP_QUANT;
+
+/* Parses the file and DIB headers of a BMP file whose first size bytes are
+   in header (at least BMP_HEADER_SIZE). Only uncompressed 24-bit images are
+   accepted. Returns false, after printing the reason, otherwise. */
+bool BMP_ParseHeader(const uint8_t *header, size_t size, BMP_INFO *info);
+
+/* Builds the pixel to input tensor mapping. Pixels are normalized to the
+   MobileNet input range as (p - 128) / 128 and quantized with the tensor's
+   scale and zeroPoint, as int8 if isSigned and uint8 otherwise. */
+void BMP_QuantInit(BMP_QUANT *quant, float scale, int32_t zeroPoint,
+                   bool isSigned);
+
+/* Converts width BGR pixels from bgr into quantized RGB pixels in rgb. */
+void BMP_ConvertRow(const uint8_t *bgr, uint8_t *rgb, int32_t width,
+                    const BMP_QUANT *quant);
+
+typedef struct
+{
+    BMP_INFO info;
+    const BMP_QUANT *quant;
+    uint8_t *dst;
+
+    /* Number of stored rows converted so far. */
+    int32_t rowsDone;
+} BMP_STREAM;
+
+/* Starts decoding the BMP file whose header is in header (size bytes, at
+   least BMP_HEADER_SIZE) into dst, a width x height x 3 top-down RGB tensor
+   quantized by quant. The rows must then be passed to BMP_StreamRows in file
+   order, starting at stream->info.pixelOffset. Returns false, after printing
+   the reason, if the file is not a 24-bit BMP of exactly that size. */
+bool BMP_StreamBegin(BMP_STREAM *stream, const uint8_t *header, size_t size,
+                     int32_t width, int32_t height, const BMP_QUANT *quant,
+                     uint8_t *dst);
+
+/* Converts the next rowCount stored rows, held back to back with
+   info.rowStride bytes each in rows, into their place in dst. The padding of
+   the last row of the file may be missing. */
+void BMP_StreamRows(BMP_STREAM *stream, const uint8_t *rows,
+                    int32_t rowCount);
+
+/* Number of stored rows BMP_StreamRows still expects. */
+int32_t BMP_StreamRowsLeft(const BMP_STREAM *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BMP_INPUT_H */
+/*******************************************************************************
+ End of File
+ */
@@ -0,0 +1,63 @@
+/*******************************************************************************
+  Timer functions used by TensorFlow Lite Micro profiling
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    micro_time.cpp
+
+  Summary:
+    TFLM micro_time platform implementation
+
+  Description:
+    Implements tflite::ticks_per_second() and tflite::GetCurrentTimeTicks() on
+    top of TC0 channel 0, replacing the reference micro_time.cpp (which returns
+    0 and therefore disables all profiling).
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2020 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+#include "tensorflow/lite/micro/micro_time.h"
+
+#include "peripheral/tc/plib_tc0.h"
+
+// TC0 channel 0 is the SYS_TIME hardware counter: it is started at boot and
+// free-runs over the full 32-bit range (SYS_TIME_HW_COUNTER_PERIOD), so it can
+// be read here without touching its configuration. At 82 MHz it wraps about
+// every 52 seconds; tflite::TicksElapsed() takes differences modulo 2^32, which
+// is correct for any interval shorter than that.
+namespace tflite {
+
+int32_t ticks_per_second()
+{
+    return static_cast<int32_t>(TC0_CH0_TimerFrequencyGet());
+}
+
+int32_t GetCurrentTimeTicks()
+{
+    return static_cast<int32_t>(TC0_CH0_TimerCounterGet());
+}
+
+}  // namespace tflite
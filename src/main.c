@@ -64,6 +64,11 @@ int main ( void )
 
     printf("\r\nObject Recognition demo with SSD Mobilenet V1 model trained with COCO dataset.\r\n");
     printf("Please make sure you use image of 300x300 resolution.\r\n\n\n");
+
+#if defined(APP_RUN_KERNEL_BENCHMARKS)
+    run_kernel_benchmarks();
+#endif
+
     while ( true )
     {
         /* Maintain state machines of all polled MPLAB Harmony modules. */
@@ -1,21 +1,34 @@
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_op_profiler.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 //#include "tensorflow/lite/version.h"
-#include "tensorflow/lite/micro/kernels/micro_ops.h"
-#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#if defined(APP_RUN_KERNEL_BENCHMARKS)
+#include "tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.h"
+#endif
 #include "model.h"
+#include "model_op_resolver.h"
 #include "app.h"
+#include "bmp_input.h"
 
 #define IMAGE_WIDTH 300
 #define IMAGE_HEIGHT 300
 #define IMAGE_CHANNELS 3
 #define IMAGE_SIZE (IMAGE_WIDTH * IMAGE_HEIGHT * IMAGE_CHANNELS)
-constexpr int TENSOR_ARENA_SIZE = 300 * 1024; // trial & error
+// Size with "make -C host plan" (see README.md), which reports the minimum
+// arena for the model; the "Model ready" line printed at boot gives the
+// exact figure on the board. Can be overridden from the project settings.
+#if defined(APP_TENSOR_ARENA_SIZE)
+constexpr int TENSOR_ARENA_SIZE = APP_TENSOR_ARENA_SIZE;
+#else
+constexpr int TENSOR_ARENA_SIZE = 300 * 1024;
+#endif
 
-//alignas(16) static uint8_t tensor_arena[TENSOR_ARENA_SIZE];
-static uint8_t __attribute__ ((section(".region_nocache"), aligned(16))) tensor_arena[TENSOR_ARENA_SIZE] = { 0 };
+// The arena lives in cacheable DDR: it is only ever accessed by the CPU, so
+// no cache maintenance is needed around Invoke(). Buffers written by DMA are
+// cleaned/invalidated where the transfer happens (see app.c).
+static uint8_t CACHE_ALIGN tensor_arena[TENSOR_ARENA_SIZE];
 
 const char* coco_labels[92] = {
     "background", "person", "bicycle", "car", "motorcycle", "airplane", "bus",
@@ -33,91 +46,327 @@ const char* coco_labels[92] = {
     "clock", "vase", "scissors", "teddy bear", "hair drier", "toothbrush", "hair brush"
 };
 
-void run_object_detection(uint8_t* fb0) 
-{
-
-    // Setup
-    static tflite::MicroErrorReporter micro_error_reporter;  
-    // Define a resolver with the required number of operators
-    //constexpr int kOpCount = 10;
-    //static tflite::MicroMutableOpResolver<kOpCount> micro_op_resolver;
-    static tflite::MicroMutableOpResolver<10> micro_op_resolver;
-  
-    // Register only the necessary operators for SSD-MobileNet model
-    micro_op_resolver.AddDepthwiseConv2D();
-    micro_op_resolver.AddConv2D();   
-    micro_op_resolver.AddAveragePool2D();
-    micro_op_resolver.AddMaxPool2D();
-    micro_op_resolver.AddSoftmax();
-    micro_op_resolver.AddReshape();
-    micro_op_resolver.AddFullyConnected();   
-    micro_op_resolver.AddDetectionPostprocess();
-    micro_op_resolver.AddLogistic();
-    micro_op_resolver.AddAdd();
-
-#if 0          
-    const tflite::Model* model = tflite::GetModel(detect_tflite);
-   
-       
-    for (int i = 0; i < 10; ++i) {
-        printf("Model data[%d]: 0x%02X\n", i, detect_tflite[i]);
+namespace {
+
+// Everything that only depends on the model is set up once: Init() checks the
+// model and builds the interpreter at boot, and Prepare(), once the drive
+// that may hold a snapshot is attached, runs AllocateTensors() and builds the
+// input quantization table. Each image then only costs the BMP decode, done
+// by app.c straight into the input tensor while it reads the file, and
+// Invoke(). The decode of the next image
+// runs in the yields between the operators of the current Invoke(), once the
+// operators that read the input are done; the arena planner keeps the input
+// tensor allocated for the whole Invoke() for this. A snapshot of the
+// prepared interpreter saved by SaveSnapshot() on an earlier boot replaces
+// AllocateTensors() and the Init() and Prepare() of every kernel.
+class SsdDetector
+{
+public:
+    SsdDetector()
+        : model_(tflite::GetModel(detect_tflite)),
+          profiler_(SYS_TIME_CPU_CLOCK_FREQUENCY),
+          interpreter_(model_, resolver_, tensor_arena, TENSOR_ARENA_SIZE,
+                       &error_reporter_, nullptr, &profiler_) {}
+
+    bool Init();
+    bool Prepare(const uint8_t* snapshot, size_t snapshot_size,
+                 bool* restored);
+    bool SaveSnapshot(uint8_t* buffer, size_t buffer_size,
+                      size_t* snapshot_size);
+    bool BeginImage(BMP_STREAM* stream, const uint8_t* header,
+                    size_t header_size);
+    bool Detect(void (*yield)(void));
+
+private:
+    static void Yield(void* context);
+    void ReportLatency(int32_t ticks);
+    void PrintDetections() const;
+
+    tflite::MicroErrorReporter error_reporter_;
+    const tflite::Model* model_;
+    // Generated from the model by "make -C host resolver" (see README.md)
+    ModelOpResolver resolver_;
+    // Per-op timing from the TC0 counter, reported over the console UART
+    tflite::MicroOpProfiler profiler_;
+    tflite::MicroInterpreter interpreter_;
+
+    // Set by Init() and Prepare() once they succeed
+    bool model_checked_ = false;
+    bool initialized_ = false;
+    BMP_QUANT input_quant_;
+    TfLiteTensor* input_ = nullptr;
+    // Index of the last operator that reads the input tensor, also through
+    // views of it such as a RESHAPE; the next image may only be written into
+    // it after that one
+    int last_input_reader_ = 0;
+    TfLiteTensor* boxes_ = nullptr;    // [1,10,4]
+    TfLiteTensor* classes_ = nullptr;  // [1,10]
+    TfLiteTensor* scores_ = nullptr;   // [1,10]
+    TfLiteTensor* count_ = nullptr;    // [1]
+
+    uint32_t invocations_ = 0;
+    // Sum of the Invoke() times after the first one
+    uint64_t steady_state_ticks_ = 0;
+
+    // Called between the operators of Invoke(), and the time it took during
+    // the current one
+    void (*yield_)(void) = nullptr;
+    int32_t yield_ticks_ = 0;
+    // Operators of the current Invoke() that have run
+    int operators_run_ = 0;
+};
+
+bool SsdDetector::Init()
+{
+    if (model_->version() != TFLITE_SCHEMA_VERSION)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_,
+                             "Model provided is schema version %d not equal "
+                             "to supported version %d.",
+                             model_->version(), TFLITE_SCHEMA_VERSION);
+        return false;
     }
-    printf("Model version: %d\n", model->version());
+    profiler_.SetModel(model_);
+    model_checked_ = true;
+    return true;
+}
 
- /*    
-  
-    if (model->version() != TFLITE_SCHEMA_VERSION) 
+bool SsdDetector::Prepare(const uint8_t* snapshot, size_t snapshot_size,
+                          bool* restored)
+{
+    *restored = false;
+    if (!model_checked_ || initialized_)
     {
-        TF_LITE_REPORT_ERROR(&micro_error_reporter,
-                           "Model provided is schema version %d not equal "
-                           "to supported version %d.",
-                           model->version(), TFLITE_SCHEMA_VERSION);
-        return;
+        TF_LITE_REPORT_ERROR(&error_reporter_,
+                             "Prepare() must follow a successful Init(), "
+                             "once");
+        return false;
     }
-*/    
-    static tflite::MicroInterpreter interpreter(model, micro_op_resolver, tensor_arena,
-                                                TENSOR_ARENA_SIZE, &micro_error_reporter);
-    
-    if (interpreter.AllocateTensors() != kTfLiteOk) 
+
+    // The next image is decoded into the input tensor while Invoke() runs,
+    // so the arena must not hand the input buffer to later operators
+    interpreter_.SetPreserveInputs(true);
+
+    // RestoreSnapshot() reports why a snapshot does not match (another model,
+    // firmware build or arena) and leaves the interpreter as it was
+    const int32_t start = tflite::GetCurrentTimeTicks();
+    *restored = snapshot != nullptr &&
+                interpreter_.RestoreSnapshot(detect_tflite_len, snapshot,
+                                             snapshot_size) == kTfLiteOk;
+    if (!*restored && interpreter_.AllocateTensors() != kTfLiteOk)
     {
-        TF_LITE_REPORT_ERROR(&micro_error_reporter, "Tensor allocation failed");
-        return;
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Tensor allocation failed");
+        return false;
     }
-      
+    const int32_t setup_ticks =
+        tflite::TicksElapsed(start, tflite::GetCurrentTimeTicks());
 
-    
+    input_ = interpreter_.input(0);
+    if ((input_->type != kTfLiteUInt8 && input_->type != kTfLiteInt8) ||
+        input_->params.scale <= 0.0f || input_->bytes != IMAGE_SIZE)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Unsupported model input %s",
+                             TfLiteTypeGetName(input_->type));
+        return false;
+    }
+    BMP_QuantInit(&input_quant_, input_->params.scale,
+                  input_->params.zero_point, input_->type == kTfLiteInt8);
+    last_input_reader_ = interpreter_.LastInputReader(0);
 
+    // SSD-MobileNet v1 post-processed output format
+    if (interpreter_.outputs_size() != 4)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Model has %d outputs, not 4",
+                             interpreter_.outputs_size());
+        return false;
+    }
+    boxes_ = interpreter_.output(0);
+    classes_ = interpreter_.output(1);
+    scores_ = interpreter_.output(2);
+    count_ = interpreter_.output(3);
+    if (boxes_->type != kTfLiteFloat32 || classes_->type != kTfLiteFloat32 ||
+        scores_->type != kTfLiteFloat32 || count_->type != kTfLiteFloat32)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Model outputs must be float32");
+        return false;
+    }
 
-    TfLiteTensor* input = interpreter.input(0);
+    printf("Model ready in %d ms%s, %u bytes of the %u byte tensor arena "
+           "used\r\n",
+           (int)tflite::TicksToMs(setup_ticks),
+           *restored ? " (from snapshot)" : "",
+           (unsigned)interpreter_.arena_used_bytes(),
+           (unsigned)TENSOR_ARENA_SIZE);
+    initialized_ = true;
+    return true;
+}
 
-    // Convert from BGR framebuffer to model's RGB input
-    for (int i = 0; i < IMAGE_WIDTH * IMAGE_HEIGHT; i++) {
-        input->data.uint8[i * 3 + 0] = fb0[i * 3 + 2]; // R
-        input->data.uint8[i * 3 + 1] = fb0[i * 3 + 1]; // G
-        input->data.uint8[i * 3 + 2] = fb0[i * 3 + 0]; // B
+bool SsdDetector::SaveSnapshot(uint8_t* buffer, size_t buffer_size,
+                               size_t* snapshot_size)
+{
+    // Taken before the first Invoke(), while the kernels' persistent data is
+    // exactly what Prepare() left
+    if (!initialized_ || invocations_ != 0)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_,
+                             "Snapshot must be saved right after Prepare()");
+        return false;
     }
+    return interpreter_.SaveSnapshot(detect_tflite_len, buffer, buffer_size,
+                                     snapshot_size) == kTfLiteOk;
+}
 
-    if (interpreter.Invoke() != kTfLiteOk) {
-        TF_LITE_REPORT_ERROR(&micro_error_reporter, "Invoke failed");
+void SsdDetector::ReportLatency(int32_t ticks)
+{
+    ++invocations_;
+    if (invocations_ == 1)
+    {
+        // Cold caches and TLB, and the first pass over every weight
+        printf("Inference: %d ms (first image)\r\n",
+               (int)tflite::TicksToMs(ticks));
         return;
     }
+    steady_state_ticks_ += static_cast<uint32_t>(ticks);
+    const int32_t average = static_cast<int32_t>(
+        steady_state_ticks_ / (invocations_ - 1));
+    printf("Inference: %d ms, steady state average %d ms over %u images\r\n",
+           (int)tflite::TicksToMs(ticks), (int)tflite::TicksToMs(average),
+           (unsigned)(invocations_ - 1));
+}
 
-    // SSD-MobileNet v1 quantized output format
-    TfLiteTensor* boxes = interpreter.output(0);    // [1,10,4]
-    TfLiteTensor* classes = interpreter.output(1);  // [1,10]
-    TfLiteTensor* scores = interpreter.output(2);   // [1,10]
-    TfLiteTensor* count = interpreter.output(3);    // [1]
-
-    int num = static_cast<int>(count->data.f[0]);
-    for (int i = 0; i < num; ++i) 
+void SsdDetector::PrintDetections() const
+{
+    int num = static_cast<int>(count_->data.f[0]);
+    for (int i = 0; i < num; ++i)
     {
-        float score = scores->data.f[i];
-        int class_id = static_cast<int>(classes->data.f[i]);
-        if (score > 0.5f) 
+        float score = scores_->data.f[i];
+        int class_id = static_cast<int>(classes_->data.f[i]);
+        if (score > 0.5f)
         {
             const char* label = (class_id >= 0 && class_id < 91) ? coco_labels[class_id] : "unknown";
             printf("Object %d: %s (class_id=%d) score=%.2f\n", i, label, class_id, score);
         }
     }
-#endif
 }
+
+bool SsdDetector::BeginImage(BMP_STREAM* stream, const uint8_t* header,
+                             size_t header_size)
+{
+    if (!initialized_)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Model is not initialized");
+        return false;
+    }
+    // The rows are flipped to top-down RGB, quantized and written into the
+    // input tensor as they are read from the file
+    return BMP_StreamBegin(stream, header, header_size, IMAGE_WIDTH,
+                           IMAGE_HEIGHT, &input_quant_, input_->data.uint8);
+}
+
+void SsdDetector::Yield(void* context)
+{
+    SsdDetector* detector = static_cast<SsdDetector*>(context);
+    // The I/O may write the next image into the input tensor, which is only
+    // free once the operators reading it have run
+    if (++detector->operators_run_ <= detector->last_input_reader_)
+    {
+        return;
+    }
+    const int32_t start = tflite::GetCurrentTimeTicks();
+    detector->yield_();
+    detector->yield_ticks_ +=
+        tflite::TicksElapsed(start, tflite::GetCurrentTimeTicks());
+}
+
+bool SsdDetector::Detect(void (*yield)(void))
+{
+    if (!initialized_)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Model is not initialized");
+        return false;
+    }
+
+    yield_ = yield;
+    yield_ticks_ = 0;
+    operators_run_ = 0;
+    interpreter_.SetYield(yield != nullptr ? &SsdDetector::Yield : nullptr,
+                          this);
+    const int32_t start = tflite::GetCurrentTimeTicks();
+    const TfLiteStatus status = interpreter_.Invoke();
+    const int32_t ticks =
+        tflite::TicksElapsed(start, tflite::GetCurrentTimeTicks());
+    interpreter_.SetYield(nullptr, nullptr);
+    if (status != kTfLiteOk)
+    {
+        TF_LITE_REPORT_ERROR(&error_reporter_, "Invoke failed");
+        return false;
+    }
+    // The latency is the model's own; the time lent to the I/O of the next
+    // image is reported apart
+    ReportLatency(ticks - yield_ticks_);
+    if (yield_ticks_ > 0)
+    {
+        printf("I/O between operators: %d ms\r\n",
+               (int)tflite::TicksToMs(yield_ticks_));
+    }
+
+    // Per-op profile of this image only
+    profiler_.LogReport();
+    profiler_.Reset();
+
+    PrintDetections();
+    return true;
+}
+
+SsdDetector& detector()
+{
+    static SsdDetector instance;
+    return instance;
+}
+
+}  // namespace
+
+bool object_detection_init(void)
+{
+    return detector().Init();
+}
+
+bool object_detection_prepare(const uint8_t* snapshot, size_t snapshot_size,
+                              bool* restored)
+{
+    return detector().Prepare(snapshot, snapshot_size, restored);
+}
+
+bool object_detection_save_snapshot(uint8_t* buffer, size_t buffer_size,
+                                    size_t* snapshot_size)
+{
+    return detector().SaveSnapshot(buffer, buffer_size, snapshot_size);
+}
+
+bool object_detection_begin_image(BMP_STREAM* stream, const uint8_t* header,
+                                  size_t header_size)
+{
+    return detector().BeginImage(stream, header, header_size);
+}
+
+bool run_object_detection(void (*yield)(void))
+{
+    return detector().Detect(yield);
+}
+
+#if defined(APP_RUN_KERNEL_BENCHMARKS)
+// The kernel micro-benchmarks run every op of the model in isolation at the
+// SSD layer shapes, which needs far more memory than the model itself: the
+// float variants of the early MobileNet layers alone move about 9 MB.
+static uint8_t CACHE_ALIGN benchmark_arena[16 * 1024 * 1024];
+
+void run_kernel_benchmarks(void)
+{
+    const tflite::SsdKernelBenchmarkConfig config = {
+        benchmark_arena, sizeof(benchmark_arena),
+        SYS_TIME_CPU_CLOCK_FREQUENCY,
+        /*min_iterations=*/1,
+        /*min_ticks=*/tflite::ticks_per_second() / 10};
+    tflite::RunSsdKernelBenchmarks(config);
+}
+#endif
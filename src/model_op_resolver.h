@@ -0,0 +1,152 @@
+/*******************************************************************************
+  Op resolver for the model
+
+  Output of host/gen_op_resolver for the operators the detector registered
+  with MicroMutableOpResolver before (the model itself is not in git, see
+  README.md), so it may list operators the model does not use. Do not edit;
+  regenerate from the model with "make -C host resolver".
+*******************************************************************************/
+#ifndef MODEL_OP_RESOLVER_H
+#define MODEL_OP_RESOLVER_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/kernels/softmax.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+TfLiteRegistration* Register_DETECTION_POSTPROCESS();
+}  // namespace tflite
+
+namespace model_op_resolver {
+
+struct ModelOp {
+  tflite::BuiltinOperator code;
+  const char* custom_name;
+  tflite::MicroOpResolver::BuiltinParseFunction parser;
+};
+
+// Builtin operators in BuiltinOperator order, then custom operators.
+constexpr int kOpCount = 10;
+constexpr int kBuiltinOpCount = 9;
+constexpr ModelOp kOps[kOpCount] = {
+    {tflite::BuiltinOperator_ADD, nullptr, tflite::ParseAdd},
+    {tflite::BuiltinOperator_AVERAGE_POOL_2D, nullptr, tflite::ParsePool},
+    {tflite::BuiltinOperator_CONV_2D, nullptr, tflite::ParseConv2D},
+    {tflite::BuiltinOperator_DEPTHWISE_CONV_2D, nullptr,
+     tflite::ParseDepthwiseConv2D},
+    {tflite::BuiltinOperator_FULLY_CONNECTED, nullptr,
+     tflite::ParseFullyConnected},
+    {tflite::BuiltinOperator_LOGISTIC, nullptr, tflite::ParseLogistic},
+    {tflite::BuiltinOperator_MAX_POOL_2D, nullptr, tflite::ParsePool},
+    {tflite::BuiltinOperator_RESHAPE, nullptr, tflite::ParseReshape},
+    {tflite::BuiltinOperator_SOFTMAX, nullptr, tflite::ParseSoftmax},
+    {tflite::BuiltinOperator_CUSTOM, "TFLite_Detection_PostProcess", nullptr},
+};
+
+// Index into kOps for each BuiltinOperator up to the largest one used,
+// kOpCount for the ones the model does not use.
+constexpr int kBuiltinIndexSize = 26;
+constexpr uint8_t kBuiltinIndex[kBuiltinIndexSize] = {
+    0,         // ADD
+    1,         // AVERAGE_POOL_2D
+    kOpCount,  // CONCATENATION
+    2,         // CONV_2D
+    3,         // DEPTHWISE_CONV_2D
+    kOpCount,  // DEPTH_TO_SPACE
+    kOpCount,  // DEQUANTIZE
+    kOpCount,  // EMBEDDING_LOOKUP
+    kOpCount,  // FLOOR
+    4,         // FULLY_CONNECTED
+    kOpCount,  // HASHTABLE_LOOKUP
+    kOpCount,  // L2_NORMALIZATION
+    kOpCount,  // L2_POOL_2D
+    kOpCount,  // LOCAL_RESPONSE_NORMALIZATION
+    5,         // LOGISTIC
+    kOpCount,  // LSH_PROJECTION
+    kOpCount,  // LSTM
+    6,         // MAX_POOL_2D
+    kOpCount,  // MUL
+    kOpCount,  // RELU
+    kOpCount,  // RELU_N1_TO_1
+    kOpCount,  // RELU6
+    7,         // RESHAPE
+    kOpCount,  // RESIZE_BILINEAR
+    kOpCount,  // RNN
+    8,         // SOFTMAX
+};
+
+}  // namespace model_op_resolver
+
+// Resolves the operators of the model in constant time; builtin operators
+// are not registered at run time, and unused kernels are not linked in.
+class ModelOpResolver : public tflite::MicroOpResolver {
+ public:
+  TF_LITE_REMOVE_VIRTUAL_DELETE
+
+  ModelOpResolver()
+      : registrations_{
+            tflite::Register_ADD(),
+            tflite::Register_AVERAGE_POOL_2D(),
+            tflite::Register_CONV_2D(),
+            tflite::Register_DEPTHWISE_CONV_2D(),
+            tflite::Register_FULLY_CONNECTED(),
+            tflite::Register_LOGISTIC(),
+            tflite::Register_MAX_POOL_2D(),
+            tflite::ops::micro::Register_RESHAPE(),
+            tflite::Register_SOFTMAX(),
+            *tflite::Register_DETECTION_POSTPROCESS(),
+        } {
+    for (int i = 0; i < model_op_resolver::kOpCount; ++i) {
+      registrations_[i].builtin_code = model_op_resolver::kOps[i].code;
+      registrations_[i].custom_name =
+          model_op_resolver::kOps[i].custom_name;
+    }
+  }
+
+  const TfLiteRegistration* FindOp(
+      tflite::BuiltinOperator op) const override {
+    const int index = BuiltinIndex(op);
+    return index < model_op_resolver::kOpCount
+               ? &registrations_[index]
+               : nullptr;
+  }
+
+  const TfLiteRegistration* FindOp(const char* op) const override {
+    for (int i = model_op_resolver::kBuiltinOpCount;
+         i < model_op_resolver::kOpCount; ++i) {
+      if (strcmp(model_op_resolver::kOps[i].custom_name, op) == 0) {
+        return &registrations_[i];
+      }
+    }
+    return nullptr;
+  }
+
+  BuiltinParseFunction GetOpDataParser(
+      tflite::BuiltinOperator op) const override {
+    const int index = BuiltinIndex(op);
+    return index < model_op_resolver::kOpCount
+               ? model_op_resolver::kOps[index].parser
+               : nullptr;
+  }
+
+ private:
+  static int BuiltinIndex(tflite::BuiltinOperator op) {
+    const int code = static_cast<int>(op);
+    return code >= 0 && code < model_op_resolver::kBuiltinIndexSize
+               ? model_op_resolver::kBuiltinIndex[code]
+               : model_op_resolver::kOpCount;
+  }
+
+  TfLiteRegistration registrations_[model_op_resolver::kOpCount];
+};
+
+#endif  // MODEL_OP_RESOLVER_H
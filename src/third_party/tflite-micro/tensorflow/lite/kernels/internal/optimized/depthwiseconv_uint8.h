@@ -0,0 +1,180 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_DEPTHWISECONV_UINT8_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_DEPTHWISECONV_UINT8_H_
+
+#include <algorithm>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_ops {
+namespace depthwise_conv {
+
+// Number of output channels accumulated at once for one output pixel. Deeper
+// layers are processed in several channel blocks.
+constexpr int kAccBufferMaxSize = 256;
+
+// Computes the [start, end) range of filter taps whose input coordinate
+// (origin + dilation * tap) falls inside [0, input_size), so that the inner
+// loops never have to test for padding.
+inline void GetFilterTapRange(int origin, int dilation, int filter_size,
+                              int input_size, int* start, int* end) {
+  *start = origin < 0 ? (-origin + dilation - 1) / dilation : 0;
+  const int limit = input_size - origin;
+  *end = limit <= 0
+             ? 0
+             : std::min(filter_size, (limit + dilation - 1) / dilation);
+  *end = std::max(*end, *start);
+}
+
+}  // namespace depthwise_conv
+
+// Same semantics as reference_ops::DepthwiseConv for uint8, with per-tensor
+// zero points for input and filter. Padding bounds are resolved once per
+// output row/pixel and the accumulation runs over contiguous channels, so the
+// inner loop is a plain multiply-accumulate without Offset() computations.
+// Output is bit-exact with the reference kernel.
+inline void DepthwiseConv(
+    const DepthwiseParams& params, const RuntimeShape& input_shape,
+    const uint8_t* input_data, const RuntimeShape& filter_shape,
+    const uint8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    uint8_t* output_data) {
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  const int32_t input_offset = params.input_offset;
+  const int32_t filter_offset = params.weights_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_multiplier = params.output_multiplier;
+  const int output_shift = params.output_shift;
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+
+  TFLITE_DCHECK_LE(output_activation_min, output_activation_max);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
+  TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  TFLITE_DCHECK_LE(depth_multiplier, depthwise_conv::kAccBufferMaxSize);
+
+  const int input_block_depth =
+      depthwise_conv::kAccBufferMaxSize / depth_multiplier;
+  const int input_row_size = input_width * input_depth;
+  const int filter_row_size = filter_width * output_depth;
+  int32_t acc_buffer[depthwise_conv::kAccBufferMaxSize];
+
+  for (int b = 0; b < batches; ++b) {
+    const uint8_t* input_batch =
+        input_data + b * input_height * input_row_size;
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      int filter_y_start, filter_y_end;
+      depthwise_conv::GetFilterTapRange(in_y_origin, dilation_height_factor,
+                                        filter_height, input_height,
+                                        &filter_y_start, &filter_y_end);
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        int filter_x_start, filter_x_end;
+        depthwise_conv::GetFilterTapRange(in_x_origin, dilation_width_factor,
+                                          filter_width, input_width,
+                                          &filter_x_start, &filter_x_end);
+        uint8_t* output_ptr =
+            output_data + Offset(output_shape, b, out_y, out_x, 0);
+
+        for (int ic_start = 0; ic_start < input_depth;
+             ic_start += input_block_depth) {
+          const int ic_count =
+              std::min(input_block_depth, input_depth - ic_start);
+          const int oc_start = ic_start * depth_multiplier;
+          const int oc_count = ic_count * depth_multiplier;
+
+          if (bias_data) {
+            for (int c = 0; c < oc_count; ++c) {
+              acc_buffer[c] = bias_data[oc_start + c];
+            }
+          } else {
+            std::fill(acc_buffer, acc_buffer + oc_count, 0);
+          }
+
+          for (int filter_y = filter_y_start; filter_y < filter_y_end;
+               ++filter_y) {
+            const int in_y = in_y_origin + dilation_height_factor * filter_y;
+            const uint8_t* input_row = input_batch + in_y * input_row_size;
+            const uint8_t* filter_row =
+                filter_data + filter_y * filter_row_size;
+            for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                 ++filter_x) {
+              const int in_x = in_x_origin + dilation_width_factor * filter_x;
+              const uint8_t* input_ptr =
+                  input_row + in_x * input_depth + ic_start;
+              const uint8_t* filter_ptr =
+                  filter_row + filter_x * output_depth + oc_start;
+              if (depth_multiplier == 1) {
+                for (int c = 0; c < oc_count; ++c) {
+                  acc_buffer[c] += (filter_ptr[c] + filter_offset) *
+                                   (input_ptr[c] + input_offset);
+                }
+              } else {
+                for (int ic = 0; ic < ic_count; ++ic) {
+                  const int32_t input_val = input_ptr[ic] + input_offset;
+                  int32_t* acc = acc_buffer + ic * depth_multiplier;
+                  const uint8_t* filter_vals =
+                      filter_ptr + ic * depth_multiplier;
+                  for (int m = 0; m < depth_multiplier; ++m) {
+                    acc[m] += (filter_vals[m] + filter_offset) * input_val;
+                  }
+                }
+              }
+            }
+          }
+
+          for (int c = 0; c < oc_count; ++c) {
+            int32_t acc = reference_ops::depthwise_conv::DepthwiseConvRound<
+                DepthwiseConvOutputRounding::kAwayFromZero>(
+                acc_buffer[c], output_multiplier, output_shift);
+            acc += output_offset;
+            acc = std::max(acc, output_activation_min);
+            acc = std::min(acc, output_activation_max);
+            output_ptr[oc_start + c] = static_cast<uint8_t>(acc);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace optimized_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_DEPTHWISECONV_UINT8_H_
@@ -0,0 +1,183 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
+
+#include <algorithm>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/gemm.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+// Returns true when the filter is 1x1 with unit stride and no padding. The
+// NHWC input then already is the GEMM left-hand side and ConvPerChannel needs
+// no im2col buffer.
+inline bool ConvIsPointwise(const ConvParams& params,
+                            const RuntimeShape& filter_shape) {
+  return filter_shape.Dims(1) == 1 && filter_shape.Dims(2) == 1 &&
+         params.stride_width == 1 && params.stride_height == 1 &&
+         params.padding_values.width == 0 && params.padding_values.height == 0;
+}
+
+// Returns the number of output rows whose im2col patches fit in max_bytes,
+// clamped to [1, output height]. ConvPerChannel processes the output in bands
+// of that many rows, which bounds the scratch memory for large images.
+inline int ConvIm2colRows(const RuntimeShape& input_shape,
+                          const RuntimeShape& filter_shape,
+                          const RuntimeShape& output_shape, int max_bytes) {
+  const int patch_size =
+      filter_shape.Dims(1) * filter_shape.Dims(2) * input_shape.Dims(3);
+  const int row_bytes = output_shape.Dims(2) * patch_size;
+  return std::max(1, std::min(output_shape.Dims(1), max_bytes / row_bytes));
+}
+
+// Expands output rows [out_y_start, out_y_start + out_y_count) of one batch
+// into im2col_data, one filter patch (filter_y, filter_x, in_channel order,
+// matching the OHWI filter layout) per output pixel. Taps falling into the
+// padding are filled with the input zero point so they contribute nothing.
+template <typename T>
+inline void Im2col(const ConvParams& params, const RuntimeShape& input_shape,
+                   const T* input_data, int filter_height, int filter_width,
+                   int out_y_start, int out_y_count, int output_width,
+                   T* im2col_data) {
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const T zero_point = static_cast<T>(-params.input_offset);
+  T* dst = im2col_data;
+  for (int out_y = out_y_start; out_y < out_y_start + out_y_count; ++out_y) {
+    const int in_y_origin =
+        (out_y * params.stride_height) - params.padding_values.height;
+    for (int out_x = 0; out_x < output_width; ++out_x) {
+      const int in_x_origin =
+          (out_x * params.stride_width) - params.padding_values.width;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y) {
+        const int in_y =
+            in_y_origin + params.dilation_height_factor * filter_y;
+        const bool row_inside = (in_y >= 0) && (in_y < input_height);
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x) {
+          const int in_x =
+              in_x_origin + params.dilation_width_factor * filter_x;
+          if (row_inside && (in_x >= 0) && (in_x < input_width)) {
+            std::memcpy(dst,
+                        input_data + (in_y * input_width + in_x) * input_depth,
+                        input_depth * sizeof(T));
+          } else {
+            std::memset(dst, zero_point, input_depth);
+          }
+          dst += input_depth;
+        }
+      }
+    }
+  }
+}
+
+// GEMM-based per-channel int8 convolution, or uint8 convolution with a
+// per-tensor filter zero point (params.weights_offset) whose multiplier and
+// shift are repeated for every channel. 1x1 stride-1 convolutions run the
+// GEMM directly on the input (im2col_data must be nullptr); all others expand
+// bands of im2col_shape.Dims(1) output rows into im2col_data first, where
+// im2col_shape is {1, band rows, output width, filter patch size}. If
+// packed_filter is given it is filter_data packed by PackFilter(), with the
+// effective_bias it computed, and is read instead of filter_data and
+// bias_data. Padding taps hold the input zero point, whose products cancel
+// against the folded offset, so this also holds for padded convolutions.
+// Results are bit-exact with reference_integer_ops::ConvPerChannel (int8) and
+// reference_ops::Conv (uint8).
+template <typename T>
+inline void ConvPerChannel(
+    const ConvParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const T* input_data, const RuntimeShape& filter_shape,
+    const T* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape, T* output_data,
+    const RuntimeShape& im2col_shape, T* im2col_data,
+    const T* packed_filter = nullptr,
+    const int32_t* effective_bias = nullptr) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  if (bias_data) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  }
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int patch_size = filter_height * filter_width * input_depth;
+
+  gemm::GemmParams gemm_params;
+  gemm_params.input_offset = params.input_offset;
+  gemm_params.weights_offset = params.weights_offset;
+  gemm_params.output_offset = params.output_offset;
+  gemm_params.output_activation_min = params.quantized_activation_min;
+  gemm_params.output_activation_max = params.quantized_activation_max;
+  gemm_params.output_multiplier = output_multiplier;
+  gemm_params.output_shift = output_shift;
+  gemm_params.bias = bias_data;
+  gemm_params.effective_bias = effective_bias;
+  TFLITE_DCHECK((packed_filter == nullptr) == (effective_bias == nullptr));
+  // Runs one GEMM of rows x patch_size by the filter.
+  auto gemm = [&](const T* lhs, int rows, int depth, T* output) {
+    if (packed_filter != nullptr) {
+      GemmPerChannelPacked(gemm_params, lhs, rows, depth, packed_filter,
+                           output_depth, output);
+    } else {
+      GemmPerChannel(gemm_params, lhs, rows, depth, filter_data, output_depth,
+                     output);
+    }
+  };
+
+  for (int batch = 0; batch < batches; ++batch) {
+    const T* input_batch =
+        input_data + batch * input_height * input_width * input_depth;
+    T* output_batch =
+        output_data + Offset(output_shape, batch, 0, 0, 0);
+    if (im2col_data == nullptr) {
+      TFLITE_DCHECK(ConvIsPointwise(params, filter_shape));
+      gemm(input_batch, output_height * output_width, input_depth,
+           output_batch);
+      continue;
+    }
+
+    TFLITE_DCHECK_EQ(im2col_shape.Dims(2), output_width);
+    TFLITE_DCHECK_EQ(im2col_shape.Dims(3), patch_size);
+    const int band_rows = im2col_shape.Dims(1);
+    for (int out_y = 0; out_y < output_height; out_y += band_rows) {
+      const int rows = std::min(band_rows, output_height - out_y);
+      Im2col(params, input_shape, input_batch, filter_height, filter_width,
+             out_y, rows, output_width, im2col_data);
+      gemm(im2col_data, rows * output_width, patch_size,
+           output_batch + out_y * output_width * output_depth);
+    }
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_CONV_H_
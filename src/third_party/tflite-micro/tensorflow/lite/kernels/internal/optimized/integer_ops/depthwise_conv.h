@@ -0,0 +1,512 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+#define TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
+
+#include <algorithm>
+#include <type_traits>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/optimized/depthwiseconv_uint8.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+// The Neon paths below are keyed on the compiler's __ARM_NEON rather than on
+// USE_NEON, which would also switch internal/common.h to its Neon code.
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace tflite {
+namespace optimized_integer_ops {
+namespace depthwise_conv {
+
+// Packed 3x3 filter layout (see Pack3x3Filter()): channels are grouped by
+// kPackedChannels, and each group holds the kPackedChannels values of the
+// nine taps one after the other, in filter_y, filter_x order. Only whole
+// groups are packed; the channels left over are read from the filter.
+//
+// int8 filters are packed as they are. uint8 filters are packed with the
+// weights offset added, as int16 values, so that the packed taps of both
+// types are the signed filter values the accumulators multiply by.
+//
+// The packed filter comes with an effective bias for every channel,
+// bias[c] + input_offset * sum of the nine packed taps of c. Full windows
+// start from it and accumulate plain input x packed tap products; border
+// windows, where some taps fall into the padding, keep the bias and the
+// offsets.
+constexpr int kPackedChannels = 8;
+constexpr int kPackedGroupSize = 3 * 3 * kPackedChannels;
+
+template <typename T>
+struct PackedFilterType {
+  using type = int8_t;
+};
+
+template <>
+struct PackedFilterType<uint8_t> {
+  using type = int16_t;
+};
+
+// Requantizes an accumulator the way the reference kernel for T does.
+template <typename T>
+inline int32_t Requantize(int32_t acc, int32_t multiplier, int shift) {
+  return MultiplyByQuantizedMultiplier(acc, multiplier, shift);
+}
+
+template <>
+inline int32_t Requantize<uint8_t>(int32_t acc, int32_t multiplier,
+                                   int shift) {
+  return reference_ops::depthwise_conv::DepthwiseConvRound<
+      DepthwiseConvOutputRounding::kAwayFromZero>(acc, multiplier, shift);
+}
+
+// Adds the products of the nine taps of one packed group to the
+// kPackedChannels accumulators at acc. input_ptr points at the first channel
+// of the group in the top-left tap.
+#if defined(__ARM_NEON)
+inline void AccumulatePackedGroup(const int8_t* input_ptr, int input_row_size,
+                                  int depth, const int8_t* group,
+                                  int32_t* acc) {
+  int32x4_t acc_lo = vld1q_s32(acc);
+  int32x4_t acc_hi = vld1q_s32(acc + 4);
+  for (int tap = 0; tap < 9; ++tap) {
+    const int8_t* input_tap =
+        input_ptr + (tap / 3) * input_row_size + (tap % 3) * depth;
+    // int8 x int8 products fit in 16 bits.
+    const int16x8_t products = vmull_s8(
+        vld1_s8(input_tap), vld1_s8(group + tap * kPackedChannels));
+    acc_lo = vaddw_s16(acc_lo, vget_low_s16(products));
+    acc_hi = vaddw_s16(acc_hi, vget_high_s16(products));
+  }
+  vst1q_s32(acc, acc_lo);
+  vst1q_s32(acc + 4, acc_hi);
+}
+
+inline void AccumulatePackedGroup(const uint8_t* input_ptr,
+                                  int input_row_size, int depth,
+                                  const int16_t* group, int32_t* acc) {
+  int32x4_t acc_lo = vld1q_s32(acc);
+  int32x4_t acc_hi = vld1q_s32(acc + 4);
+  for (int tap = 0; tap < 9; ++tap) {
+    const uint8_t* input_tap =
+        input_ptr + (tap / 3) * input_row_size + (tap % 3) * depth;
+    // uint8 inputs fit in int16 lanes; the products need 32 bits.
+    const int16x8_t input_vec =
+        vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input_tap)));
+    const int16x8_t filter_vec = vld1q_s16(group + tap * kPackedChannels);
+    acc_lo = vmlal_s16(acc_lo, vget_low_s16(input_vec),
+                       vget_low_s16(filter_vec));
+    acc_hi = vmlal_s16(acc_hi, vget_high_s16(input_vec),
+                       vget_high_s16(filter_vec));
+  }
+  vst1q_s32(acc, acc_lo);
+  vst1q_s32(acc + 4, acc_hi);
+}
+#else
+template <typename T, typename PackedT>
+inline void AccumulatePackedGroup(const T* input_ptr, int input_row_size,
+                                  int depth, const PackedT* group,
+                                  int32_t* acc) {
+  int32_t sums[kPackedChannels];
+  for (int i = 0; i < kPackedChannels; ++i) {
+    sums[i] = acc[i];
+  }
+  for (int tap = 0; tap < 9; ++tap) {
+    const T* input_tap =
+        input_ptr + (tap / 3) * input_row_size + (tap % 3) * depth;
+    const PackedT* filter_tap = group + tap * kPackedChannels;
+    for (int i = 0; i < kPackedChannels; ++i) {
+      sums[i] += input_tap[i] * filter_tap[i];
+    }
+  }
+  for (int i = 0; i < kPackedChannels; ++i) {
+    acc[i] = sums[i];
+  }
+}
+#endif  // defined(__ARM_NEON)
+
+// Accumulates the input x packed tap products of a full 3x3 window (no
+// padding, no dilation, depth multiplier 1) from a packed filter,
+// kPackedChannels channels at a time, into acc, which holds the effective
+// bias. input_ptr points at the first channel of the top-left tap and
+// packed_filter at the group of that channel. Returns the number of channels
+// processed; the remaining (count % kPackedChannels) channels are left to
+// the caller.
+template <typename T, typename PackedT>
+inline int Accumulate3x3Packed(const T* input_ptr, int input_row_size,
+                               int depth, const PackedT* packed_filter,
+                               int count, int32_t* acc) {
+  int c = 0;
+  for (; c <= count - kPackedChannels;
+       c += kPackedChannels, packed_filter += kPackedGroupSize) {
+    AccumulatePackedGroup(input_ptr + c, input_row_size, depth, packed_filter,
+                          acc + c);
+  }
+  return c;
+}
+
+#if defined(__ARM_NEON)
+// Accumulates a full 3x3 window (no padding, no dilation, depth multiplier 1)
+// eight channels at a time. input_ptr and filter_ptr point at the first
+// channel of the top-left tap. Returns the number of channels processed; the
+// remaining (count % 8) channels are left to the caller. int8 filters are
+// symmetric, so filter_offset is 0.
+inline int Accumulate3x3Neon(const int8_t* input_ptr, int input_row_size,
+                             int depth, const int8_t* filter_ptr, int count,
+                             int32_t input_offset, int32_t filter_offset,
+                             int32_t* acc) {
+  TFLITE_DCHECK_EQ(filter_offset, 0);
+  // input_offset is the negated int8 zero point, so input + offset always
+  // fits in 16 bits and the products can use the widening vmlal_s16.
+  const int16x8_t input_offset_vec =
+      vdupq_n_s16(static_cast<int16_t>(input_offset));
+  const int filter_row_size = 3 * depth;
+  int c = 0;
+  for (; c <= count - 8; c += 8) {
+    int32x4_t acc_lo = vld1q_s32(acc + c);
+    int32x4_t acc_hi = vld1q_s32(acc + c + 4);
+    for (int filter_y = 0; filter_y < 3; ++filter_y) {
+      const int8_t* input_row = input_ptr + filter_y * input_row_size + c;
+      const int8_t* filter_row = filter_ptr + filter_y * filter_row_size + c;
+      for (int filter_x = 0; filter_x < 3; ++filter_x) {
+        const int16x8_t input_vec = vaddq_s16(
+            vmovl_s8(vld1_s8(input_row + filter_x * depth)), input_offset_vec);
+        const int16x8_t filter_vec =
+            vmovl_s8(vld1_s8(filter_row + filter_x * depth));
+        acc_lo = vmlal_s16(acc_lo, vget_low_s16(input_vec),
+                           vget_low_s16(filter_vec));
+        acc_hi = vmlal_s16(acc_hi, vget_high_s16(input_vec),
+                           vget_high_s16(filter_vec));
+      }
+    }
+    vst1q_s32(acc + c, acc_lo);
+    vst1q_s32(acc + c + 4, acc_hi);
+  }
+  return c;
+}
+
+// uint8 version: both offsets are the negated zero points in [-255, 0], so
+// input + input_offset and filter + filter_offset fit in 16 bits as well.
+inline int Accumulate3x3Neon(const uint8_t* input_ptr, int input_row_size,
+                             int depth, const uint8_t* filter_ptr, int count,
+                             int32_t input_offset, int32_t filter_offset,
+                             int32_t* acc) {
+  const int16x8_t input_offset_vec =
+      vdupq_n_s16(static_cast<int16_t>(input_offset));
+  const int16x8_t filter_offset_vec =
+      vdupq_n_s16(static_cast<int16_t>(filter_offset));
+  const int filter_row_size = 3 * depth;
+  int c = 0;
+  for (; c <= count - 8; c += 8) {
+    int32x4_t acc_lo = vld1q_s32(acc + c);
+    int32x4_t acc_hi = vld1q_s32(acc + c + 4);
+    for (int filter_y = 0; filter_y < 3; ++filter_y) {
+      const uint8_t* input_row = input_ptr + filter_y * input_row_size + c;
+      const uint8_t* filter_row = filter_ptr + filter_y * filter_row_size + c;
+      for (int filter_x = 0; filter_x < 3; ++filter_x) {
+        const int16x8_t input_vec = vaddq_s16(
+            vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input_row +
+                                                   filter_x * depth))),
+            input_offset_vec);
+        const int16x8_t filter_vec = vaddq_s16(
+            vreinterpretq_s16_u16(vmovl_u8(vld1_u8(filter_row +
+                                                   filter_x * depth))),
+            filter_offset_vec);
+        acc_lo = vmlal_s16(acc_lo, vget_low_s16(input_vec),
+                           vget_low_s16(filter_vec));
+        acc_hi = vmlal_s16(acc_hi, vget_high_s16(input_vec),
+                           vget_high_s16(filter_vec));
+      }
+    }
+    vst1q_s32(acc + c, acc_lo);
+    vst1q_s32(acc + c + 4, acc_hi);
+  }
+  return c;
+}
+#endif  // defined(__ARM_NEON)
+
+// Shared body of the generic and 3x3 kernels, for int8 or uint8 T. When
+// kIs3x3 is set the filter is known to be 3x3 with depth multiplier 1, no
+// dilation and stride kStride, which lets the compiler fold the loop bounds
+// and, with Neon, lets interior pixels use Accumulate3x3Neon.
+template <bool kIs3x3, int kStride, typename T>
+inline void DepthwiseConvPerChannelImpl(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const T* input_data, const RuntimeShape& filter_shape,
+    const T* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    T* output_data, const typename PackedFilterType<T>::type* packed_filter,
+    const int32_t* effective_bias) {
+  const int stride_width = kIs3x3 ? kStride : params.stride_width;
+  const int stride_height = kIs3x3 ? kStride : params.stride_height;
+  const int dilation_width_factor =
+      kIs3x3 ? 1 : params.dilation_width_factor;
+  const int dilation_height_factor =
+      kIs3x3 ? 1 : params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = kIs3x3 ? 1 : params.depth_multiplier;
+  const int32_t input_offset = params.input_offset;
+  // int8 filters are symmetric.
+  const int32_t filter_offset =
+      std::is_same<T, uint8_t>::value ? params.weights_offset : 0;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  // Check dimensions of the tensors.
+  TFLITE_DCHECK_EQ(input_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(filter_shape.DimensionsCount(), 4);
+  TFLITE_DCHECK_EQ(output_shape.DimensionsCount(), 4);
+
+  TFLITE_DCHECK_LE(output_activation_min, output_activation_max);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int output_depth = MatchingDim(filter_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = kIs3x3 ? 3 : filter_shape.Dims(1);
+  const int filter_width = kIs3x3 ? 3 : filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  TFLITE_DCHECK_EQ(output_depth, input_depth * depth_multiplier);
+  TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  TFLITE_DCHECK_LE(depth_multiplier,
+                   optimized_ops::depthwise_conv::kAccBufferMaxSize);
+
+  const int input_block_depth =
+      optimized_ops::depthwise_conv::kAccBufferMaxSize / depth_multiplier;
+  const int input_row_size = input_width * input_depth;
+  const int filter_row_size = filter_width * output_depth;
+  int32_t acc_buffer[optimized_ops::depthwise_conv::kAccBufferMaxSize];
+
+  for (int batch = 0; batch < batches; ++batch) {
+    const T* input_batch = input_data + batch * input_height * input_row_size;
+    for (int out_y = 0; out_y < output_height; ++out_y) {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      int filter_y_start, filter_y_end;
+      optimized_ops::depthwise_conv::GetFilterTapRange(
+          in_y_origin, dilation_height_factor, filter_height, input_height,
+          &filter_y_start, &filter_y_end);
+      for (int out_x = 0; out_x < output_width; ++out_x) {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        int filter_x_start, filter_x_end;
+        optimized_ops::depthwise_conv::GetFilterTapRange(
+            in_x_origin, dilation_width_factor, filter_width, input_width,
+            &filter_x_start, &filter_x_end);
+        T* output_ptr =
+            output_data + Offset(output_shape, batch, out_y, out_x, 0);
+
+        for (int ic_start = 0; ic_start < input_depth;
+             ic_start += input_block_depth) {
+          const int ic_count =
+              std::min(input_block_depth, input_depth - ic_start);
+          const int oc_start = ic_start * depth_multiplier;
+          const int oc_count = ic_count * depth_multiplier;
+
+          const bool full_window = kIs3x3 && filter_y_start == 0 &&
+                                   filter_y_end == 3 && filter_x_start == 0 &&
+                                   filter_x_end == 3;
+          // With the input offset folded into the bias, the taps below add
+          // products of plain inputs.
+          const bool folded = full_window && packed_filter != nullptr;
+          const int32_t tap_offset = folded ? 0 : input_offset;
+          if (folded) {
+            std::copy(effective_bias + oc_start,
+                      effective_bias + oc_start + oc_count, acc_buffer);
+          } else if (bias_data) {
+            for (int c = 0; c < oc_count; ++c) {
+              acc_buffer[c] = bias_data[oc_start + c];
+            }
+          } else {
+            std::fill(acc_buffer, acc_buffer + oc_count, 0);
+          }
+
+          // Channels [0, vector_count) of this block are already accumulated
+          // by the vector path; the scalar loops below finish the rest.
+          int vector_count = 0;
+          if (full_window) {
+            const T* window = input_batch + in_y_origin * input_row_size +
+                              in_x_origin * input_depth + ic_start;
+            if (folded) {
+              vector_count = Accumulate3x3Packed(
+                  window, input_row_size, input_depth,
+                  packed_filter +
+                      (oc_start / kPackedChannels) * kPackedGroupSize,
+                  oc_count, acc_buffer);
+            }
+#if defined(__ARM_NEON)
+            else {
+              vector_count =
+                  Accumulate3x3Neon(window, input_row_size, input_depth,
+                                    filter_data + oc_start, oc_count,
+                                    input_offset, filter_offset, acc_buffer);
+            }
+#endif  // defined(__ARM_NEON)
+          }
+
+          if (vector_count < oc_count) {
+            for (int filter_y = filter_y_start; filter_y < filter_y_end;
+                 ++filter_y) {
+              const int in_y = in_y_origin + dilation_height_factor * filter_y;
+              const T* input_row = input_batch + in_y * input_row_size;
+              const T* filter_row = filter_data + filter_y * filter_row_size;
+              for (int filter_x = filter_x_start; filter_x < filter_x_end;
+                   ++filter_x) {
+                const int in_x =
+                    in_x_origin + dilation_width_factor * filter_x;
+                const T* input_ptr = input_row + in_x * input_depth + ic_start;
+                const T* filter_ptr =
+                    filter_row + filter_x * output_depth + oc_start;
+                if (depth_multiplier == 1) {
+                  for (int c = vector_count; c < oc_count; ++c) {
+                    acc_buffer[c] += (filter_ptr[c] + filter_offset) *
+                                     (input_ptr[c] + tap_offset);
+                  }
+                } else {
+                  for (int ic = 0; ic < ic_count; ++ic) {
+                    const int32_t input_val = input_ptr[ic] + tap_offset;
+                    int32_t* acc = acc_buffer + ic * depth_multiplier;
+                    const T* filter_vals = filter_ptr + ic * depth_multiplier;
+                    for (int m = 0; m < depth_multiplier; ++m) {
+                      acc[m] += (filter_vals[m] + filter_offset) * input_val;
+                    }
+                  }
+                }
+              }
+            }
+          }
+
+          for (int c = 0; c < oc_count; ++c) {
+            const int output_channel = oc_start + c;
+            int32_t acc = Requantize<T>(acc_buffer[c],
+                                        output_multiplier[output_channel],
+                                        output_shift[output_channel]);
+            acc += output_offset;
+            acc = std::max(acc, output_activation_min);
+            acc = std::min(acc, output_activation_max);
+            output_ptr[output_channel] = static_cast<T>(acc);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace depthwise_conv
+
+// Same semantics and results as reference_integer_ops::DepthwiseConvPerChannel
+// for any filter size, stride, dilation and depth multiplier. Padding bounds
+// are resolved once per output pixel instead of once per MAC.
+inline void DepthwiseConvPerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const int8_t* input_data, const RuntimeShape& filter_shape,
+    const int8_t* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    int8_t* output_data) {
+  depthwise_conv::DepthwiseConvPerChannelImpl</*kIs3x3=*/false,
+                                              /*kStride=*/0>(
+      params, output_multiplier, output_shift, input_shape, input_data,
+      filter_shape, filter_data, bias_shape, bias_data, output_shape,
+      output_data, /*packed_filter=*/nullptr, /*effective_bias=*/nullptr);
+}
+
+// Returns true if DepthwiseConv3x3PerChannel<stride> can be used for params
+// and filter_shape.
+inline bool DepthwiseConv3x3FilterSupported(const DepthwiseParams& params,
+                                            const RuntimeShape& filter_shape,
+                                            int stride) {
+  return filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3 &&
+         params.depth_multiplier == 1 && params.dilation_width_factor == 1 &&
+         params.dilation_height_factor == 1 &&
+         params.stride_width == stride && params.stride_height == stride;
+}
+
+// 3x3 depthwise convolution with depth multiplier 1, no dilation and equal
+// horizontal/vertical stride kStride (1 or 2), the shapes MobileNet uses, for
+// int8 or uint8 T. uint8 layers take their per-tensor output multiplier and
+// shift repeated for every channel. Interior pixels read the filter packed by
+// Pack3x3Filter() if packed_filter is given (with the effective_bias it
+// computed for bias_data and the offsets in params), and otherwise use Neon
+// when available; border pixels and non-Neon builds use the portable path.
+// Bit-exact with reference_integer_ops::DepthwiseConvPerChannel (int8) and
+// reference_ops::DepthwiseConv (uint8).
+template <int kStride, typename T>
+inline void DepthwiseConv3x3PerChannel(
+    const DepthwiseParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& input_shape,
+    const T* input_data, const RuntimeShape& filter_shape,
+    const T* filter_data, const RuntimeShape& bias_shape,
+    const int32_t* bias_data, const RuntimeShape& output_shape,
+    T* output_data,
+    const typename depthwise_conv::PackedFilterType<T>::type* packed_filter =
+        nullptr,
+    const int32_t* effective_bias = nullptr) {
+  static_assert(kStride == 1 || kStride == 2, "Only stride 1 and 2.");
+  TFLITE_DCHECK(DepthwiseConv3x3FilterSupported(params, filter_shape, kStride));
+  TFLITE_DCHECK((packed_filter == nullptr) == (effective_bias == nullptr));
+  depthwise_conv::DepthwiseConvPerChannelImpl</*kIs3x3=*/true, kStride>(
+      params, output_multiplier, output_shift, input_shape, input_data,
+      filter_shape, filter_data, bias_shape, bias_data, output_shape,
+      output_data, packed_filter, effective_bias);
+}
+
+// Size of the packed copy of a 3x3 depthwise filter of depth channels of
+// type T made by Pack3x3Filter().
+template <typename T>
+inline size_t Packed3x3FilterBytes(int depth) {
+  return static_cast<size_t>(depth / depthwise_conv::kPackedChannels) *
+         depthwise_conv::kPackedGroupSize *
+         sizeof(typename depthwise_conv::PackedFilterType<T>::type);
+}
+
+// Packs the whole channel groups of a 1x3x3xdepth int8 or uint8 filter for
+// DepthwiseConv3x3PerChannel(), with weights_offset added to every tap (0 for
+// int8), and stores bias[c] + input_offset * (sum of the nine packed taps of
+// channel c) in effective_bias (depth entries; bias may be nullptr). Meant to
+// run once, when the kernel is prepared.
+template <typename T>
+inline void Pack3x3Filter(
+    const T* filter, int depth, const int32_t* bias, int32_t input_offset,
+    int32_t weights_offset,
+    typename depthwise_conv::PackedFilterType<T>::type* packed,
+    int32_t* effective_bias) {
+  using depthwise_conv::kPackedChannels;
+  using PackedT = typename depthwise_conv::PackedFilterType<T>::type;
+  const int packed_depth = depth / kPackedChannels * kPackedChannels;
+  for (int c = 0; c < packed_depth; c += kPackedChannels) {
+    for (int tap = 0; tap < 9; ++tap) {
+      for (int i = 0; i < kPackedChannels; ++i) {
+        *packed++ =
+            static_cast<PackedT>(filter[tap * depth + c + i] + weights_offset);
+      }
+    }
+  }
+  for (int c = 0; c < depth; ++c) {
+    int32_t sum = 0;
+    for (int tap = 0; tap < 9; ++tap) {
+      sum += filter[tap * depth + c] + weights_offset;
+    }
+    effective_bias[c] = (bias ? bias[c] : 0) + input_offset * sum;
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_DEPTHWISE_CONV_H_
@@ -0,0 +1,116 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
+#define TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/gemm.h"
+#include "tensorflow/lite/kernels/internal/types.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+
+namespace fully_connected {
+
+// Number of rows (batches) and output channels of a fully connected layer
+// whose output has the channels in its last dimension.
+inline void GetGemmShape(const RuntimeShape& filter_shape,
+                         const RuntimeShape& output_shape, int* batches,
+                         int* output_depth, int* accum_depth) {
+  TFLITE_DCHECK_GE(filter_shape.DimensionsCount(), 2);
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int output_dim_count = output_shape.DimensionsCount();
+  *batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  *output_depth = output_shape.Dims(output_dim_count - 1);
+  TFLITE_DCHECK_LE(*output_depth, filter_shape.Dims(filter_dim_count - 2));
+  *accum_depth = filter_shape.Dims(filter_dim_count - 1);
+}
+
+inline gemm::GemmParams GetGemmParams(const FullyConnectedParams& params,
+                                      const int32_t* output_multiplier,
+                                      const int32_t* output_shift,
+                                      const int32_t* bias,
+                                      const int32_t* effective_bias) {
+  TFLITE_DCHECK_LE(params.quantized_activation_min,
+                   params.quantized_activation_max);
+  gemm::GemmParams gemm_params;
+  gemm_params.input_offset = params.input_offset;
+  gemm_params.weights_offset = params.weights_offset;
+  gemm_params.output_offset = params.output_offset;
+  gemm_params.output_activation_min = params.quantized_activation_min;
+  gemm_params.output_activation_max = params.quantized_activation_max;
+  gemm_params.output_multiplier = output_multiplier;
+  gemm_params.output_shift = output_shift;
+  gemm_params.bias = bias;
+  gemm_params.effective_bias = effective_bias;
+  return gemm_params;
+}
+
+}  // namespace fully_connected
+
+// int8 or uint8 fully connected layer on the GEMM. output_multiplier and
+// output_shift hold one entry per output channel, all equal to the
+// per-tensor values in params. Bit-exact with
+// reference_integer_ops::FullyConnected (int8) and
+// reference_ops::FullyConnected (uint8).
+template <typename T>
+inline void FullyConnected(const FullyConnectedParams& params,
+                           const int32_t* output_multiplier,
+                           const int32_t* output_shift,
+                           const RuntimeShape& /*input_shape*/,
+                           const T* input_data,
+                           const RuntimeShape& filter_shape,
+                           const T* filter_data,
+                           const RuntimeShape& bias_shape,
+                           const int32_t* bias_data,
+                           const RuntimeShape& output_shape, T* output_data) {
+  int batches, output_depth, accum_depth;
+  fully_connected::GetGemmShape(filter_shape, output_shape, &batches,
+                                &output_depth, &accum_depth);
+  if (bias_data) {
+    TFLITE_DCHECK_EQ(bias_shape.FlatSize(), output_depth);
+  }
+  GemmPerChannel(fully_connected::GetGemmParams(params, output_multiplier,
+                                                output_shift, bias_data,
+                                                /*effective_bias=*/nullptr),
+                 input_data, batches, accum_depth, filter_data, output_depth,
+                 output_data);
+}
+
+// FullyConnected() on a weight matrix packed by PackFilter(), with the
+// effective_bias it computed from the layer's bias, input offset and
+// weights offset. Same results.
+template <typename T>
+inline void FullyConnectedPacked(
+    const FullyConnectedParams& params, const int32_t* output_multiplier,
+    const int32_t* output_shift, const RuntimeShape& /*input_shape*/,
+    const T* input_data, const RuntimeShape& filter_shape,
+    const T* packed_filter, const int32_t* effective_bias,
+    const RuntimeShape& output_shape, T* output_data) {
+  int batches, output_depth, accum_depth;
+  fully_connected::GetGemmShape(filter_shape, output_shape, &batches,
+                                &output_depth, &accum_depth);
+  GemmPerChannelPacked(
+      fully_connected::GetGemmParams(params, output_multiplier, output_shift,
+                                     /*bias=*/nullptr, effective_bias),
+      input_data, batches, accum_depth, packed_filter, output_depth,
+      output_data);
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_INTERNAL_OPTIMIZED_INTEGER_OPS_FULLY_CONNECTED_H_
@@ -0,0 +1,369 @@
+/* Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_GEMM_H_
+#define TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_GEMM_H_
+
+#include <algorithm>
+
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+
+namespace tflite {
+namespace optimized_integer_ops {
+namespace gemm {
+
+// Register tile: each micro-kernel call produces kRowTile x kColTile
+// accumulators (rows are LHS rows, e.g. output pixels; columns are filter
+// rows, i.e. output channels).
+constexpr int kRowTile = 2;
+constexpr int kColTile = 4;
+
+// Cache blocking. A block of filter rows of about kFilterBlockBytes is reused
+// across all LHS rows, and LHS rows are walked kRowBlock at a time so that
+// they stay in L1 while the filter block is swept.
+constexpr int kFilterBlockBytes = 16 * 1024;
+constexpr int kRowBlock = 16;
+
+// Packed filter layout (see PackFilter()): output channels are grouped into
+// panels of kColTile, and the depth of a panel into groups of kDepthTile
+// values that hold kDepthTile consecutive values of every channel of the
+// panel, i.e. packed[panel][k / kDepthTile][c % kColTile][k % kDepthTile].
+// The depth is padded with zeros to a multiple of kDepthTile and the last
+// panel with zero channels, so each panel is one contiguous stream read front
+// to back by the micro-kernel.
+//
+// A packed filter comes with an effective bias that has the input offset
+// folded in, bias[c] + input_offset * sum_k (filter[c][k] + weights_offset),
+// so that the micro-kernel only computes plain 8-bit x 8-bit dot products.
+// Asymmetric (uint8) filters add weights_offset * sum_k lhs[r][k] per LHS
+// row, computed once per row block.
+constexpr int kDepthTile = 4;
+
+// Quantization and output parameters shared by all tiles of one GEMM.
+struct GemmParams {
+  int32_t input_offset;
+  // 0 for symmetric int8 filters; the negated filter zero point for uint8.
+  int32_t weights_offset;
+  int32_t output_offset;
+  int32_t output_activation_min;
+  int32_t output_activation_max;
+  const int32_t* output_multiplier;
+  const int32_t* output_shift;
+  const int32_t* bias;
+  // Bias with the input offset folded in, made by PackFilter(); used instead
+  // of bias and input_offset with a packed filter.
+  const int32_t* effective_bias;
+};
+
+inline int PackedDepth(int depth) {
+  return (depth + kDepthTile - 1) / kDepthTile * kDepthTile;
+}
+
+inline int PackedPanels(int cols) { return (cols + kColTile - 1) / kColTile; }
+
+// Computes a kRows x kCols tile of int32 dot products over depth:
+//   acc[r][c] = sum_k (lhs[r][k] + input_offset) *
+//               (filter[c][k] + weights_offset)
+template <typename T, int kRows, int kCols>
+inline void MicroKernel(const T* lhs, const T* filter, int depth,
+                        int32_t input_offset, int32_t weights_offset,
+                        int32_t acc[kRows][kCols]) {
+  for (int r = 0; r < kRows; ++r) {
+    for (int c = 0; c < kCols; ++c) {
+      acc[r][c] = 0;
+    }
+  }
+  for (int k = 0; k < depth; ++k) {
+    int32_t lhs_vals[kRows];
+    for (int r = 0; r < kRows; ++r) {
+      lhs_vals[r] = lhs[r * depth + k] + input_offset;
+    }
+    for (int c = 0; c < kCols; ++c) {
+      const int32_t filter_val = filter[c * depth + k] + weights_offset;
+      for (int r = 0; r < kRows; ++r) {
+        acc[r][c] += lhs_vals[r] * filter_val;
+      }
+    }
+  }
+}
+
+// Computes a kRows x kColTile tile of int32 dot products over depth, reading
+// one panel of a packed filter:
+//   acc[r][c] = sum_k lhs[r][k] * filter[c][k]
+// The offsets are left out; see GemmParams::effective_bias.
+template <typename T, int kRows>
+inline void PackedMicroKernel(const T* lhs, const T* panel,
+                              int depth, int32_t acc[kRows][kColTile]) {
+  for (int r = 0; r < kRows; ++r) {
+    for (int c = 0; c < kColTile; ++c) {
+      acc[r][c] = 0;
+    }
+  }
+  int k = 0;
+  for (; k + kDepthTile <= depth; k += kDepthTile) {
+    for (int r = 0; r < kRows; ++r) {
+      const T* lhs_vals = lhs + r * depth + k;
+      for (int c = 0; c < kColTile; ++c) {
+        const T* filter_vals = panel + c * kDepthTile;
+        int32_t sum = 0;
+        for (int j = 0; j < kDepthTile; ++j) {
+          sum += lhs_vals[j] * filter_vals[j];
+        }
+        acc[r][c] += sum;
+      }
+    }
+    panel += kColTile * kDepthTile;
+  }
+  // The padding of the last depth group is zero in the filter, but lhs rows
+  // end at depth.
+  for (int j = 0; k + j < depth; ++j) {
+    for (int r = 0; r < kRows; ++r) {
+      const int32_t lhs_val = lhs[r * depth + k + j];
+      for (int c = 0; c < kColTile; ++c) {
+        acc[r][c] += lhs_val * panel[c * kDepthTile + j];
+      }
+    }
+  }
+}
+
+// Requantizes with the per-channel multiplier/shift and clamps one biased
+// accumulator of output channel channel.
+template <typename T>
+inline T Requantize(const GemmParams& params, int channel,
+                         int32_t value) {
+  value = MultiplyByQuantizedMultiplier(value,
+                                        params.output_multiplier[channel],
+                                        params.output_shift[channel]);
+  value += params.output_offset;
+  value = std::max(value, params.output_activation_min);
+  value = std::min(value, params.output_activation_max);
+  return static_cast<T>(value);
+}
+
+// Requantizes and stores a kRows x kCols tile. output points at (row, col) of
+// a row-major matrix whose rows are output_stride apart.
+template <typename T, int kRows, int kCols>
+inline void StoreTile(const GemmParams& params, int col,
+                      const int32_t acc[kRows][kCols], T* output,
+                      int output_stride) {
+  for (int r = 0; r < kRows; ++r) {
+    for (int c = 0; c < kCols; ++c) {
+      const int32_t bias = params.bias ? params.bias[col + c] : 0;
+      output[r * output_stride + c] =
+          Requantize<T>(params, col + c, acc[r][c] + bias);
+    }
+  }
+}
+
+// Same for a tile computed from a packed filter panel, of which only the
+// first cols channels exist, adding the effective bias and the weights offset
+// term row_offsets[r] of each row.
+template <typename T, int kRows>
+inline void StorePackedTile(const GemmParams& params, int col, int cols,
+                            const int32_t acc[kRows][kColTile],
+                            const int32_t* row_offsets, T* output,
+                            int output_stride) {
+  for (int r = 0; r < kRows; ++r) {
+    for (int c = 0; c < cols; ++c) {
+      const int channel = col + c;
+      output[r * output_stride + c] = Requantize<T>(
+          params, channel,
+          acc[r][c] + params.effective_bias[channel] + row_offsets[r]);
+    }
+  }
+}
+
+template <typename T, int kRows, int kCols>
+inline void RunTile(const GemmParams& params, const T* lhs, const T* filter,
+                    int depth, int col, T* output, int output_stride) {
+  int32_t acc[kRows][kCols];
+  MicroKernel<T, kRows, kCols>(lhs, filter, depth, params.input_offset,
+                               params.weights_offset, acc);
+  StoreTile<T, kRows, kCols>(params, col, acc, output, output_stride);
+}
+
+template <typename T, int kRows>
+inline void RunPackedTile(const GemmParams& params, const T* lhs,
+                          const T* panel, int depth, int col, int cols,
+                          const int32_t* row_offsets, T* output,
+                          int output_stride) {
+  int32_t acc[kRows][kColTile];
+  PackedMicroKernel<T, kRows>(lhs, panel, depth, acc);
+  StorePackedTile<T, kRows>(params, col, cols, acc, row_offsets, output,
+                            output_stride);
+}
+
+// Stores weights_offset * sum_k lhs[r][k] for rows [0, rows) in row_offsets,
+// or zeros for symmetric filters.
+template <typename T>
+inline void ComputeRowOffsets(const GemmParams& params, const T* lhs,
+                              int rows, int depth, int32_t* row_offsets) {
+  for (int r = 0; r < rows; ++r) {
+    int32_t sum = 0;
+    if (params.weights_offset != 0) {
+      for (int k = 0; k < depth; ++k) {
+        sum += lhs[r * depth + k];
+      }
+    }
+    row_offsets[r] = params.weights_offset * sum;
+  }
+}
+
+}  // namespace gemm
+
+// int8 or uint8 GEMM with fused per-channel requantization:
+//   output[r][c] = clamp(requant(bias[c] + sum_k (lhs[r][k] + input_offset) *
+//                                (filter[c][k] + weights_offset)))
+// lhs is rows x depth and filter is cols x depth, both row-major, so that
+// filter can be a TFLite OHWI conv filter or an FC weight matrix as-is.
+// output is rows x cols with a row stride of cols. Results are bit-exact with
+// the reference per-channel int8 conv kernel, and with the uint8 reference
+// conv and fully connected kernels when every channel holds their per-tensor
+// multiplier and shift.
+template <typename T>
+inline void GemmPerChannel(const gemm::GemmParams& params, const T* lhs,
+                           int rows, int depth, const T* filter, int cols,
+                           T* output) {
+  using gemm::kColTile;
+  using gemm::kRowTile;
+  const int col_block =
+      std::max(kColTile, (gemm::kFilterBlockBytes / std::max(depth, 1)) /
+                             kColTile * kColTile);
+
+  for (int col_start = 0; col_start < cols; col_start += col_block) {
+    const int col_end = std::min(cols, col_start + col_block);
+    for (int row_start = 0; row_start < rows; row_start += gemm::kRowBlock) {
+      const int row_end = std::min(rows, row_start + gemm::kRowBlock);
+      int col = col_start;
+      for (; col + kColTile <= col_end; col += kColTile) {
+        const T* filter_tile = filter + col * depth;
+        int row = row_start;
+        for (; row + kRowTile <= row_end; row += kRowTile) {
+          gemm::RunTile<T, kRowTile, kColTile>(
+              params, lhs + row * depth, filter_tile, depth, col,
+              output + row * cols + col, cols);
+        }
+        for (; row < row_end; ++row) {
+          gemm::RunTile<T, 1, kColTile>(params, lhs + row * depth,
+                                        filter_tile, depth, col,
+                                        output + row * cols + col, cols);
+        }
+      }
+      for (; col < col_end; ++col) {
+        const T* filter_tile = filter + col * depth;
+        int row = row_start;
+        for (; row + kRowTile <= row_end; row += kRowTile) {
+          gemm::RunTile<T, kRowTile, 1>(params, lhs + row * depth,
+                                        filter_tile, depth, col,
+                                        output + row * cols + col, cols);
+        }
+        for (; row < row_end; ++row) {
+          gemm::RunTile<T, 1, 1>(params, lhs + row * depth, filter_tile,
+                                 depth, col, output + row * cols + col, cols);
+        }
+      }
+    }
+  }
+}
+
+// Size of the packed copy of a cols x depth filter made by PackFilter().
+inline size_t PackedFilterBytes(int cols, int depth) {
+  return static_cast<size_t>(gemm::PackedPanels(cols)) * gemm::kColTile *
+         gemm::PackedDepth(depth);
+}
+
+// Packs a row-major cols x depth filter (a TFLite OHWI conv filter or an FC
+// weight matrix) into the layout GemmPerChannelPacked() reads, and stores
+// bias[c] + input_offset * sum_k (filter[c][k] + weights_offset) in
+// effective_bias (cols entries; bias may be nullptr). Meant to run once, when
+// the kernel is prepared.
+template <typename T>
+inline void PackFilter(const T* filter, int cols, int depth,
+                       const int32_t* bias, int32_t input_offset,
+                       int32_t weights_offset, T* packed,
+                       int32_t* effective_bias) {
+  using gemm::kColTile;
+  using gemm::kDepthTile;
+  const int packed_depth = gemm::PackedDepth(depth);
+  for (int panel = 0; panel < gemm::PackedPanels(cols); ++panel) {
+    T* dst = packed + panel * kColTile * packed_depth;
+    for (int k = 0; k < packed_depth; k += kDepthTile) {
+      for (int c = 0; c < kColTile; ++c) {
+        const int col = panel * kColTile + c;
+        for (int j = 0; j < kDepthTile; ++j) {
+          *dst++ = (col < cols && k + j < depth)
+                       ? filter[col * depth + k + j]
+                       : static_cast<T>(0);
+        }
+      }
+    }
+  }
+  for (int col = 0; col < cols; ++col) {
+    int32_t sum = 0;
+    for (int k = 0; k < depth; ++k) {
+      sum += filter[col * depth + k] + weights_offset;
+    }
+    effective_bias[col] = (bias ? bias[col] : 0) + input_offset * sum;
+  }
+}
+
+// GemmPerChannel() on a filter packed by PackFilter(); params.effective_bias
+// must be the one PackFilter() computed for params.bias, params.input_offset
+// and params.weights_offset, of which only the last is read. Same results.
+template <typename T>
+inline void GemmPerChannelPacked(const gemm::GemmParams& params, const T* lhs,
+                                 int rows, int depth, const T* packed_filter,
+                                 int cols, T* output) {
+  using gemm::kColTile;
+  using gemm::kRowTile;
+  const int panel_bytes = kColTile * gemm::PackedDepth(depth);
+  const int panels = gemm::PackedPanels(cols);
+  const int panel_block =
+      std::max(1, gemm::kFilterBlockBytes / std::max(panel_bytes, 1));
+  int32_t row_offsets[gemm::kRowBlock];
+
+  for (int panel_start = 0; panel_start < panels;
+       panel_start += panel_block) {
+    const int panel_end = std::min(panels, panel_start + panel_block);
+    for (int row_start = 0; row_start < rows; row_start += gemm::kRowBlock) {
+      const int row_end = std::min(rows, row_start + gemm::kRowBlock);
+      gemm::ComputeRowOffsets(params, lhs + row_start * depth,
+                              row_end - row_start, depth, row_offsets);
+      for (int panel = panel_start; panel < panel_end; ++panel) {
+        const T* panel_data = packed_filter + panel * panel_bytes;
+        const int col = panel * kColTile;
+        const int panel_cols = std::min(kColTile, cols - col);
+        int row = row_start;
+        for (; row + kRowTile <= row_end; row += kRowTile) {
+          gemm::RunPackedTile<T, kRowTile>(
+              params, lhs + row * depth, panel_data, depth, col, panel_cols,
+              row_offsets + (row - row_start), output + row * cols + col,
+              cols);
+        }
+        for (; row < row_end; ++row) {
+          gemm::RunPackedTile<T, 1>(params, lhs + row * depth, panel_data,
+                                    depth, col, panel_cols,
+                                    row_offsets + (row - row_start),
+                                    output + row * cols + col, cols);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace optimized_integer_ops
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_KERNELS_INTERNAL_OPTIMIZED_INTEGER_OPS_GEMM_H_
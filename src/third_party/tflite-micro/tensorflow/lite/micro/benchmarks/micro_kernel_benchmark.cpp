@@ -0,0 +1,285 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.h"
+
+#include <cstdarg>
+#include <cstring>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_arena_constants.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_string.h"
+
+namespace tflite {
+
+KernelBenchmarkRunner::KernelBenchmarkRunner(uint8_t* arena,
+                                             size_t arena_size)
+    : arena_(arena), arena_size_(arena_size) {
+  Reset();
+}
+
+KernelBenchmarkRunner::~KernelBenchmarkRunner() { Reset(); }
+
+void KernelBenchmarkRunner::Reset() {
+  if (initialized_ && registration_.free != nullptr) {
+    registration_.free(&context_, node_.user_data);
+  }
+  initialized_ = false;
+  registration_ = {};
+  node_ = {};
+
+  context_ = {};
+  context_.impl_ = this;
+  context_.tensors = tensors_;
+  context_.AllocatePersistentBuffer = AllocatePersistentBuffer;
+  context_.RequestScratchBufferInArena = RequestScratchBufferInArena;
+  context_.GetScratchBuffer = GetScratchBuffer;
+  context_.GetTensor = GetTensor;
+  context_.GetEvalTensor = GetEvalTensor;
+  context_.ReportError = ReportError;
+
+  tensors_count_ = 0;
+  scratch_buffers_count_ = 0;
+  arena_used_ = 0;
+  out_of_memory_ = false;
+}
+
+void* KernelBenchmarkRunner::Allocate(size_t bytes) {
+  uint8_t* start = AlignPointerUp(arena_ + arena_used_,
+                                  MicroArenaBufferAlignment());
+  const size_t offset = static_cast<size_t>(start - arena_);
+  if (offset > arena_size_ || bytes > arena_size_ - offset) {
+    out_of_memory_ = true;
+    return nullptr;
+  }
+  arena_used_ = offset + bytes;
+  return start;
+}
+
+TfLiteIntArray* KernelBenchmarkRunner::AllocateIntArray(const int* data,
+                                                        int size) {
+  TfLiteIntArray* array = static_cast<TfLiteIntArray*>(
+      Allocate(TfLiteIntArrayGetSizeInBytes(size)));
+  if (array == nullptr) {
+    return nullptr;
+  }
+  array->size = size;
+  for (int i = 0; i < size; ++i) {
+    array->data[i] = (data != nullptr) ? data[i] : 0;
+  }
+  return array;
+}
+
+int KernelBenchmarkRunner::AddTensor(TfLiteType type, const int* dims,
+                                     int dims_count, float scale,
+                                     int zero_point) {
+  return AddTensorInternal(type, dims, dims_count, scale, zero_point,
+                           /*channels=*/1, /*quantized_dimension=*/0);
+}
+
+int KernelBenchmarkRunner::AddPerChannelTensor(TfLiteType type,
+                                               const int* dims, int dims_count,
+                                               float scale,
+                                               int quantized_dimension) {
+  TFLITE_DCHECK(quantized_dimension < dims_count);
+  return AddTensorInternal(type, dims, dims_count, scale, /*zero_point=*/0,
+                           dims[quantized_dimension], quantized_dimension);
+}
+
+int KernelBenchmarkRunner::AddTensorInternal(TfLiteType type, const int* dims,
+                                             int dims_count, float scale,
+                                             int zero_point, int channels,
+                                             int quantized_dimension) {
+  if (tensors_count_ >= kMaxTensors) {
+    MicroPrintf("KernelBenchmarkRunner supports at most %d tensors.",
+                kMaxTensors);
+    return -1;
+  }
+  size_t type_size;
+  if (TfLiteTypeSizeOf(type, &type_size) != kTfLiteOk) {
+    MicroPrintf("Type %s (%d) not supported.", TfLiteTypeGetName(type), type);
+    return -1;
+  }
+  size_t bytes = type_size;
+  for (int i = 0; i < dims_count; ++i) {
+    bytes *= dims[i];
+  }
+
+  TfLiteTensor& tensor = tensors_[tensors_count_];
+  tensor = {};
+  tensor.type = type;
+  tensor.bytes = bytes;
+  tensor.allocation_type = kTfLiteArenaRw;
+  tensor.dims = AllocateIntArray(dims, dims_count);
+  tensor.data.data = Allocate(bytes);
+  if (tensor.dims == nullptr || tensor.data.data == nullptr) {
+    return -1;
+  }
+
+  if (type != kTfLiteFloat32) {
+    tensor.params.scale = scale;
+    tensor.params.zero_point = zero_point;
+    TfLiteAffineQuantization* quantization =
+        static_cast<TfLiteAffineQuantization*>(
+            Allocate(sizeof(TfLiteAffineQuantization)));
+    TfLiteFloatArray* scales = static_cast<TfLiteFloatArray*>(
+        Allocate(TfLiteFloatArrayGetSizeInBytes(channels)));
+    TfLiteIntArray* zero_points = AllocateIntArray(nullptr, channels);
+    if (quantization == nullptr || scales == nullptr ||
+        zero_points == nullptr) {
+      return -1;
+    }
+    scales->size = channels;
+    for (int i = 0; i < channels; ++i) {
+      scales->data[i] = scale;
+      zero_points->data[i] = zero_point;
+    }
+    quantization->scale = scales;
+    quantization->zero_point = zero_points;
+    quantization->quantized_dimension = quantized_dimension;
+    tensor.quantization.type = kTfLiteAffineQuantization;
+    tensor.quantization.params = quantization;
+  }
+
+  TfLiteEvalTensor& eval_tensor = eval_tensors_[tensors_count_];
+  eval_tensor.data = tensor.data;
+  eval_tensor.dims = tensor.dims;
+  eval_tensor.type = type;
+
+  context_.tensors_size = ++tensors_count_;
+  return tensors_count_ - 1;
+}
+
+size_t KernelBenchmarkRunner::tensor_bytes() const {
+  size_t bytes = 0;
+  for (int i = 0; i < tensors_count_; ++i) {
+    bytes += tensors_[i].bytes;
+  }
+  return bytes;
+}
+
+TfLiteStatus KernelBenchmarkRunner::InitAndPrepare(
+    const TfLiteRegistration& registration, const int* inputs,
+    int inputs_size, const int* outputs, int outputs_size, void* builtin_data,
+    const void* init_data, size_t init_data_size) {
+  TFLITE_DCHECK(!initialized_);
+  registration_ = registration;
+  node_.inputs = AllocateIntArray(inputs, inputs_size);
+  node_.outputs = AllocateIntArray(outputs, outputs_size);
+  node_.builtin_data = builtin_data;
+  node_.custom_initial_data = init_data;
+  node_.custom_initial_data_size = static_cast<int>(init_data_size);
+  if (node_.inputs == nullptr || node_.outputs == nullptr) {
+    return kTfLiteError;
+  }
+
+  if (registration_.init != nullptr) {
+    // Builtin kernels get the builtin data through the node; the buffer
+    // argument only carries custom op options.
+    node_.user_data = registration_.init(
+        &context_, static_cast<const char*>(init_data), init_data_size);
+  }
+  initialized_ = true;
+  if (registration_.prepare != nullptr) {
+    return registration_.prepare(&context_, &node_);
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus KernelBenchmarkRunner::Invoke() {
+  TFLITE_DCHECK(initialized_);
+  return registration_.invoke(&context_, &node_);
+}
+
+TfLiteStatus KernelBenchmarkRunner::TimeInvoke(MicroProfiler* profiler,
+                                               const char* tag,
+                                               int min_iterations,
+                                               int32_t min_ticks,
+                                               int* iterations) {
+  profiler->ClearEvents();
+  *iterations = 0;
+  while (*iterations < kMaxIterations &&
+         (*iterations < min_iterations ||
+          profiler->GetTotalTicks() < min_ticks)) {
+    const uint32_t event_handle = profiler->BeginEvent(tag);
+    const TfLiteStatus status = Invoke();
+    profiler->EndEvent(event_handle);
+    ++*iterations;
+    if (status != kTfLiteOk) {
+      return status;
+    }
+  }
+  return kTfLiteOk;
+}
+
+void* KernelBenchmarkRunner::AllocatePersistentBuffer(TfLiteContext* context,
+                                                      size_t bytes) {
+  return static_cast<KernelBenchmarkRunner*>(context->impl_)->Allocate(bytes);
+}
+
+TfLiteStatus KernelBenchmarkRunner::RequestScratchBufferInArena(
+    TfLiteContext* context, size_t bytes, int* buffer_index) {
+  KernelBenchmarkRunner* runner =
+      static_cast<KernelBenchmarkRunner*>(context->impl_);
+  if (runner->scratch_buffers_count_ >= kMaxScratchBuffers) {
+    MicroPrintf("KernelBenchmarkRunner supports at most %d scratch buffers.",
+                kMaxScratchBuffers);
+    return kTfLiteError;
+  }
+  // There is only one node, so scratch buffers are simply never shared.
+  void* buffer = runner->Allocate(bytes);
+  if (buffer == nullptr) {
+    return kTfLiteError;
+  }
+  *buffer_index = runner->scratch_buffers_count_;
+  runner->scratch_buffers_[runner->scratch_buffers_count_++] = buffer;
+  return kTfLiteOk;
+}
+
+void* KernelBenchmarkRunner::GetScratchBuffer(TfLiteContext* context,
+                                              int buffer_index) {
+  KernelBenchmarkRunner* runner =
+      static_cast<KernelBenchmarkRunner*>(context->impl_);
+  if (buffer_index < 0 || buffer_index >= runner->scratch_buffers_count_) {
+    return nullptr;
+  }
+  return runner->scratch_buffers_[buffer_index];
+}
+
+TfLiteTensor* KernelBenchmarkRunner::GetTensor(const TfLiteContext* context,
+                                               int tensor_index) {
+  return &static_cast<KernelBenchmarkRunner*>(context->impl_)
+              ->tensors_[tensor_index];
+}
+
+TfLiteEvalTensor* KernelBenchmarkRunner::GetEvalTensor(
+    const TfLiteContext* context, int tensor_index) {
+  return &static_cast<KernelBenchmarkRunner*>(context->impl_)
+              ->eval_tensors_[tensor_index];
+}
+
+void KernelBenchmarkRunner::ReportError(TfLiteContext* context,
+                                        const char* format, ...) {
+  char message[128];
+  va_list args;
+  va_start(args, format);
+  MicroVsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+  MicroPrintf("%s", message);
+}
+
+}  // namespace tflite
@@ -0,0 +1,130 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_KERNEL_BENCHMARK_H_
+#define TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_KERNEL_BENCHMARK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+
+namespace tflite {
+
+// Runs a single kernel in isolation, without a model or an interpreter, so
+// that it can be timed at arbitrary tensor shapes. Tensor data, quantization
+// parameters and all persistent and scratch buffers requested by the kernel
+// are carved out of the caller-provided arena; Reset() gives it all back.
+//
+// Only the TfLiteContext callbacks used by builtin kernels are provided
+// (AllocatePersistentBuffer, RequestScratchBufferInArena, GetScratchBuffer,
+// GetTensor, GetEvalTensor and ReportError). Kernels that need a MicroContext
+// (resource variables, control flow) cannot be run this way.
+class KernelBenchmarkRunner {
+ public:
+  static constexpr int kMaxTensors = 8;
+  static constexpr int kMaxScratchBuffers = 16;
+
+  KernelBenchmarkRunner(uint8_t* arena, size_t arena_size);
+  ~KernelBenchmarkRunner();
+
+  // Frees the prepared kernel, if any, and discards all tensors and buffers.
+  void Reset();
+
+  // Adds a tensor of the given type and shape with per-tensor quantization
+  // (ignored for float tensors). Returns its index, or -1 if there are no
+  // tensor slots or arena memory left; see out_of_memory().
+  int AddTensor(TfLiteType type, const int* dims, int dims_count,
+                float scale = 0.0f, int zero_point = 0);
+
+  // Adds a tensor with per-channel quantization along quantized_dimension,
+  // using the same scale and a zero point of 0 for every channel.
+  int AddPerChannelTensor(TfLiteType type, const int* dims, int dims_count,
+                          float scale, int quantized_dimension);
+
+  TfLiteTensor* tensor(int index) { return &tensors_[index]; }
+
+  // Sum of the data sizes of all tensors, i.e. the compulsory memory traffic
+  // of one invocation.
+  size_t tensor_bytes() const;
+
+  // True once an allocation failed because the arena is too small.
+  bool out_of_memory() const { return out_of_memory_; }
+
+  // Builds a node reading the inputs and writing the outputs (indices as
+  // returned by AddTensor) and runs the init and prepare functions of
+  // registration on it. builtin_data and init_data must outlive the runner.
+  // Only one node can be prepared at a time.
+  TfLiteStatus InitAndPrepare(const TfLiteRegistration& registration,
+                              const int* inputs, int inputs_size,
+                              const int* outputs, int outputs_size,
+                              void* builtin_data,
+                              const void* init_data = nullptr,
+                              size_t init_data_size = 0);
+
+  // Runs the invoke function of the prepared kernel once.
+  TfLiteStatus Invoke();
+
+  // Invokes the kernel at least min_iterations times and until min_ticks
+  // timer ticks have been recorded in profiler, one event per invocation.
+  // The profiler is cleared first, so that afterwards GetTotalTicks() divided
+  // by *iterations is the average time of one invocation.
+  TfLiteStatus TimeInvoke(MicroProfiler* profiler, const char* tag,
+                          int min_iterations, int32_t min_ticks,
+                          int* iterations);
+
+ private:
+  // Maximum number of events MicroProfiler keeps without overwriting.
+  static constexpr int kMaxIterations = 1000;
+
+  void* Allocate(size_t bytes);
+  TfLiteIntArray* AllocateIntArray(const int* data, int size);
+  int AddTensorInternal(TfLiteType type, const int* dims, int dims_count,
+                        float scale, int zero_point, int channels,
+                        int quantized_dimension);
+
+  static void* AllocatePersistentBuffer(TfLiteContext* context, size_t bytes);
+  static TfLiteStatus RequestScratchBufferInArena(TfLiteContext* context,
+                                                  size_t bytes,
+                                                  int* buffer_index);
+  static void* GetScratchBuffer(TfLiteContext* context, int buffer_index);
+  static TfLiteTensor* GetTensor(const TfLiteContext* context,
+                                 int tensor_index);
+  static TfLiteEvalTensor* GetEvalTensor(const TfLiteContext* context,
+                                         int tensor_index);
+  static void ReportError(TfLiteContext* context, const char* format, ...);
+
+  uint8_t* const arena_;
+  const size_t arena_size_;
+  size_t arena_used_ = 0;
+  bool out_of_memory_ = false;
+
+  TfLiteContext context_ = {};
+  TfLiteNode node_ = {};
+  TfLiteRegistration registration_ = {};
+  bool initialized_ = false;
+
+  TfLiteTensor tensors_[kMaxTensors] = {};
+  TfLiteEvalTensor eval_tensors_[kMaxTensors] = {};
+  int tensors_count_ = 0;
+
+  void* scratch_buffers_[kMaxScratchBuffers] = {};
+  int scratch_buffers_count_ = 0;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_BENCHMARKS_MICRO_KERNEL_BENCHMARK_H_
@@ -0,0 +1,670 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/benchmarks/ssd_kernel_benchmark.h"
+
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/benchmarks/micro_kernel_benchmark.h"
+#include "tensorflow/lite/micro/kernels/conv.h"
+#include "tensorflow/lite/micro/kernels/fully_connected.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+#include "tensorflow/lite/micro/kernels/softmax.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/micro/micro_string.h"
+#include "tensorflow/lite/micro/micro_time.h"
+
+namespace tflite {
+namespace {
+
+// Quantization of the benchmark tensors. The values only need to give valid
+// requantization multipliers; they do not affect the amount of work.
+constexpr float kInputScale = 0.02f;
+constexpr float kFilterScale = 0.005f;
+constexpr float kOutputScale = 0.1f;
+
+// SSD MobileNetV1 300x300 layers. All convolutions use SAME padding and all
+// feature maps are square. Layers with identical shapes (Conv2d_7 to
+// Conv2d_11) are benchmarked once. The extra feature layers and the box and
+// class predictors follow the TF object detection API naming.
+struct ConvLayer {
+  const char* name;
+  int input_size;
+  int input_depth;
+  int filter_size;
+  int stride;
+  int output_depth;
+};
+
+constexpr ConvLayer kConvLayers[] = {
+    {"Conv2d_0", 300, 3, 3, 2, 32},
+    {"Conv2d_1_pointwise", 150, 32, 1, 1, 64},
+    {"Conv2d_2_pointwise", 75, 64, 1, 1, 128},
+    {"Conv2d_3_pointwise", 75, 128, 1, 1, 128},
+    {"Conv2d_4_pointwise", 38, 128, 1, 1, 256},
+    {"Conv2d_5_pointwise", 38, 256, 1, 1, 256},
+    {"Conv2d_6_pointwise", 19, 256, 1, 1, 512},
+    {"Conv2d_7-11_pointwise", 19, 512, 1, 1, 512},
+    {"Conv2d_12_pointwise", 10, 512, 1, 1, 1024},
+    {"Conv2d_13_pointwise", 10, 1024, 1, 1, 1024},
+    {"Conv2d_13_1_Conv2d_2_1x1_256", 10, 1024, 1, 1, 256},
+    {"Conv2d_13_2_Conv2d_2_3x3_s2_512", 10, 256, 3, 2, 512},
+    {"Conv2d_13_1_Conv2d_3_1x1_128", 5, 512, 1, 1, 128},
+    {"Conv2d_13_2_Conv2d_3_3x3_s2_256", 5, 128, 3, 2, 256},
+    {"Conv2d_13_1_Conv2d_4_1x1_128", 3, 256, 1, 1, 128},
+    {"Conv2d_13_2_Conv2d_4_3x3_s2_256", 3, 128, 3, 2, 256},
+    {"Conv2d_13_1_Conv2d_5_1x1_64", 2, 256, 1, 1, 64},
+    {"Conv2d_13_2_Conv2d_5_3x3_s2_128", 2, 64, 3, 2, 128},
+    {"BoxPredictor_0_BoxEncoding", 19, 512, 1, 1, 3 * 4},
+    {"BoxPredictor_0_ClassPredictor", 19, 512, 1, 1, 3 * 91},
+    {"BoxPredictor_1_BoxEncoding", 10, 1024, 1, 1, 6 * 4},
+    {"BoxPredictor_1_ClassPredictor", 10, 1024, 1, 1, 6 * 91},
+    {"BoxPredictor_2_BoxEncoding", 5, 512, 1, 1, 6 * 4},
+    {"BoxPredictor_2_ClassPredictor", 5, 512, 1, 1, 6 * 91},
+    {"BoxPredictor_3_BoxEncoding", 3, 256, 1, 1, 6 * 4},
+    {"BoxPredictor_3_ClassPredictor", 3, 256, 1, 1, 6 * 91},
+    {"BoxPredictor_4_BoxEncoding", 2, 256, 1, 1, 6 * 4},
+    {"BoxPredictor_4_ClassPredictor", 2, 256, 1, 1, 6 * 91},
+    {"BoxPredictor_5_BoxEncoding", 1, 128, 1, 1, 6 * 4},
+    {"BoxPredictor_5_ClassPredictor", 1, 128, 1, 1, 6 * 91},
+};
+
+// 3x3 depthwise convolutions with a depth multiplier of 1.
+struct DepthwiseLayer {
+  const char* name;
+  int input_size;
+  int depth;
+  int stride;
+};
+
+constexpr DepthwiseLayer kDepthwiseLayers[] = {
+    {"Conv2d_1_depthwise", 150, 32, 1},
+    {"Conv2d_2_depthwise", 150, 64, 2},
+    {"Conv2d_3_depthwise", 75, 128, 1},
+    {"Conv2d_4_depthwise", 75, 128, 2},
+    {"Conv2d_5_depthwise", 38, 256, 1},
+    {"Conv2d_6_depthwise", 38, 256, 2},
+    {"Conv2d_7-11_depthwise", 19, 512, 1},
+    {"Conv2d_12_depthwise", 19, 512, 2},
+    {"Conv2d_13_depthwise", 10, 1024, 1},
+};
+
+// Anchors over all six feature maps and classes including background.
+constexpr int kNumBoxes = 1917;
+constexpr int kNumClasses = 91;
+
+// Custom options of TFLite_Detection_PostProcess as exported for SSD
+// MobileNetV1 (flexbuffer map): max_detections 10,
+// max_classes_per_detection 1, detections_per_class 100, use_regular_nms
+// false, nms_score_threshold 1e-8, nms_iou_threshold 0.6, num_classes 90,
+// y_scale 10, x_scale 10, h_scale 5, w_scale 5.
+alignas(4) constexpr uint8_t kDetectionPostprocessOptions[] = {
+    0x6d, 0x61, 0x78, 0x5f, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x00, 0x6d, 0x61, 0x78, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x73,
+    0x65, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x64, 0x65, 0x74, 0x65, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x00, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x5f, 0x70, 0x65, 0x72, 0x5f, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x00, 0x75, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61,
+    0x72, 0x5f, 0x6e, 0x6d, 0x73, 0x00, 0x6e, 0x6d, 0x73, 0x5f, 0x73, 0x63,
+    0x6f, 0x72, 0x65, 0x5f, 0x74, 0x68, 0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c,
+    0x64, 0x00, 0x6e, 0x6d, 0x73, 0x5f, 0x69, 0x6f, 0x75, 0x5f, 0x74, 0x68,
+    0x72, 0x65, 0x73, 0x68, 0x6f, 0x6c, 0x64, 0x00, 0x6e, 0x75, 0x6d, 0x5f,
+    0x63, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x00, 0x79, 0x5f, 0x73, 0x63,
+    0x61, 0x6c, 0x65, 0x00, 0x78, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x00,
+    0x68, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x00, 0x77, 0x5f, 0x73, 0x63,
+    0x61, 0x6c, 0x65, 0x00, 0x0b, 0x78, 0x12, 0x94, 0xa4, 0x43, 0x58, 0x33,
+    0x6a, 0x11, 0x22, 0x2b, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0b, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x40,
+    0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x9a, 0x99, 0x19, 0x3f,
+    0x77, 0xcc, 0x2b, 0x32, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x20, 0x41,
+    0x06, 0x0e, 0x06, 0x06, 0x0e, 0x0e, 0x06, 0x6a, 0x0e, 0x0e, 0x0e, 0x37,
+    0x26, 0x01,
+};
+
+// Types implemented by the kernels in this tree.
+constexpr TfLiteType kAllTypes[] = {kTfLiteUInt8, kTfLiteInt8, kTfLiteFloat32};
+constexpr TfLiteType kInt8AndFloatTypes[] = {kTfLiteInt8, kTfLiteFloat32};
+
+struct Row {
+  const char* op;
+  const char* layer;
+  TfLiteType type;
+  uint64_t macs;
+  uint64_t ops;
+};
+
+uint32_t Hundredths(uint64_t numerator, uint64_t denominator) {
+  return denominator == 0
+             ? 0
+             : static_cast<uint32_t>(numerator * 100 / denominator);
+}
+
+int SameOutputSize(int input_size, int stride) {
+  return (input_size + stride - 1) / stride;
+}
+
+// Zero point of quantized activations; 0 for float tensors.
+int ActivationZeroPoint(TfLiteType type) {
+  return type == kTfLiteUInt8 ? 128 : 0;
+}
+
+// Bias type matching the type of a conv or fully connected kernel.
+TfLiteType BiasType(TfLiteType type) {
+  return type == kTfLiteFloat32 ? kTfLiteFloat32 : kTfLiteInt32;
+}
+
+// Adds an int8/uint8 weight tensor, quantized per channel along
+// quantized_dimension for int8 as the converter does, or a float one. It is
+// marked constant, as weights in a model are, so that kernels pack it in
+// Prepare; FillInputs() must fill it before then.
+int AddWeights(KernelBenchmarkRunner* runner, TfLiteType type,
+               const int* dims, int dims_count, int quantized_dimension) {
+  const int index =
+      type == kTfLiteInt8
+          ? runner->AddPerChannelTensor(type, dims, dims_count, kFilterScale,
+                                        quantized_dimension)
+          : runner->AddTensor(type, dims, dims_count, kFilterScale,
+                              ActivationZeroPoint(type));
+  if (index >= 0) {
+    runner->tensor(index)->allocation_type = kTfLiteMmapRo;
+  }
+  return index;
+}
+
+// Adds the bias tensor matching AddWeights(), marked constant as well since
+// the kernels fold the input offset into it when they pack the weights.
+int AddBias(KernelBenchmarkRunner* runner, TfLiteType type, const int* dims) {
+  const int index =
+      runner->AddTensor(BiasType(type), dims, 1, kInputScale * kFilterScale);
+  if (index >= 0) {
+    runner->tensor(index)->allocation_type = kTfLiteMmapRo;
+  }
+  return index;
+}
+
+uint32_t NextRandom(uint32_t* seed) {
+  *seed = *seed * 1664525u + 1013904223u;
+  return *seed >> 8;
+}
+
+// Fills a tensor with pseudo-random values: floats in [-1, 1), int32 values
+// (biases) in [-1024, 1024) and random bytes otherwise.
+void FillRandom(TfLiteTensor* tensor, uint32_t* seed) {
+  switch (tensor->type) {
+    case kTfLiteFloat32: {
+      const size_t count = tensor->bytes / sizeof(float);
+      for (size_t i = 0; i < count; ++i) {
+        tensor->data.f[i] =
+            static_cast<float>(NextRandom(seed) & 0xffff) / 32768.0f - 1.0f;
+      }
+      break;
+    }
+    case kTfLiteInt32: {
+      const size_t count = tensor->bytes / sizeof(int32_t);
+      for (size_t i = 0; i < count; ++i) {
+        tensor->data.i32[i] = static_cast<int32_t>(NextRandom(seed) & 0x7ff) -
+                              1024;
+      }
+      break;
+    }
+    default:
+      for (size_t i = 0; i < tensor->bytes; ++i) {
+        tensor->data.uint8[i] = static_cast<uint8_t>(NextRandom(seed));
+      }
+      break;
+  }
+}
+
+void FillInputs(KernelBenchmarkRunner* runner, const int* inputs,
+                int inputs_size) {
+  uint32_t seed = 1;
+  for (int i = 0; i < inputs_size; ++i) {
+    FillRandom(runner->tensor(inputs[i]), &seed);
+  }
+}
+
+void LogStatus(const Row& row, const char* status) {
+  MicroPrintf("%s,%s,%s,%s", row.op, row.layer, TfLiteTypeGetName(row.type),
+              status);
+}
+
+void LogRow(const SsdKernelBenchmarkConfig& config, const Row& row,
+            size_t bytes, int32_t total_ticks, int iterations) {
+  const uint64_t timer_hz = ticks_per_second();
+  if (timer_hz == 0 || total_ticks <= 0) {
+    LogStatus(row, "no timer");
+    return;
+  }
+  const uint64_t ticks = static_cast<uint64_t>(total_ticks);
+  uint64_t cycles = ticks / iterations;
+  if (config.cpu_clock_hz != 0) {
+    cycles = ticks * config.cpu_clock_hz / (timer_hz * iterations);
+  }
+  if (cycles > UINT32_MAX) {
+    cycles = UINT32_MAX;
+  }
+  const uint32_t bytes_per_cycle = Hundredths(bytes, cycles);
+  // Hundredths of millions of ops per second.
+  const uint32_t mops = static_cast<uint32_t>(
+      row.ops * iterations * (timer_hz / 10000) / ticks);
+
+  char macs[32] = "";
+  if (row.macs != 0) {
+    const uint32_t macs_per_cycle = Hundredths(row.macs, cycles);
+    MicroSnprintf(macs, sizeof(macs), "%u,%u.%u%u",
+                  static_cast<uint32_t>(row.macs), macs_per_cycle / 100,
+                  (macs_per_cycle / 10) % 10, macs_per_cycle % 10);
+  } else {
+    MicroSnprintf(macs, sizeof(macs), ",");
+  }
+  MicroPrintf("%s,%s,%s,%d,%u,%s,%u,%u.%u%u,%u.%u%u", row.op, row.layer,
+              TfLiteTypeGetName(row.type), iterations,
+              static_cast<uint32_t>(cycles), macs,
+              static_cast<uint32_t>(bytes), bytes_per_cycle / 100,
+              (bytes_per_cycle / 10) % 10, bytes_per_cycle % 10, mops / 100,
+              (mops / 10) % 10, mops % 10);
+}
+
+// Prepares the node on the tensors already added to runner, times it and
+// prints its row. Returns 1 if the kernel failed, 0 otherwise; benchmarks
+// that do not fit into the arena are reported as skipped.
+int Run(const SsdKernelBenchmarkConfig& config, KernelBenchmarkRunner* runner,
+        const Row& row, const TfLiteRegistration& registration,
+        const int* inputs, int inputs_size, const int* outputs,
+        int outputs_size, void* builtin_data, const void* init_data = nullptr,
+        size_t init_data_size = 0) {
+  if (runner->out_of_memory()) {
+    LogStatus(row, "skipped: arena too small");
+    return 0;
+  }
+  if (runner->InitAndPrepare(registration, inputs, inputs_size, outputs,
+                             outputs_size, builtin_data, init_data,
+                             init_data_size) != kTfLiteOk) {
+    if (runner->out_of_memory()) {
+      LogStatus(row, "skipped: arena too small");
+      return 0;
+    }
+    LogStatus(row, "prepare failed");
+    return 1;
+  }
+
+  // Static to keep its event log off the stack.
+  static MicroProfiler profiler;
+  int iterations = 0;
+  // The first, untimed invocation warms up the caches.
+  if (runner->Invoke() != kTfLiteOk ||
+      runner->TimeInvoke(&profiler, row.layer, config.min_iterations,
+                         config.min_ticks, &iterations) != kTfLiteOk) {
+    LogStatus(row, "invoke failed");
+    return 1;
+  }
+  LogRow(config, row, runner->tensor_bytes(), profiler.GetTotalTicks(),
+         iterations);
+  return 0;
+}
+
+int BenchmarkConv(const SsdKernelBenchmarkConfig& config,
+                  const ConvLayer& layer, TfLiteType type) {
+  const int output_size = SameOutputSize(layer.input_size, layer.stride);
+  const int input_dims[] = {1, layer.input_size, layer.input_size,
+                            layer.input_depth};
+  const int filter_dims[] = {layer.output_depth, layer.filter_size,
+                             layer.filter_size, layer.input_depth};
+  const int bias_dims[] = {layer.output_depth};
+  const int output_dims[] = {1, output_size, output_size, layer.output_depth};
+
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {
+      runner.AddTensor(type, input_dims, 4, kInputScale,
+                       ActivationZeroPoint(type)),
+      AddWeights(&runner, type, filter_dims, 4, /*quantized_dimension=*/0),
+      AddBias(&runner, type, bias_dims),
+  };
+  const int outputs[] = {runner.AddTensor(type, output_dims, 4, kOutputScale,
+                                          ActivationZeroPoint(type))};
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 3);
+  }
+
+  TfLiteConvParams params = {kTfLitePaddingSame, layer.stride, layer.stride,
+                             kTfLiteActRelu6, 1, 1};
+  const uint64_t macs = static_cast<uint64_t>(output_size) * output_size *
+                        layer.output_depth * layer.filter_size *
+                        layer.filter_size * layer.input_depth;
+  const Row row = {"CONV_2D", layer.name, type, macs, 2 * macs};
+  return Run(config, &runner, row, Register_CONV_2D(), inputs, 3, outputs, 1,
+             &params);
+}
+
+int BenchmarkDepthwiseConv(const SsdKernelBenchmarkConfig& config,
+                           const DepthwiseLayer& layer, TfLiteType type) {
+  const int output_size = SameOutputSize(layer.input_size, layer.stride);
+  const int input_dims[] = {1, layer.input_size, layer.input_size,
+                            layer.depth};
+  const int filter_dims[] = {1, 3, 3, layer.depth};
+  const int bias_dims[] = {layer.depth};
+  const int output_dims[] = {1, output_size, output_size, layer.depth};
+
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {
+      runner.AddTensor(type, input_dims, 4, kInputScale,
+                       ActivationZeroPoint(type)),
+      AddWeights(&runner, type, filter_dims, 4, /*quantized_dimension=*/3),
+      AddBias(&runner, type, bias_dims),
+  };
+  const int outputs[] = {runner.AddTensor(type, output_dims, 4, kOutputScale,
+                                          ActivationZeroPoint(type))};
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 3);
+  }
+
+  TfLiteDepthwiseConvParams params = {kTfLitePaddingSame, layer.stride,
+                                      layer.stride, 1, kTfLiteActRelu6, 1, 1};
+  const uint64_t macs =
+      static_cast<uint64_t>(output_size) * output_size * layer.depth * 3 * 3;
+  const Row row = {"DEPTHWISE_CONV_2D", layer.name, type, macs, 2 * macs};
+  return Run(config, &runner, row, Register_DEPTHWISE_CONV_2D(), inputs, 3,
+             outputs, 1, &params);
+}
+
+int BenchmarkPool(const SsdKernelBenchmarkConfig& config, const char* op,
+                  const char* layer, const TfLiteRegistration& registration,
+                  int input_size, int depth, int filter_size, int stride,
+                  TfLitePadding padding, TfLiteType type) {
+  const int output_size =
+      padding == kTfLitePaddingSame
+          ? SameOutputSize(input_size, stride)
+          : (input_size - filter_size + stride) / stride;
+  const int input_dims[] = {1, input_size, input_size, depth};
+  const int output_dims[] = {1, output_size, output_size, depth};
+
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {runner.AddTensor(type, input_dims, 4, kInputScale,
+                                         ActivationZeroPoint(type))};
+  const int outputs[] = {runner.AddTensor(type, output_dims, 4, kInputScale,
+                                          ActivationZeroPoint(type))};
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 1);
+  }
+
+  TfLitePoolParams params = {padding,     stride,          stride,
+                             filter_size, filter_size,     kTfLiteActNone,
+                             {}};
+  const Row row = {op, layer, type, 0,
+                   static_cast<uint64_t>(output_size) * output_size * depth};
+  return Run(config, &runner, row, registration, inputs, 1, outputs, 1,
+             &params);
+}
+
+// Runs a one-input, one-output element-wise op on [1, kNumBoxes,
+// kNumClasses], the class predictions fed to the postprocessing. Quantized
+// outputs use the fixed [0, 1) range that SOFTMAX and LOGISTIC require.
+int BenchmarkClassActivation(const SsdKernelBenchmarkConfig& config,
+                             const char* op,
+                             const TfLiteRegistration& registration,
+                             void* builtin_data, TfLiteType type) {
+  const int dims[] = {1, kNumBoxes, kNumClasses};
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {runner.AddTensor(type, dims, 3, kOutputScale,
+                                         ActivationZeroPoint(type))};
+  const int outputs[] = {
+      runner.AddTensor(type, dims, 3, 1.0f / 256,
+                       type == kTfLiteInt8 ? -128 : 0)};
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 1);
+  }
+
+  const Row row = {op, "class_predictions", type, 0,
+                   static_cast<uint64_t>(kNumBoxes) * kNumClasses};
+  return Run(config, &runner, row, registration, inputs, 1, outputs, 1,
+             builtin_data);
+}
+
+int BenchmarkReshape(const SsdKernelBenchmarkConfig& config,
+                     const char* layer, int feature_size, int anchors,
+                     int values, TfLiteType type) {
+  const int input_dims[] = {1, feature_size, feature_size, anchors * values};
+  const int output_dims[] = {1, feature_size * feature_size * anchors,
+                             values};
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {runner.AddTensor(type, input_dims, 4, kOutputScale,
+                                         ActivationZeroPoint(type))};
+  const int outputs[] = {runner.AddTensor(type, output_dims, 3, kOutputScale,
+                                          ActivationZeroPoint(type))};
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 1);
+  }
+
+  const Row row = {"RESHAPE", layer, type, 0,
+                   static_cast<uint64_t>(feature_size) * feature_size *
+                       anchors * values};
+  return Run(config, &runner, row, tflite::ops::micro::Register_RESHAPE(),
+             inputs, 1, outputs, 1, nullptr);
+}
+
+}  // namespace
+
+void LogSsdKernelBenchmarkHeader() {
+  MicroPrintf(
+      "\"Op\",\"Layer\",\"Type\",\"Iterations\",\"Cycles\",\"MACs\","
+      "\"MACs/cycle\",\"Bytes\",\"Bytes/cycle\",\"MOPS\"");
+}
+
+int BenchmarkSsdConv2D(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (const ConvLayer& layer : kConvLayers) {
+    for (TfLiteType type : kAllTypes) {
+      failures += BenchmarkConv(config, layer, type);
+    }
+  }
+  return failures;
+}
+
+int BenchmarkSsdDepthwiseConv2D(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (const DepthwiseLayer& layer : kDepthwiseLayers) {
+    for (TfLiteType type : kAllTypes) {
+      failures += BenchmarkDepthwiseConv(config, layer, type);
+    }
+  }
+  return failures;
+}
+
+// The SSD head has no pooling; this is the global average pool of the
+// MobileNetV1 classifier over the last 10x10x1024 feature map.
+int BenchmarkSsdAveragePool2D(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (TfLiteType type : kInt8AndFloatTypes) {
+    failures += BenchmarkPool(config, "AVERAGE_POOL_2D", "AvgPool_1a",
+                              Register_AVERAGE_POOL_2D(), 10, 1024, 10, 1,
+                              kTfLitePaddingValid, type);
+  }
+  return failures;
+}
+
+// The SSD graph has no max pooling; this is a 2x2 stride-2 pool of the
+// 19x19x512 feature map.
+int BenchmarkSsdMaxPool2D(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (TfLiteType type : kInt8AndFloatTypes) {
+    failures += BenchmarkPool(config, "MAX_POOL_2D", "19x19x512",
+                              Register_MAX_POOL_2D(), 19, 512, 2, 2,
+                              kTfLitePaddingSame, type);
+  }
+  return failures;
+}
+
+int BenchmarkSsdSoftmax(const SsdKernelBenchmarkConfig& config) {
+  static TfLiteSoftmaxParams params = {1.0f};
+  int failures = 0;
+  for (TfLiteType type : kInt8AndFloatTypes) {
+    failures += BenchmarkClassActivation(config, "SOFTMAX", Register_SOFTMAX(),
+                                         &params, type);
+  }
+  return failures;
+}
+
+int BenchmarkSsdLogistic(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (TfLiteType type : kInt8AndFloatTypes) {
+    failures += BenchmarkClassActivation(config, "LOGISTIC",
+                                         Register_LOGISTIC(), nullptr, type);
+  }
+  return failures;
+}
+
+// The box and class predictor outputs of the largest feature map flattened
+// to [1, anchors, values] ahead of the concatenation.
+int BenchmarkSsdReshape(const SsdKernelBenchmarkConfig& config) {
+  int failures = 0;
+  for (TfLiteType type : kAllTypes) {
+    failures += BenchmarkReshape(config, "BoxPredictor_0_BoxEncoding", 19, 3,
+                                 4, type);
+    failures += BenchmarkReshape(config, "BoxPredictor_0_ClassPredictor", 19,
+                                 3, kNumClasses, type);
+  }
+  return failures;
+}
+
+// The SSD head has no fully connected layer; this is the 1001-way
+// MobileNetV1 classifier on the pooled 1024 features.
+int BenchmarkSsdFullyConnected(const SsdKernelBenchmarkConfig& config) {
+  constexpr int kDepth = 1024;
+  constexpr int kUnits = 1001;
+  const int input_dims[] = {1, kDepth};
+  const int filter_dims[] = {kUnits, kDepth};
+  const int bias_dims[] = {kUnits};
+  const int output_dims[] = {1, kUnits};
+
+  int failures = 0;
+  for (TfLiteType type : kAllTypes) {
+    KernelBenchmarkRunner runner(config.arena, config.arena_size);
+    const int inputs[] = {
+        runner.AddTensor(type, input_dims, 2, kInputScale,
+                         ActivationZeroPoint(type)),
+        runner.AddTensor(type, filter_dims, 2, kFilterScale,
+                         ActivationZeroPoint(type)),
+        runner.AddTensor(BiasType(type), bias_dims, 1,
+                         kInputScale * kFilterScale),
+    };
+    const int outputs[] = {runner.AddTensor(type, output_dims, 2,
+                                            kOutputScale,
+                                            ActivationZeroPoint(type))};
+    if (!runner.out_of_memory()) {
+      FillInputs(&runner, inputs, 3);
+    }
+
+    TfLiteFullyConnectedParams params = {
+        kTfLiteActNone, kTfLiteFullyConnectedWeightsFormatDefault, false,
+        false};
+    const uint64_t macs = static_cast<uint64_t>(kDepth) * kUnits;
+    const Row row = {"FULLY_CONNECTED", "Logits", type, macs, 2 * macs};
+    failures += Run(config, &runner, row, Register_FULLY_CONNECTED(), inputs,
+                    3, outputs, 1, &params);
+  }
+  return failures;
+}
+
+// The postprocessing kernel only implements float32 inputs.
+int BenchmarkSsdDetectionPostprocess(const SsdKernelBenchmarkConfig& config) {
+  constexpr int kMaxDetections = 10;
+  const int box_dims[] = {1, kNumBoxes, 4};
+  const int class_dims[] = {1, kNumBoxes, kNumClasses};
+  const int anchor_dims[] = {kNumBoxes, 4};
+  const int detection_box_dims[] = {1, kMaxDetections, 4};
+  const int detection_dims[] = {1, kMaxDetections};
+  const int count_dims[] = {1};
+
+  KernelBenchmarkRunner runner(config.arena, config.arena_size);
+  const int inputs[] = {
+      runner.AddTensor(kTfLiteFloat32, box_dims, 3),
+      runner.AddTensor(kTfLiteFloat32, class_dims, 3),
+      runner.AddTensor(kTfLiteFloat32, anchor_dims, 2),
+  };
+  const int outputs[] = {
+      runner.AddTensor(kTfLiteFloat32, detection_box_dims, 3),
+      runner.AddTensor(kTfLiteFloat32, detection_dims, 2),
+      runner.AddTensor(kTfLiteFloat32, detection_dims, 2),
+      runner.AddTensor(kTfLiteFloat32, count_dims, 1),
+  };
+  if (!runner.out_of_memory()) {
+    FillInputs(&runner, inputs, 3);
+    // Scores in [0, 1) and anchors (y, x, h, w) inside the image.
+    float* scores = runner.tensor(inputs[1])->data.f;
+    for (int i = 0; i < kNumBoxes * kNumClasses; ++i) {
+      scores[i] = 0.5f * (scores[i] + 1.0f);
+    }
+    float* anchors = runner.tensor(inputs[2])->data.f;
+    for (int i = 0; i < kNumBoxes * 4; ++i) {
+      anchors[i] = 0.25f * anchors[i] + 0.5f;
+    }
+  }
+
+  const Row row = {"DETECTION_POSTPROCESS", "TFLite_Detection_PostProcess",
+                   kTfLiteFloat32, 0,
+                   static_cast<uint64_t>(kNumBoxes) * kNumClasses};
+  return Run(config, &runner, row, *Register_DETECTION_POSTPROCESS(), inputs,
+             3, outputs, 4, nullptr, kDetectionPostprocessOptions,
+             sizeof(kDetectionPostprocessOptions));
+}
+
+// MobileNetV1 has no residual connections; this is an element-wise add of
+// two 19x19x512 feature maps.
+int BenchmarkSsdAdd(const SsdKernelBenchmarkConfig& config) {
+  const int dims[] = {1, 19, 19, 512};
+  int failures = 0;
+  for (TfLiteType type : kInt8AndFloatTypes) {
+    KernelBenchmarkRunner runner(config.arena, config.arena_size);
+    const int inputs[] = {
+        runner.AddTensor(type, dims, 4, kInputScale,
+                         ActivationZeroPoint(type)),
+        runner.AddTensor(type, dims, 4, kInputScale,
+                         ActivationZeroPoint(type)),
+    };
+    const int outputs[] = {runner.AddTensor(type, dims, 4, kOutputScale,
+                                            ActivationZeroPoint(type))};
+    if (!runner.out_of_memory()) {
+      FillInputs(&runner, inputs, 2);
+    }
+
+    TfLiteAddParams params = {kTfLiteActNone, false};
+    const Row row = {"ADD", "19x19x512", type, 0, 19 * 19 * 512};
+    failures += Run(config, &runner, row, Register_ADD(), inputs, 2, outputs,
+                    1, &params);
+  }
+  return failures;
+}
+
+int RunSsdKernelBenchmarks(const SsdKernelBenchmarkConfig& config) {
+  LogSsdKernelBenchmarkHeader();
+  int failures = 0;
+  failures += BenchmarkSsdConv2D(config);
+  failures += BenchmarkSsdDepthwiseConv2D(config);
+  failures += BenchmarkSsdAveragePool2D(config);
+  failures += BenchmarkSsdMaxPool2D(config);
+  failures += BenchmarkSsdSoftmax(config);
+  failures += BenchmarkSsdReshape(config);
+  failures += BenchmarkSsdFullyConnected(config);
+  failures += BenchmarkSsdDetectionPostprocess(config);
+  failures += BenchmarkSsdLogistic(config);
+  failures += BenchmarkSsdAdd(config);
+  MicroPrintf("%d kernel benchmark(s) failed.", failures);
+  return failures;
+}
+
+}  // namespace tflite
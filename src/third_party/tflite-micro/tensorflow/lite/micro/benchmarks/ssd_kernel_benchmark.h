@@ -0,0 +1,77 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_BENCHMARKS_SSD_KERNEL_BENCHMARK_H_
+#define TENSORFLOW_LITE_MICRO_BENCHMARKS_SSD_KERNEL_BENCHMARK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tflite {
+
+// Micro-benchmarks of the kernels registered by the SSD MobileNetV1 demo, at
+// the tensor shapes of the 300x300 SSD MobileNetV1 graph. Every op is run for
+// each type its kernel implements in this tree (uint8, int8, float32) on
+// pseudo-random data, so reference and optimized kernel paths can be compared
+// on the host and on the board.
+//
+// Each benchmark prints one CSV row (see LogSsdKernelBenchmarkHeader()):
+//   Iterations  number of timed invocations,
+//   Cycles      average CPU cycles per invocation,
+//   MACs        multiply-accumulates per invocation (conv, depthwise and
+//               fully connected only, empty for other ops),
+//   MACs/cycle  MACs divided by Cycles,
+//   Bytes       size of all input and output tensors, i.e. the data the
+//               kernel has to move at least once per invocation,
+//   MOPS        millions of operations per second, counting two per MAC, or
+//               one per output element for kernels without MACs.
+struct SsdKernelBenchmarkConfig {
+  // Memory for tensors and kernel buffers. The float32 variants of the early
+  // MobileNet layers need about 9 MB; benchmarks that do not fit are reported
+  // as skipped.
+  uint8_t* arena;
+  size_t arena_size;
+  // Converts timer ticks (see micro_time.h) into CPU cycles. If 0, the Cycles
+  // and per-cycle columns are in timer ticks instead.
+  uint32_t cpu_clock_hz;
+  // Every benchmark runs at least min_iterations invocations and continues
+  // until min_ticks timer ticks have passed, up to 1000 invocations.
+  int min_iterations;
+  int32_t min_ticks;
+};
+
+// Each of these benchmarks one op over its SSD layer shapes and types and
+// returns the number of benchmarks that failed to prepare or invoke.
+int BenchmarkSsdConv2D(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdDepthwiseConv2D(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdAveragePool2D(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdMaxPool2D(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdSoftmax(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdReshape(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdFullyConnected(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdDetectionPostprocess(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdLogistic(const SsdKernelBenchmarkConfig& config);
+int BenchmarkSsdAdd(const SsdKernelBenchmarkConfig& config);
+
+// Prints the CSV header of the benchmark rows.
+void LogSsdKernelBenchmarkHeader();
+
+// Prints the header and runs all of the above; returns the total number of
+// failed benchmarks.
+int RunSsdKernelBenchmarks(const SsdKernelBenchmarkConfig& config);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_BENCHMARKS_SSD_KERNEL_BENCHMARK_H_
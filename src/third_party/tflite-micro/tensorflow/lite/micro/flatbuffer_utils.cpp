@@ -61,6 +61,29 @@ uint32_t NumSubgraphOperators(const Model* model, int subgraph_idx) {
   return NumSubgraphOperators(subgraph);
 }
 
+bool TensorListContains(const flatbuffers::Vector<int32_t>* list,
+                        int tensor_index) {
+  for (size_t i = 0; list != nullptr && i < list->size(); ++i) {
+    if (list->Get(i) == tensor_index) {
+      return true;
+    }
+  }
+  return false;
+}
+
+int NumTensorReaders(const SubGraph* subgraph, int tensor_index) {
+  int readers = 0;
+  for (size_t i = 0; i < NumSubgraphOperators(subgraph); ++i) {
+    const auto* inputs = subgraph->operators()->Get(i)->inputs();
+    for (size_t n = 0; inputs != nullptr && n < inputs->size(); ++n) {
+      if (inputs->Get(n) == tensor_index) {
+        ++readers;
+      }
+    }
+  }
+  return readers;
+}
+
 TfLiteIntArray* FlatBufferVectorToTfLiteTypeArray(
     const flatbuffers::Vector<int32_t>* flatbuffer_array) {
   // On little-endian machines, TfLiteIntArray happens to have the same memory
@@ -52,6 +52,15 @@ class FlexbufferWrapper : public flexbuffers::Vector {
 uint32_t NumSubgraphOperators(const SubGraph* subgraph);
 uint32_t NumSubgraphOperators(const Model* model, int subgraph_idx);
 
+// Returns true if the tensor index list (e.g. the inputs of an operator or of a
+// subgraph) contains tensor_index. A null list is treated as empty.
+bool TensorListContains(const flatbuffers::Vector<int32_t>* list,
+                        int tensor_index);
+
+// Returns the number of operator inputs of the subgraph that read
+// tensor_index. An operator that reads the tensor twice counts twice.
+int NumTensorReaders(const SubGraph* subgraph, int tensor_index);
+
 // Converts a flatbuffer array to a TfLiteArray.
 // TODO(b/188459715): These function convert a const input to a non-const via a
 // const_cast. It is unclear exactly why this is required.
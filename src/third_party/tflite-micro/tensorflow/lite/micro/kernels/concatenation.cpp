@@ -15,6 +15,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/reference/concatenation.h"
 
 #include <cstdint>
+#include <cstring>
 
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
@@ -23,6 +24,7 @@ limitations under the License.
 #include "tensorflow/lite/kernels/internal/types.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
 
 namespace tflite {
 namespace ops {
@@ -34,6 +36,9 @@ constexpr int kOutputTensor = 0;
 
 struct OpData {
   ConcatenationParams params;
+  // True if every output dimension in front of the axis is 1, i.e. the output
+  // is the inputs stored back to back.
+  bool inputs_contiguous;
 };
 
 // Handles negative axis index, coerces to positive index value.
@@ -104,6 +109,25 @@ void EvalUnquantized(TfLiteContext* context, TfLiteNode* node) {
                                tflite::micro::GetTensorData<data_type>(output));
 }
 
+// Copies the inputs back to back into the output, except those the memory
+// planner already placed at their slice of it (see FindTensorAliases()).
+TfLiteStatus EvalContiguous(TfLiteContext* context, TfLiteNode* node) {
+  TfLiteEvalTensor* output =
+      tflite::micro::GetEvalOutput(context, node, kOutputTensor);
+  uint8_t* slice = output->data.uint8;
+  for (int i = 0; i < node->inputs->size; ++i) {
+    const TfLiteEvalTensor* input =
+        tflite::micro::GetEvalInput(context, node, i);
+    size_t bytes;
+    TF_LITE_ENSURE_STATUS(TfLiteEvalTensorByteLength(input, &bytes));
+    if (input->data.uint8 != slice) {
+      memcpy(slice, input->data.uint8, bytes);
+    }
+    slice += bytes;
+  }
+  return kTfLiteOk;
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   return context->AllocatePersistentBuffer(context, sizeof(OpData));
@@ -202,6 +226,13 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteError;
   }
 
+  data->inputs_contiguous = true;
+  for (int i = 0; i < data->params.axis; ++i) {
+    if (output->dims->data[i] != 1) {
+      data->inputs_contiguous = false;
+    }
+  }
+
   return kTfLiteOk;
 }
 
@@ -211,6 +242,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE(context, output_tensor != nullptr);
   TfLiteType output_type = output_tensor->type;
 
+  TFLITE_DCHECK(node->user_data != nullptr);
+  if (static_cast<const OpData*>(node->user_data)->inputs_contiguous) {
+    return EvalContiguous(context, node);
+  }
+
   switch (output_type) {  // Already know in/outtypes are same.
     case kTfLiteFloat32:
       EvalUnquantized<float>(context, node);
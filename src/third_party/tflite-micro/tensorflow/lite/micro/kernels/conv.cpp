@@ -18,6 +18,7 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/conv.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/conv.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
@@ -29,9 +30,144 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+// Upper bound on the im2col scratch buffer of the GEMM path. Larger
+// convolutions are expanded in bands of output rows that fit this budget.
+constexpr int kMaxIm2colBytes = 16 * 1024;
+
+struct OpData {
+  // Must stay the first member: ConvPrepare() treats user_data as an
+  // OpDataConv.
+  OpDataConv reference_op_data;
+  // Scratch buffer holding one band of im2col patches for the GEMM path, or
+  // -1 for 1x1 convolutions that run the GEMM directly on the input.
+  int im2col_buffer_index;
+  // Number of output rows expanded per band.
+  int im2col_rows;
+  // Constant int8 and uint8 filters (with a constant or no bias) are packed
+  // once in Prepare into the layout of optimized_integer_ops::PackFilter(),
+  // in persistent memory and of the filter's type, with the bias the input
+  // offset is folded into. nullptr otherwise.
+  void* packed_filter;
+  int32_t* effective_bias;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+// Packs the constant filter of an int8 or uint8 convolution, see OpData.
+template <typename T>
+TfLiteStatus PackConstantFilter(TfLiteContext* context,
+                                const TfLiteTensor* filter,
+                                const TfLiteTensor* bias, OpData* data) {
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const int output_depth = filter_shape.Dims(0);
+  const int patch_size = filter_shape.FlatSize() / output_depth;
+  data->packed_filter = context->AllocatePersistentBuffer(
+      context, optimized_integer_ops::PackedFilterBytes(output_depth,
+                                                        patch_size));
+  data->effective_bias =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->packed_filter != nullptr &&
+                              data->effective_bias != nullptr);
+  optimized_integer_ops::PackFilter(
+      GetTensorData<T>(filter), output_depth, patch_size,
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+      -data->reference_op_data.input_zero_point,
+      -data->reference_op_data.filter_zero_point,
+      static_cast<T*>(data->packed_filter), data->effective_bias);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(ConvPrepare(context, node));
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  data->im2col_buffer_index = -1;
+  data->im2col_rows = 0;
+  data->packed_filter = nullptr;
+  data->effective_bias = nullptr;
+
+  const TfLiteTensor* input = GetInput(context, node, kConvInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  if (input->type != kTfLiteInt8 && input->type != kTfLiteUInt8) {
+    return kTfLiteOk;
+  }
+  const TfLiteTensor* filter = GetInput(context, node, kConvWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  const TfLiteTensor* bias =
+      GetOptionalInputTensor(context, node, kConvBiasTensor);
+  const TfLiteTensor* output = GetOutput(context, node, kConvOutputTensor);
+  TF_LITE_ENSURE(context, output != nullptr);
+
+  const auto& params =
+      *(static_cast<const TfLiteConvParams*>(node->builtin_data));
+  const RuntimeShape input_shape = GetTensorShape(input);
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  const RuntimeShape output_shape = GetTensorShape(output);
+
+  if (input->type == kTfLiteUInt8) {
+    // uint8 filters are quantized per tensor, but the GEMM reads the
+    // multiplier and shift per channel.
+    for (int c = 0; c < filter_shape.Dims(0); ++c) {
+      data->reference_op_data.per_channel_output_multiplier[c] =
+          data->reference_op_data.output_multiplier;
+      data->reference_op_data.per_channel_output_shift[c] =
+          -data->reference_op_data.output_shift;
+    }
+  }
+  if (IsConstantTensor(filter) &&
+      (bias == nullptr || IsConstantTensor(bias))) {
+    TF_LITE_ENSURE_STATUS(
+        input->type == kTfLiteUInt8
+            ? PackConstantFilter<uint8_t>(context, filter, bias, data)
+            : PackConstantFilter<int8_t>(context, filter, bias, data));
+  }
+
+  if (optimized_integer_ops::ConvIsPointwise(
+          ConvParamsQuantized(params, data->reference_op_data),
+          filter_shape)) {
+    return kTfLiteOk;
+  }
+
+  data->im2col_rows = optimized_integer_ops::ConvIm2colRows(
+      input_shape, filter_shape, output_shape, kMaxIm2colBytes);
+  const int patch_size =
+      filter_shape.Dims(1) * filter_shape.Dims(2) * input_shape.Dims(3);
+  return context->RequestScratchBufferInArena(
+      context, data->im2col_rows * output_shape.Dims(2) * patch_size,
+      &data->im2col_buffer_index);
+}
+
+// Runs the int8 or uint8 convolution on the GEMM.
+template <typename T>
+void EvalQuantized(TfLiteContext* context, const TfLiteConvParams& params,
+                   const OpData& op_data, const TfLiteEvalTensor* input,
+                   const TfLiteEvalTensor* filter,
+                   const TfLiteEvalTensor* bias, TfLiteEvalTensor* output) {
+  const OpDataConv& data = op_data.reference_op_data;
+  const RuntimeShape filter_shape = tflite::micro::GetTensorShape(filter);
+  const RuntimeShape output_shape = tflite::micro::GetTensorShape(output);
+  T* im2col_data = nullptr;
+  if (op_data.im2col_buffer_index >= 0) {
+    im2col_data = static_cast<T*>(
+        context->GetScratchBuffer(context, op_data.im2col_buffer_index));
+  }
+  const int32_t im2col_dims[4] = {
+      1, op_data.im2col_rows, output_shape.Dims(2),
+      filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3)};
+  const RuntimeShape im2col_shape(4, im2col_dims);
+  optimized_integer_ops::ConvPerChannel(
+      ConvParamsQuantized(params, data), data.per_channel_output_multiplier,
+      data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<T>(input), filter_shape,
+      tflite::micro::GetTensorData<T>(filter),
+      tflite::micro::GetTensorShape(bias),
+      tflite::micro::GetTensorData<int32_t>(bias), output_shape,
+      tflite::micro::GetTensorData<T>(output), im2col_shape, im2col_data,
+      static_cast<const T*>(op_data.packed_filter), op_data.effective_bias);
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -50,7 +186,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   const auto& params =
       *(reinterpret_cast<TfLiteConvParams*>(node->builtin_data));
   TFLITE_DCHECK(node->user_data != nullptr);
-  const auto& data = *(static_cast<const OpDataConv*>(node->user_data));
+  const OpData& op_data = *(static_cast<const OpData*>(node->user_data));
+  const OpDataConv& data = op_data.reference_op_data;
 
   TF_LITE_ENSURE_EQ(context, input->type, output->type);
   TF_LITE_ENSURE_MSG(
@@ -87,16 +224,13 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       break;
     }
     case kTfLiteInt8: {
-      reference_integer_ops::ConvPerChannel(
-          ConvParamsQuantized(params, data), data.per_channel_output_multiplier,
-          data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<int8_t>(input),
-          tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<int8_t>(filter),
-          tflite::micro::GetTensorShape(bias),
-          tflite::micro::GetTensorData<int32_t>(bias),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
+      EvalQuantized<int8_t>(context, params, op_data, input, filter, bias,
+                            output);
+      break;
+    }
+    case kTfLiteUInt8: {
+      EvalQuantized<uint8_t>(context, params, op_data, input, filter, bias,
+                             output);
       break;
     }
     default:
@@ -112,7 +246,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 TfLiteRegistration Register_CONV_2D() {
   return {/*init=*/Init,
           /*free=*/nullptr,
-          /*prepare=*/ConvPrepare,
+          /*prepare=*/Prepare,
           /*invoke=*/Eval,
           /*profiling_string=*/nullptr,
           /*builtin_code=*/0,
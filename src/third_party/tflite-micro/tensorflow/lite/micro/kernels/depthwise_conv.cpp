@@ -18,6 +18,8 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/depthwiseconv_uint8.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/depthwise_conv.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/depthwiseconv_float.h"
 #include "tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
@@ -29,9 +31,135 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+// Kernel variant of an int8 or uint8 node, selected once in Prepare from the
+// filter shape and params.
+enum class Kernel {
+  kGeneric,
+  k3x3Stride1,
+  k3x3Stride2,
+};
+
+struct OpData {
+  // Must stay the first member: DepthwiseConvPrepare() treats user_data as an
+  // OpDataConv.
+  OpDataConv reference_op_data;
+  Kernel kernel;
+  // Constant int8 and uint8 filters of the 3x3 variants (with a constant or
+  // no bias) are packed once in Prepare by
+  // optimized_integer_ops::Pack3x3Filter(), in persistent memory, with the
+  // bias the input offset is folded into. int8 filters are packed as int8,
+  // uint8 filters as int16. nullptr otherwise.
+  void* packed_filter;
+  int32_t* effective_bias;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context, sizeof(OpDataConv));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+// Packs the constant filter of an int8 or uint8 node, see OpData.
+template <typename T>
+TfLiteStatus PackFilter(TfLiteContext* context, const TfLiteTensor* filter,
+                        const TfLiteTensor* bias, OpData* data) {
+  using PackedT =
+      typename optimized_integer_ops::depthwise_conv::PackedFilterType<T>::type;
+  const int depth = GetTensorShape(filter).Dims(3);
+  const size_t packed_bytes =
+      optimized_integer_ops::Packed3x3FilterBytes<T>(depth);
+  if (packed_bytes == 0) {
+    return kTfLiteOk;
+  }
+  data->packed_filter =
+      context->AllocatePersistentBuffer(context, packed_bytes);
+  data->effective_bias = static_cast<int32_t*>(
+      context->AllocatePersistentBuffer(context, depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->packed_filter != nullptr &&
+                              data->effective_bias != nullptr);
+  optimized_integer_ops::Pack3x3Filter(
+      GetTensorData<T>(filter), depth,
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+      -data->reference_op_data.input_zero_point,
+      -data->reference_op_data.filter_zero_point,
+      static_cast<PackedT*>(data->packed_filter), data->effective_bias);
+  return kTfLiteOk;
+}
+
+TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
+  TF_LITE_ENSURE_STATUS(DepthwiseConvPrepare(context, node));
+
+  OpData* data = static_cast<OpData*>(node->user_data);
+  const auto& params =
+      *(static_cast<const TfLiteDepthwiseConvParams*>(node->builtin_data));
+  const TfLiteTensor* filter =
+      GetInput(context, node, kDepthwiseConvWeightsTensor);
+  TF_LITE_ENSURE(context, filter != nullptr);
+  const TfLiteTensor* bias =
+      GetOptionalInputTensor(context, node, kDepthwiseConvBiasTensor);
+
+  const DepthwiseParams op_params =
+      DepthwiseConvParamsQuantized(params, data->reference_op_data);
+  const RuntimeShape filter_shape = GetTensorShape(filter);
+  if (optimized_integer_ops::DepthwiseConv3x3FilterSupported(
+          op_params, filter_shape, /*stride=*/1)) {
+    data->kernel = Kernel::k3x3Stride1;
+  } else if (optimized_integer_ops::DepthwiseConv3x3FilterSupported(
+                 op_params, filter_shape, /*stride=*/2)) {
+    data->kernel = Kernel::k3x3Stride2;
+  } else {
+    data->kernel = Kernel::kGeneric;
+  }
+
+  data->packed_filter = nullptr;
+  data->effective_bias = nullptr;
+  const TfLiteTensor* input =
+      GetInput(context, node, kDepthwiseConvInputTensor);
+  TF_LITE_ENSURE(context, input != nullptr);
+  if (input->type == kTfLiteUInt8) {
+    // uint8 filters are quantized per tensor, but the 3x3 kernels read the
+    // multiplier and shift per channel.
+    for (int c = 0; c < filter_shape.Dims(3); ++c) {
+      data->reference_op_data.per_channel_output_multiplier[c] =
+          data->reference_op_data.output_multiplier;
+      data->reference_op_data.per_channel_output_shift[c] =
+          -data->reference_op_data.output_shift;
+    }
+  }
+  if (!IsConstantTensor(filter) ||
+      (bias != nullptr && !IsConstantTensor(bias)) ||
+      data->kernel == Kernel::kGeneric) {
+    return kTfLiteOk;
+  }
+  switch (filter->type) {
+    case kTfLiteInt8:
+      return PackFilter<int8_t>(context, filter, bias, data);
+    case kTfLiteUInt8:
+      return PackFilter<uint8_t>(context, filter, bias, data);
+    default:
+      return kTfLiteOk;
+  }
+}
+
+// Runs an int8 or uint8 node whose kernel is one of the 3x3 variants.
+template <int kStride, typename T>
+void Eval3x3(const DepthwiseParams& op_params, const OpData& op_data,
+             const TfLiteEvalTensor* input, const TfLiteEvalTensor* filter,
+             const TfLiteEvalTensor* bias, TfLiteEvalTensor* output) {
+  using PackedT =
+      typename optimized_integer_ops::depthwise_conv::PackedFilterType<T>::type;
+  const OpDataConv& data = op_data.reference_op_data;
+  optimized_integer_ops::DepthwiseConv3x3PerChannel<kStride>(
+      op_params, data.per_channel_output_multiplier,
+      data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<T>(input),
+      tflite::micro::GetTensorShape(filter),
+      tflite::micro::GetTensorData<T>(filter),
+      tflite::micro::GetTensorShape(bias),
+      tflite::micro::GetTensorData<int32_t>(bias),
+      tflite::micro::GetTensorShape(output),
+      tflite::micro::GetTensorData<T>(output),
+      static_cast<const PackedT*>(op_data.packed_filter),
+      op_data.effective_bias);
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -40,7 +168,8 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 
   auto& params =
       *(reinterpret_cast<TfLiteDepthwiseConvParams*>(node->builtin_data));
-  const OpDataConv& data = *(static_cast<const OpDataConv*>(node->user_data));
+  const OpData& op_data = *(static_cast<const OpData*>(node->user_data));
+  const OpDataConv& data = op_data.reference_op_data;
 
   TfLiteEvalTensor* output =
       tflite::micro::GetEvalOutput(context, node, kDepthwiseConvOutputTensor);
@@ -68,17 +197,56 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       break;
     }
     case kTfLiteInt8: {
-      reference_integer_ops::DepthwiseConvPerChannel(
-          DepthwiseConvParamsQuantized(params, data),
-          data.per_channel_output_multiplier, data.per_channel_output_shift,
+      const DepthwiseParams op_params =
+          DepthwiseConvParamsQuantized(params, data);
+      switch (op_data.kernel) {
+        case Kernel::k3x3Stride1:
+          Eval3x3</*kStride=*/1, int8_t>(op_params, op_data, input, filter,
+                                         bias, output);
+          break;
+        case Kernel::k3x3Stride2:
+          Eval3x3</*kStride=*/2, int8_t>(op_params, op_data, input, filter,
+                                         bias, output);
+          break;
+        case Kernel::kGeneric:
+          optimized_integer_ops::DepthwiseConvPerChannel(
+              op_params, data.per_channel_output_multiplier,
+              data.per_channel_output_shift,
+              tflite::micro::GetTensorShape(input),
+              tflite::micro::GetTensorData<int8_t>(input),
+              tflite::micro::GetTensorShape(filter),
+              tflite::micro::GetTensorData<int8_t>(filter),
+              tflite::micro::GetTensorShape(bias),
+              tflite::micro::GetTensorData<int32_t>(bias),
+              tflite::micro::GetTensorShape(output),
+              tflite::micro::GetTensorData<int8_t>(output));
+          break;
+      }
+      break;
+    }
+    case kTfLiteUInt8: {
+      const DepthwiseParams op_params =
+          DepthwiseConvParamsQuantized(params, data);
+      if (op_data.kernel == Kernel::k3x3Stride1) {
+        Eval3x3</*kStride=*/1, uint8_t>(op_params, op_data, input, filter,
+                                        bias, output);
+        break;
+      }
+      if (op_data.kernel == Kernel::k3x3Stride2) {
+        Eval3x3</*kStride=*/2, uint8_t>(op_params, op_data, input, filter,
+                                        bias, output);
+        break;
+      }
+      optimized_ops::DepthwiseConv(
+          op_params,
           tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<int8_t>(input),
+          tflite::micro::GetTensorData<uint8_t>(input),
           tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<int8_t>(filter),
+          tflite::micro::GetTensorData<uint8_t>(filter),
           tflite::micro::GetTensorShape(bias),
           tflite::micro::GetTensorData<int32_t>(bias),
           tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
+          tflite::micro::GetTensorData<uint8_t>(output));
       break;
     }
     default:
@@ -94,7 +262,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
 TfLiteRegistration Register_DEPTHWISE_CONV_2D() {
   return {/*init=*/Init,
           /*free=*/nullptr,
-          /*prepare=*/DepthwiseConvPrepare,
+          /*prepare=*/Prepare,
           /*invoke=*/Eval,
           /*profiling_string=*/nullptr,
           /*builtin_code=*/0,
@@ -14,8 +14,12 @@ limitations under the License.
 ==============================================================================*/
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <numeric>
 #include <tuple>
+#include <type_traits>
 
 #include "flatbuffers/flexbuffers.h"
 #include "tensorflow/lite/c/builtin_op_data.h"
@@ -28,6 +32,10 @@ limitations under the License.
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/micro_utils.h"
 
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace tflite {
 namespace {
 
@@ -38,6 +46,10 @@ namespace {
  * 1.) Temporaries (temporary tensors) - Micro use instead scratch buffer API.
  * 2.) Output dimensions - the TFLite version does not support undefined out
  * dimensions. So model must have static out dimensions.
+ * 3.) Quantized class predictions - uint8/int8 scores are thresholded, sorted
+ * and suppressed in the integer domain, against a threshold quantized once in
+ * Prepare, and only the selected scores are dequantized. The TFLite version
+ * dequantizes all of them first.
  */
 
 // Input tensors
@@ -56,6 +68,9 @@ constexpr int kBatchSize = 1;
 
 constexpr int kNumDetectionsPerClass = 100;
 
+// Number of uint8/int8 values.
+constexpr int kNumQuantizedValues = 256;
+
 // Object Detection model produces axis-aligned boxes in two formats:
 // BoxCorner represents the lower left corner (xmin, ymin) and
 // the upper right corner (xmax, ymax).
@@ -88,6 +103,46 @@ static_assert(sizeof(BoxCornerEncoding) == sizeof(float) * kNumCoordBox,
 static_assert(sizeof(CenterSizeEncoding) == sizeof(float) * kNumCoordBox,
               "Size of CenterSizeEncoding is 4 float values");
 
+// Boxes as a structure of arrays over a buffer of kNumBoxStoreArrays *
+// capacity floats, with the area of each box, so that one box is compared
+// with a block of others in a single vector loop.
+constexpr int kNumBoxStoreArrays = 5;
+
+struct BoxStore {
+  BoxStore(float* buffer, int capacity)
+      : ymin(buffer),
+        xmin(buffer + capacity),
+        ymax(buffer + 2 * capacity),
+        xmax(buffer + 3 * capacity),
+        area(buffer + 4 * capacity) {}
+
+  void Set(int i, const BoxCornerEncoding& box) {
+    ymin[i] = box.ymin;
+    xmin[i] = box.xmin;
+    ymax[i] = box.ymax;
+    xmax[i] = box.xmax;
+    area[i] = (box.ymax - box.ymin) * (box.xmax - box.xmin);
+  }
+
+  void Copy(int i, const BoxStore& other, int j) {
+    ymin[i] = other.ymin[j];
+    xmin[i] = other.xmin[j];
+    ymax[i] = other.ymax[j];
+    xmax[i] = other.xmax[j];
+    area[i] = other.area[j];
+  }
+
+  BoxCornerEncoding Get(int i) const {
+    return {ymin[i], xmin[i], ymax[i], xmax[i]};
+  }
+
+  float* ymin;
+  float* xmin;
+  float* ymax;
+  float* xmax;
+  float* area;
+};
+
 struct OpData {
   int max_detections;
   int max_classes_per_detection;  // Fast Non-Max-Suppression
@@ -99,9 +154,7 @@ struct OpData {
   CenterSizeEncoding scale_values;
 
   // Scratch buffers indexes
-  int active_candidate_idx;
   int decoded_boxes_idx;
-  int scores_idx;
   int score_buffer_idx;
   int keep_scores_idx;
   int scores_after_regular_non_max_suppression_idx;
@@ -110,13 +163,241 @@ struct OpData {
   int sorted_indices_idx;
   int buffer_idx;
   int selected_idx;
+  int selected_boxes_idx;
+  int max_selected;
 
   // Cached tensor scale and zero point values for quantized operations
   TfLiteQuantizationParams input_box_encodings;
   TfLiteQuantizationParams input_class_predictions;
   TfLiteQuantizationParams input_anchors;
+
+  // For uint8/int8 class predictions, the smallest quantized score whose real
+  // value reaches non_max_suppression_score_threshold (one past the largest
+  // quantized value if none does).
+  int32_t quantized_score_threshold;
+
+  // Box decoding: the box encoding scale (1 for float) over the y/x/h/w
+  // scales, 0.5 * exp(h / h_scale) and 0.5 * exp(w / w_scale) for each
+  // quantized value of uint8/int8 box encodings (else nullptr), and constant
+  // uint8/int8 anchors dequantized once (else nullptr).
+  CenterSizeEncoding decode_factors;
+  const float* half_h_table;
+  const float* half_w_table;
+  const CenterSizeEncoding* anchors;
+};
+
+template <typename T>
+class Dequantizer {
+ public:
+  explicit Dequantizer(const TfLiteQuantizationParams& params)
+      : zero_point_(params.zero_point), scale_(params.scale) {}
+  float operator()(T x) const {
+    return (static_cast<float>(x) - zero_point_) * scale_;
+  }
+
+ private:
+  int zero_point_;
+  float scale_;
+};
+
+template <>
+class Dequantizer<float> {
+ public:
+  explicit Dequantizer(const TfLiteQuantizationParams& params) {}
+  float operator()(float x) const { return x; }
 };
 
+// Scores are compared with the threshold in the type of the class
+// predictions. Dequantization is monotonic and one-to-one, so uint8/int8
+// scores also sort in the same order as their real values.
+template <typename T>
+using ScoreThreshold =
+    typename std::conditional<std::is_same<T, float>::value, float,
+                              int32_t>::type;
+
+template <typename T>
+ScoreThreshold<T> GetScoreThreshold(const OpData* op_data);
+
+template <>
+float GetScoreThreshold<float>(const OpData* op_data) {
+  return op_data->non_max_suppression_score_threshold;
+}
+
+template <>
+int32_t GetScoreThreshold<uint8_t>(const OpData* op_data) {
+  return op_data->quantized_score_threshold;
+}
+
+template <>
+int32_t GetScoreThreshold<int8_t>(const OpData* op_data) {
+  return op_data->quantized_score_threshold;
+}
+
+// Sets op_data->quantized_score_threshold for uint8/int8 class predictions:
+// the quantized scores passing it are exactly those whose dequantized value
+// passes the float threshold.
+template <typename T>
+void QuantizeScoreThreshold(const TfLiteQuantizationParams& params,
+                            OpData* op_data) {
+  const Dequantizer<T> dequantize(params);
+  int32_t q = std::numeric_limits<T>::min();
+  while (q <= std::numeric_limits<T>::max() &&
+         dequantize(static_cast<T>(q)) <
+             op_data->non_max_suppression_score_threshold) {
+    ++q;
+  }
+  op_data->quantized_score_threshold = q;
+}
+
+TfLiteStatus QuantizeScoreThreshold(TfLiteContext* context,
+                                    const TfLiteTensor* class_predictions,
+                                    OpData* op_data) {
+  switch (class_predictions->type) {
+    case kTfLiteUInt8:
+      QuantizeScoreThreshold<uint8_t>(class_predictions->params, op_data);
+      return kTfLiteOk;
+    case kTfLiteInt8:
+      QuantizeScoreThreshold<int8_t>(class_predictions->params, op_data);
+      return kTfLiteOk;
+    default:
+      TF_LITE_KERNEL_LOG(context, "Type %s is not quantized.",
+                         TfLiteTypeGetName(class_predictions->type));
+      return kTfLiteError;
+  }
+}
+
+// Reads the index-th group of kNumCoordBox values, stride values apart, of a
+// box encodings or anchors tensor, dequantizing uint8/int8 ones.
+template <typename T>
+CenterSizeEncoding ReadCenterSize(const void* data, int index, int stride,
+                                  const TfLiteQuantizationParams& params) {
+  const T* values = static_cast<const T*>(data) + index * stride;
+  const Dequantizer<T> dequantize(params);
+  return {dequantize(values[0]), dequantize(values[1]), dequantize(values[2]),
+          dequantize(values[3])};
+}
+
+TfLiteStatus ReadCenterSize(TfLiteType type, const void* data, int index,
+                            int stride, const TfLiteQuantizationParams& params,
+                            CenterSizeEncoding* encoding) {
+  switch (type) {
+    case kTfLiteFloat32:
+      *encoding = ReadCenterSize<float>(data, index, stride, params);
+      return kTfLiteOk;
+    case kTfLiteUInt8:
+      *encoding = ReadCenterSize<uint8_t>(data, index, stride, params);
+      return kTfLiteOk;
+    case kTfLiteInt8:
+      *encoding = ReadCenterSize<int8_t>(data, index, stride, params);
+      return kTfLiteOk;
+    default:
+      // Unsupported type.
+      return kTfLiteError;
+  }
+}
+
+// e^x in single precision. x is clamped to [-87, 88], where e^x is a normal
+// float, and the relative error is within a few ulp: x = n * ln(2) + r with
+// |r| <= ln(2) / 2, e^r from a degree 7 polynomial, and 2^n put directly in
+// the exponent bits.
+float FastExp(float x) {
+  x = std::min(std::max(x, -87.0f), 88.0f);
+  const float n = std::floor(x * 1.44269504f + 0.5f);
+  // ln(2) split in two so that n * 0.693359375f is exact.
+  const float r = x - n * 0.693359375f + n * 2.12194440e-4f;
+  float p = 1.9875691500e-4f;
+  p = p * r + 1.3981999507e-3f;
+  p = p * r + 8.3334519073e-3f;
+  p = p * r + 4.1665795894e-2f;
+  p = p * r + 1.6666665459e-1f;
+  p = p * r + 5.0000001201e-1f;
+  p = p * r * r + r + 1.0f;
+  const int32_t exponent = (static_cast<int32_t>(n) + 127) << 23;
+  float scale;
+  memcpy(&scale, &exponent, sizeof(scale));
+  return p * scale;
+}
+
+// Half the box height or width relative to the anchor's: 0.5 * e^(value *
+// factor) for float box encodings, where factor is 1 / h_scale (or
+// w_scale), and a lookup in the table of the 256 quantized values for
+// uint8/int8 ones.
+template <typename T>
+float HalfSize(T value, float /*factor*/, const float* table) {
+  return table[value - std::numeric_limits<T>::min()];
+}
+
+template <>
+float HalfSize<float>(float value, float factor, const float* /*table*/) {
+  return 0.5f * FastExp(value * factor);
+}
+
+template <typename T>
+void FillHalfSizeTable(const TfLiteQuantizationParams& params,
+                       float scale_value, float* table) {
+  const Dequantizer<T> dequantize(params);
+  for (int q = std::numeric_limits<T>::min();
+       q <= std::numeric_limits<T>::max(); ++q) {
+    table[q - std::numeric_limits<T>::min()] =
+        static_cast<float>(0.5 * std::exp(static_cast<double>(dequantize(q)) /
+                                          static_cast<double>(scale_value)));
+  }
+}
+
+// Sets up the constants of the box decoding: the box encoding scale over
+// the y/x/h/w scales, the half size tables for uint8/int8 box encodings,
+// and a dequantized copy of constant uint8/int8 anchors.
+TfLiteStatus PrepareBoxDecoding(TfLiteContext* context,
+                                const TfLiteTensor* box_encodings,
+                                const TfLiteTensor* anchors, OpData* op_data) {
+  const bool quantized_boxes = box_encodings->type != kTfLiteFloat32;
+  const float box_scale =
+      quantized_boxes ? box_encodings->params.scale : 1.0f;
+  op_data->decode_factors.y = box_scale / op_data->scale_values.y;
+  op_data->decode_factors.x = box_scale / op_data->scale_values.x;
+  op_data->decode_factors.h = box_scale / op_data->scale_values.h;
+  op_data->decode_factors.w = box_scale / op_data->scale_values.w;
+
+  op_data->half_h_table = nullptr;
+  op_data->half_w_table = nullptr;
+  if (quantized_boxes) {
+    TF_LITE_ENSURE(context, box_scale > 0.0f);
+    float* tables = static_cast<float*>(context->AllocatePersistentBuffer(
+        context, 2 * kNumQuantizedValues * sizeof(float)));
+    TF_LITE_ENSURE(context, tables != nullptr);
+    if (box_encodings->type == kTfLiteUInt8) {
+      FillHalfSizeTable<uint8_t>(box_encodings->params,
+                                 op_data->scale_values.h, tables);
+      FillHalfSizeTable<uint8_t>(box_encodings->params,
+                                 op_data->scale_values.w,
+                                 tables + kNumQuantizedValues);
+    } else {
+      FillHalfSizeTable<int8_t>(box_encodings->params, op_data->scale_values.h,
+                                tables);
+      FillHalfSizeTable<int8_t>(box_encodings->params, op_data->scale_values.w,
+                                tables + kNumQuantizedValues);
+    }
+    op_data->half_h_table = tables;
+    op_data->half_w_table = tables + kNumQuantizedValues;
+  }
+
+  op_data->anchors = nullptr;
+  if (anchors->type != kTfLiteFloat32 && IsConstantTensor(anchors)) {
+    const int num_anchors = anchors->dims->data[0];
+    CenterSizeEncoding* dequantized =
+        static_cast<CenterSizeEncoding*>(context->AllocatePersistentBuffer(
+            context, num_anchors * sizeof(CenterSizeEncoding)));
+    TF_LITE_ENSURE(context, dequantized != nullptr);
+    for (int idx = 0; idx < num_anchors; ++idx) {
+      TF_LITE_ENSURE_STATUS(ReadCenterSize(anchors->type, anchors->data.data,
+                                           idx, kNumCoordBox, anchors->params,
+                                           &dequantized[idx]));
+    }
+    op_data->anchors = dequantized;
+  }
+  return kTfLiteOk;
+}
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
   OpData* op_data = nullptr;
@@ -167,9 +448,28 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_EQ(context, NumDimensions(input_anchors), 2);
 
   TF_LITE_ENSURE_EQ(context, NumOutputs(node), 4);
+  TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
   const int num_boxes = input_box_encodings->dims->data[1];
+  TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
+  TF_LITE_ENSURE_EQ(context, input_anchors->dims->data[0], num_boxes);
+  TF_LITE_ENSURE_EQ(context, input_anchors->dims->data[1], kNumCoordBox);
   const int num_classes = op_data->num_classes;
 
+  for (const TfLiteTensor* input :
+       {input_box_encodings, input_class_predictions, input_anchors}) {
+    TF_LITE_ENSURE_MSG(context,
+                       input->type == kTfLiteFloat32 ||
+                           input->type == kTfLiteUInt8 ||
+                           input->type == kTfLiteInt8,
+                       "Detection postprocess inputs must be float32, uint8 "
+                       "or int8.");
+  }
+  if (input_class_predictions->type != kTfLiteFloat32) {
+    TF_LITE_ENSURE(context, input_class_predictions->params.scale > 0.0f);
+    TF_LITE_ENSURE_STATUS(QuantizeScoreThreshold(
+        context, input_class_predictions, op_data));
+  }
+
   op_data->input_box_encodings.scale = input_box_encodings->params.scale;
   op_data->input_box_encodings.zero_point =
       input_box_encodings->params.zero_point;
@@ -179,41 +479,51 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
       input_class_predictions->params.zero_point;
   op_data->input_anchors.scale = input_anchors->params.scale;
   op_data->input_anchors.zero_point = input_anchors->params.zero_point;
+  TF_LITE_ENSURE_STATUS(PrepareBoxDecoding(context, input_box_encodings,
+                                           input_anchors, op_data));
 
   // Scratch tensors
-  context->RequestScratchBufferInArena(context, num_boxes,
-                                       &op_data->active_candidate_idx);
-  context->RequestScratchBufferInArena(context,
-                                       num_boxes * kNumCoordBox * sizeof(float),
-                                       &op_data->decoded_boxes_idx);
   context->RequestScratchBufferInArena(
-      context,
-      input_class_predictions->dims->data[1] *
-          input_class_predictions->dims->data[2] * sizeof(float),
-      &op_data->scores_idx);
+      context, num_boxes * kNumBoxStoreArrays * sizeof(float),
+      &op_data->decoded_boxes_idx);
 
-  // Additional buffers
-  context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
-                                       &op_data->score_buffer_idx);
+  // Additional buffers. Scores are stored as float or in the (smaller)
+  // quantized type of the class predictions.
+  TF_LITE_ENSURE(context, op_data->max_detections >= 0);
   context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
                                        &op_data->keep_scores_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
-      &op_data->scores_after_regular_non_max_suppression_idx);
-  context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(float),
-      &op_data->sorted_values_idx);
   context->RequestScratchBufferInArena(context, num_boxes * sizeof(int),
                                        &op_data->keep_indices_idx);
+  context->RequestScratchBufferInArena(context, num_boxes * sizeof(float),
+                                       &op_data->score_buffer_idx);
+  int& max_selected = op_data->max_selected;
+  max_selected = op_data->max_detections;
+  int num_sorted = num_boxes;
+  if (op_data->use_regular_non_max_suppression) {
+    TF_LITE_ENSURE(context, op_data->detections_per_class > 0);
+    // The detections of each class are merged with the best ones so far.
+    const int num_merged =
+        op_data->max_detections + op_data->detections_per_class;
+    max_selected = op_data->detections_per_class;
+    num_sorted = std::max(num_boxes, num_merged);
+    context->RequestScratchBufferInArena(
+        context, num_merged * sizeof(float),
+        &op_data->scores_after_regular_non_max_suppression_idx);
+    context->RequestScratchBufferInArena(context, num_merged * sizeof(float),
+                                         &op_data->sorted_values_idx);
+    context->RequestScratchBufferInArena(context, num_merged * sizeof(int),
+                                         &op_data->buffer_idx);
+  } else {
+    context->RequestScratchBufferInArena(context, num_classes * sizeof(int),
+                                         &op_data->buffer_idx);
+  }
+  context->RequestScratchBufferInArena(context, num_sorted * sizeof(int),
+                                       &op_data->sorted_indices_idx);
+  context->RequestScratchBufferInArena(context, max_selected * sizeof(int),
+                                       &op_data->selected_idx);
   context->RequestScratchBufferInArena(
-      context, op_data->max_detections * num_boxes * sizeof(int),
-      &op_data->sorted_indices_idx);
-  int buffer_size = std::max(num_classes, op_data->max_detections);
-  context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->buffer_idx);
-  buffer_size = std::min(num_boxes, op_data->max_detections);
-  context->RequestScratchBufferInArena(
-      context, buffer_size * num_boxes * sizeof(int), &op_data->selected_idx);
+      context, max_selected * kNumBoxStoreArrays * sizeof(float),
+      &op_data->selected_boxes_idx);
 
   // Outputs: detection_boxes, detection_scores, detection_classes,
   // num_detections
@@ -222,18 +532,6 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   return kTfLiteOk;
 }
 
-class Dequantizer {
- public:
-  Dequantizer(int zero_point, float scale)
-      : zero_point_(zero_point), scale_(scale) {}
-  float operator()(uint8_t x) {
-    return (static_cast<float>(x) - zero_point_) * scale_;
-  }
-
- private:
-  int zero_point_;
-  float scale_;
-};
 
 template <class T>
 T ReInterpretTensor(const TfLiteEvalTensor* tensor) {
@@ -247,72 +545,86 @@ T ReInterpretTensor(TfLiteEvalTensor* tensor) {
   return reinterpret_cast<T>(tensor_base);
 }
 
-TfLiteStatus DecodeCenterSizeBoxes(TfLiteContext* context, TfLiteNode* node,
-                                   OpData* op_data) {
-  // Parse input tensor boxencodings
+// Decodes the boxes of the anchors whose best class score reaches the score
+// threshold, the only ones non-max suppression reads, from CenterSizeEncoding
+// to BoxCornerEncoding.
+template <typename T, typename S>
+TfLiteStatus DecodeCandidateBoxesOfType(TfLiteContext* context,
+                                        TfLiteNode* node, OpData* op_data,
+                                        const S* max_scores) {
   const TfLiteEvalTensor* input_box_encodings =
       tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
-  TF_LITE_ENSURE_EQ(context, input_box_encodings->dims->data[0], kBatchSize);
-  const int num_boxes = input_box_encodings->dims->data[1];
-  TF_LITE_ENSURE(context, input_box_encodings->dims->data[2] >= kNumCoordBox);
   const TfLiteEvalTensor* input_anchors =
       tflite::micro::GetEvalInput(context, node, kInputTensorAnchors);
+  const int num_boxes = input_box_encodings->dims->data[1];
+  // Only the first kNumCoordBox values of each box encoding are used.
+  const int box_stride = input_box_encodings->dims->data[2];
+  const T* box_encodings = tflite::micro::GetTensorData<T>(input_box_encodings);
+  const int zero_point = std::is_same<T, float>::value
+                             ? 0
+                             : op_data->input_box_encodings.zero_point;
+  const ScoreThreshold<S> score_threshold = GetScoreThreshold<S>(op_data);
+  const CenterSizeEncoding& factors = op_data->decode_factors;
+  BoxStore decoded_boxes(
+      reinterpret_cast<float*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx)),
+      num_boxes);
 
-  // Decode the boxes to get (ymin, xmin, ymax, xmax) based on the anchors
-  CenterSizeEncoding box_centersize;
-  CenterSizeEncoding scale_values = op_data->scale_values;
   CenterSizeEncoding anchor;
   for (int idx = 0; idx < num_boxes; ++idx) {
-    switch (input_box_encodings->type) {
-        // Float
-      case kTfLiteFloat32: {
-        // Please see DequantizeBoxEncodings function for the support detail.
-        const int box_encoding_idx = idx * input_box_encodings->dims->data[2];
-        const float* boxes = &(tflite::micro::GetTensorData<float>(
-            input_box_encodings)[box_encoding_idx]);
-        box_centersize = *reinterpret_cast<const CenterSizeEncoding*>(boxes);
-        anchor =
-            ReInterpretTensor<const CenterSizeEncoding*>(input_anchors)[idx];
-        break;
-      }
-      default:
-        // Unsupported type.
-        return kTfLiteError;
+    if (!(max_scores[idx] >= score_threshold)) continue;
+    if (op_data->anchors != nullptr) {
+      anchor = op_data->anchors[idx];
+    } else {
+      TF_LITE_ENSURE_STATUS(ReadCenterSize(
+          input_anchors->type, input_anchors->data.data, idx, kNumCoordBox,
+          op_data->input_anchors, &anchor));
     }
-
-    float ycenter = static_cast<float>(static_cast<double>(box_centersize.y) /
-                                           static_cast<double>(scale_values.y) *
-                                           static_cast<double>(anchor.h) +
-                                       static_cast<double>(anchor.y));
-
-    float xcenter = static_cast<float>(static_cast<double>(box_centersize.x) /
-                                           static_cast<double>(scale_values.x) *
-                                           static_cast<double>(anchor.w) +
-                                       static_cast<double>(anchor.x));
-
-    float half_h =
-        static_cast<float>(0.5 *
-                           (std::exp(static_cast<double>(box_centersize.h) /
-                                     static_cast<double>(scale_values.h))) *
-                           static_cast<double>(anchor.h));
-    float half_w =
-        static_cast<float>(0.5 *
-                           (std::exp(static_cast<double>(box_centersize.w) /
-                                     static_cast<double>(scale_values.w))) *
-                           static_cast<double>(anchor.w));
-
-    float* decoded_boxes = reinterpret_cast<float*>(
-        context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-    auto& box = reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[idx];
-    box.ymin = ycenter - half_h;
-    box.xmin = xcenter - half_w;
-    box.ymax = ycenter + half_h;
-    box.xmax = xcenter + half_w;
+    const T* box = box_encodings + idx * box_stride;
+    const float ycenter =
+        static_cast<float>(box[0] - zero_point) * factors.y * anchor.h +
+        anchor.y;
+    const float xcenter =
+        static_cast<float>(box[1] - zero_point) * factors.x * anchor.w +
+        anchor.x;
+    const float half_h =
+        HalfSize(box[2], factors.h, op_data->half_h_table) * anchor.h;
+    const float half_w =
+        HalfSize(box[3], factors.w, op_data->half_w_table) * anchor.w;
+
+    const BoxCornerEncoding decoded_box = {
+        ycenter - half_h, xcenter - half_w, ycenter + half_h, xcenter + half_w};
+    // ymax>ymin, xmax>xmin
+    TF_LITE_ENSURE(context, decoded_box.ymin < decoded_box.ymax &&
+                                decoded_box.xmin < decoded_box.xmax);
+    decoded_boxes.Set(idx, decoded_box);
   }
   return kTfLiteOk;
 }
 
-void DecreasingPartialArgSort(const float* values, int num_values,
+template <typename S>
+TfLiteStatus DecodeCandidateBoxes(TfLiteContext* context, TfLiteNode* node,
+                                  OpData* op_data, const S* max_scores) {
+  const TfLiteEvalTensor* input_box_encodings =
+      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+  switch (input_box_encodings->type) {
+    case kTfLiteFloat32:
+      return DecodeCandidateBoxesOfType<float>(context, node, op_data,
+                                               max_scores);
+    case kTfLiteUInt8:
+      return DecodeCandidateBoxesOfType<uint8_t>(context, node, op_data,
+                                                 max_scores);
+    case kTfLiteInt8:
+      return DecodeCandidateBoxesOfType<int8_t>(context, node, op_data,
+                                                max_scores);
+    default:
+      // Unsupported type.
+      return kTfLiteError;
+  }
+}
+
+template <typename T>
+void DecreasingPartialArgSort(const T* values, int num_values,
                               int num_to_sort, int* indices) {
   std::iota(indices, indices + num_values, 0);
   std::partial_sort(indices, indices + num_to_sort, indices + num_values,
@@ -321,114 +633,168 @@ void DecreasingPartialArgSort(const float* values, int num_values,
                     });
 }
 
-template <typename Compare>
-void InsertionSort(int* start, int* end, Compare compare) {
-  for (int* i = start; i != end; ++i) {
-    std::rotate(std::upper_bound(start, i, *i, compare), i, i + 1);
-  }
-}
-
-template <typename Compare>
-void TopDownMerge(int* values, int* scratch, const int half_num_values,
-                  int num_values, Compare compare) {
-  int left = 0;
-  int right = half_num_values;
-
-  for (int i = 0; i < num_values; i++) {
-    if (left >= half_num_values ||
-        (right < num_values && compare(values[right], values[left]))) {
-      scratch[i] = values[right++];
-    } else {
-      scratch[i] = values[left++];
+// Keeps the scores values[i * stride], i < size, that reach the threshold,
+// together with their index i. Everything below the threshold is rejected
+// here, before any sorting or overlap test.
+template <typename T>
+int SelectDetectionsAboveScoreThreshold(const T* values, int stride, int size,
+                                        const ScoreThreshold<T> threshold,
+                                        T* keep_values, int* keep_indices) {
+  int counter = 0;
+  for (int i = 0; i < size; i++) {
+    const T value = values[i * stride];
+    if (value >= threshold) {
+      keep_values[counter] = value;
+      keep_indices[counter] = i;
+      counter++;
     }
   }
-  memcpy(values, scratch, num_values * sizeof(int));
+  return counter;
 }
 
-template <typename Compare>
-void MergeSort(int* values, int* scratch, const int num_values,
-               Compare compare) {
-  constexpr int threshold = 20;
-
-  if (num_values < threshold) {
-    InsertionSort(values, values + num_values, compare);
-    return;
+// Highest of the num_values (> 0) class scores of one anchor.
+template <typename T>
+T MaxScore(const T* values, int num_values) {
+  T max_value = values[0];
+  for (int i = 1; i < num_values; ++i) {
+    max_value = std::max(max_value, values[i]);
   }
-
-  const int half_num_values = num_values / 2;
-
-  MergeSort(values, scratch, half_num_values, compare);
-  MergeSort(values + half_num_values, scratch, num_values - half_num_values,
-            compare);
-  TopDownMerge(values, scratch, half_num_values, num_values, compare);
+  return max_value;
 }
 
-void DecreasingArgSort(const float* values, int num_values, int* indices,
-                       int* scratch) {
-  std::iota(indices, indices + num_values, 0);
-
-  MergeSort(indices, scratch, num_values, [&values](const int i, const int j) {
-    return values[i] > values[j];
-  });
-}
-
-int SelectDetectionsAboveScoreThreshold(const float* values, int size,
-                                        const float threshold,
-                                        float* keep_values, int* keep_indices) {
-  int counter = 0;
-  for (int i = 0; i < size; i++) {
-    if (values[i] >= threshold) {
-      keep_values[counter] = values[i];
-      keep_indices[counter] = i;
-      counter++;
+#if defined(__ARM_NEON)
+template <>
+uint8_t MaxScore<uint8_t>(const uint8_t* values, int num_values) {
+  if (num_values < 16) {
+    uint8_t max_value = values[0];
+    for (int i = 1; i < num_values; ++i) {
+      max_value = std::max(max_value, values[i]);
     }
+    return max_value;
   }
-  return counter;
+  uint8x16_t max16 = vld1q_u8(values);
+  int i = 16;
+  for (; i + 16 <= num_values; i += 16) {
+    max16 = vmaxq_u8(max16, vld1q_u8(values + i));
+  }
+  uint8x8_t max8 = vmax_u8(vget_low_u8(max16), vget_high_u8(max16));
+  max8 = vpmax_u8(max8, max8);
+  max8 = vpmax_u8(max8, max8);
+  max8 = vpmax_u8(max8, max8);
+  uint8_t max_value = vget_lane_u8(max8, 0);
+  for (; i < num_values; ++i) {
+    max_value = std::max(max_value, values[i]);
+  }
+  return max_value;
 }
 
-bool ValidateBoxes(const float* decoded_boxes, const int num_boxes) {
-  for (int i = 0; i < num_boxes; ++i) {
-    // ymax>=ymin, xmax>=xmin
-    auto& box = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
-    if (box.ymin >= box.ymax || box.xmin >= box.xmax) {
-      return false;
+template <>
+int8_t MaxScore<int8_t>(const int8_t* values, int num_values) {
+  if (num_values < 16) {
+    int8_t max_value = values[0];
+    for (int i = 1; i < num_values; ++i) {
+      max_value = std::max(max_value, values[i]);
     }
+    return max_value;
+  }
+  int8x16_t max16 = vld1q_s8(values);
+  int i = 16;
+  for (; i + 16 <= num_values; i += 16) {
+    max16 = vmaxq_s8(max16, vld1q_s8(values + i));
   }
-  return true;
+  int8x8_t max8 = vmax_s8(vget_low_s8(max16), vget_high_s8(max16));
+  max8 = vpmax_s8(max8, max8);
+  max8 = vpmax_s8(max8, max8);
+  max8 = vpmax_s8(max8, max8);
+  int8_t max_value = vget_lane_s8(max8, 0);
+  for (; i < num_values; ++i) {
+    max_value = std::max(max_value, values[i]);
+  }
+  return max_value;
 }
-
-float ComputeIntersectionOverUnion(const float* decoded_boxes, const int i,
-                                   const int j) {
-  auto& box_i = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[i];
-  auto& box_j = reinterpret_cast<const BoxCornerEncoding*>(decoded_boxes)[j];
-  const float area_i = (box_i.ymax - box_i.ymin) * (box_i.xmax - box_i.xmin);
-  const float area_j = (box_j.ymax - box_j.ymin) * (box_j.xmax - box_j.xmin);
-  if (area_i <= 0 || area_j <= 0) return 0.0;
-  const float intersection_ymin = std::max<float>(box_i.ymin, box_j.ymin);
-  const float intersection_xmin = std::max<float>(box_i.xmin, box_j.xmin);
-  const float intersection_ymax = std::min<float>(box_i.ymax, box_j.ymax);
-  const float intersection_xmax = std::min<float>(box_i.xmax, box_j.xmax);
-  const float intersection_area =
-      std::max<float>(intersection_ymax - intersection_ymin, 0.0) *
-      std::max<float>(intersection_xmax - intersection_xmin, 0.0);
-  return intersection_area / (area_i + area_j - intersection_area);
+#endif  // defined(__ARM_NEON)
+
+// Whether box j of `boxes` has an intersection over union above `threshold`
+// with any of the first `count` boxes of `others`. Boxes with no area
+// overlap nothing. The IoU test is intersection > threshold * union, which
+// needs no division.
+bool OverlapsAny(const BoxStore& others, int count, const BoxStore& boxes,
+                 int j, float threshold) {
+  const float ymin = boxes.ymin[j];
+  const float xmin = boxes.xmin[j];
+  const float ymax = boxes.ymax[j];
+  const float xmax = boxes.xmax[j];
+  const float area = boxes.area[j];
+  if (area <= 0) return false;
+  int i = 0;
+#if defined(__ARM_NEON)
+  const float32x4_t ymin4 = vdupq_n_f32(ymin);
+  const float32x4_t xmin4 = vdupq_n_f32(xmin);
+  const float32x4_t ymax4 = vdupq_n_f32(ymax);
+  const float32x4_t xmax4 = vdupq_n_f32(xmax);
+  const float32x4_t area4 = vdupq_n_f32(area);
+  const float32x4_t threshold4 = vdupq_n_f32(threshold);
+  const float32x4_t zero4 = vdupq_n_f32(0.0f);
+  for (; i + 4 <= count; i += 4) {
+    const float32x4_t height = vmaxq_f32(
+        vsubq_f32(vminq_f32(vld1q_f32(others.ymax + i), ymax4),
+                  vmaxq_f32(vld1q_f32(others.ymin + i), ymin4)),
+        zero4);
+    const float32x4_t width = vmaxq_f32(
+        vsubq_f32(vminq_f32(vld1q_f32(others.xmax + i), xmax4),
+                  vmaxq_f32(vld1q_f32(others.xmin + i), xmin4)),
+        zero4);
+    const float32x4_t intersection = vmulq_f32(height, width);
+    const float32x4_t other_area = vld1q_f32(others.area + i);
+    const float32x4_t union_area =
+        vsubq_f32(vaddq_f32(other_area, area4), intersection);
+    const uint32x4_t overlaps =
+        vandq_u32(vcgtq_f32(intersection, vmulq_f32(threshold4, union_area)),
+                  vcgtq_f32(other_area, zero4));
+    uint32x2_t any = vorr_u32(vget_low_u32(overlaps), vget_high_u32(overlaps));
+    any = vpmax_u32(any, any);
+    if (vget_lane_u32(any, 0) != 0) return true;
+  }
+#endif  // defined(__ARM_NEON)
+  for (; i < count; ++i) {
+    const float height =
+        std::max<float>(std::min(others.ymax[i], ymax) -
+                            std::max(others.ymin[i], ymin),
+                        0.0f);
+    const float width =
+        std::max<float>(std::min(others.xmax[i], xmax) -
+                            std::max(others.xmin[i], xmin),
+                        0.0f);
+    const float intersection = height * width;
+    const float union_area = others.area[i] + area - intersection;
+    if (others.area[i] > 0 && intersection > threshold * union_area) {
+      return true;
+    }
+  }
+  return false;
 }
 
 // NonMaxSuppressionSingleClass() prunes out the box locations with high overlap
-// before selecting the highest scoring boxes (max_detections in number)
-// It assumes all boxes are good in beginning and sorts based on the scores.
-// If lower-scoring box has too much overlap with a higher-scoring box,
-// we get rid of the lower-scoring box.
-// Complexity is O(N^2) pairwise comparison between boxes
+// before selecting the highest scoring boxes (max_detections in number).
+// The scores are scores[i * stride] for each box i. Boxes scoring below the
+// threshold are rejected first; the others go into a max-heap, which is
+// popped in decreasing score order only until max_detections boxes are
+// selected. A popped box is selected unless it overlaps a box selected
+// before it by more than the IoU threshold, which gives the same boxes as
+// suppressing all lower-scoring boxes against each selected one. The
+// selected boxes are copied to their own store, so each popped box is
+// tested against all of them in one OverlapsAny() call.
+// Complexity is O(N) for the threshold, then O(log N) plus one IoU per
+// selected box for each popped box.
+template <typename T>
 TfLiteStatus NonMaxSuppressionSingleClassHelper(
-    TfLiteContext* context, TfLiteNode* node, OpData* op_data,
-    const float* scores, int* selected, int* selected_size,
-    int max_detections) {
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data, const T* scores,
+    int stride, int* selected, int* selected_size, int max_detections) {
   const TfLiteEvalTensor* input_box_encodings =
       tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
   const int num_boxes = input_box_encodings->dims->data[1];
-  const float non_max_suppression_score_threshold =
-      op_data->non_max_suppression_score_threshold;
+  const ScoreThreshold<T> non_max_suppression_score_threshold =
+      GetScoreThreshold<T>(op_data);
   const float intersection_over_union_threshold =
       op_data->intersection_over_union_threshold;
   // Maximum detections should be positive.
@@ -437,65 +803,47 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
   // and should be less than 1.
   TF_LITE_ENSURE(context, (intersection_over_union_threshold > 0.0f) &&
                               (intersection_over_union_threshold <= 1.0f));
-  // Validate boxes
-  float* decoded_boxes = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
-
-  TF_LITE_ENSURE(context, ValidateBoxes(decoded_boxes, num_boxes));
+  // Boxes were decoded, and validated, for every score passing the threshold.
+  const BoxStore boxes(
+      reinterpret_cast<float*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx)),
+      num_boxes);
 
   // threshold scores
   int* keep_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->keep_indices_idx));
-  float* keep_scores = reinterpret_cast<float*>(
+  T* keep_scores = reinterpret_cast<T*>(
       context->GetScratchBuffer(context, op_data->keep_scores_idx));
-  int num_scores_kept = SelectDetectionsAboveScoreThreshold(
-      scores, num_boxes, non_max_suppression_score_threshold, keep_scores,
-      keep_indices);
-  int* sorted_indices = reinterpret_cast<int*>(
-      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  const int num_scores_kept = SelectDetectionsAboveScoreThreshold(
+      scores, stride, num_boxes, non_max_suppression_score_threshold,
+      keep_scores, keep_indices);
 
-  // Reusing keep_indices for scratch buffer and write back its values
-  // after the sorting is done.
-  DecreasingArgSort(keep_scores, num_scores_kept, sorted_indices, keep_indices);
-  int counter = 0;
-  for (int i = 0; i < num_boxes; i++) {
-    if (scores[i] >= non_max_suppression_score_threshold) {
-      keep_indices[counter] = i;
-      counter++;
-    }
-  }
-
-  const int num_boxes_kept = num_scores_kept;
-  const int output_size = std::min(num_boxes_kept, max_detections);
+  // Heap of positions in keep_scores. Equal scores come out in box order, as
+  // a stable sort would give them.
+  int* heap = reinterpret_cast<int*>(
+      context->GetScratchBuffer(context, op_data->sorted_indices_idx));
+  auto lower_priority = [keep_scores](const int i, const int j) {
+    return std::tie(keep_scores[i], j) < std::tie(keep_scores[j], i);
+  };
+  std::iota(heap, heap + num_scores_kept, 0);
+  std::make_heap(heap, heap + num_scores_kept, lower_priority);
+  int heap_size = num_scores_kept;
+
+  const int output_size = std::min(num_scores_kept, max_detections);
+  TF_LITE_ENSURE(context, output_size <= op_data->max_selected);
+  BoxStore selected_boxes(
+      reinterpret_cast<float*>(
+          context->GetScratchBuffer(context, op_data->selected_boxes_idx)),
+      op_data->max_selected);
   *selected_size = 0;
 
-  int num_active_candidate = num_boxes_kept;
-  uint8_t* active_box_candidate = reinterpret_cast<uint8_t*>(
-      context->GetScratchBuffer(context, op_data->active_candidate_idx));
-
-  for (int row = 0; row < num_boxes_kept; row++) {
-    active_box_candidate[row] = 1;
-  }
-  for (int i = 0; i < num_boxes_kept; ++i) {
-    if (num_active_candidate == 0 || *selected_size >= output_size) break;
-    if (active_box_candidate[i] == 1) {
-      selected[(*selected_size)++] = keep_indices[sorted_indices[i]];
-      active_box_candidate[i] = 0;
-      num_active_candidate--;
-    } else {
-      continue;
-    }
-    for (int j = i + 1; j < num_boxes_kept; ++j) {
-      if (active_box_candidate[j] == 1) {
-        float intersection_over_union = ComputeIntersectionOverUnion(
-            decoded_boxes, keep_indices[sorted_indices[i]],
-            keep_indices[sorted_indices[j]]);
-
-        if (intersection_over_union > intersection_over_union_threshold) {
-          active_box_candidate[j] = 0;
-          num_active_candidate--;
-        }
-      }
+  while (heap_size > 0 && *selected_size < output_size) {
+    std::pop_heap(heap, heap + heap_size, lower_priority);
+    const int candidate = keep_indices[heap[--heap_size]];
+    if (!OverlapsAny(selected_boxes, *selected_size, boxes, candidate,
+                     intersection_over_union_threshold)) {
+      selected_boxes.Copy(*selected_size, boxes, candidate);
+      selected[(*selected_size)++] = candidate;
     }
   }
 
@@ -509,12 +857,10 @@ TfLiteStatus NonMaxSuppressionSingleClassHelper(
 // 3) The worst runtime of the regular NMS is O(K*N^2)
 // where N is the number of anchors and K the number of
 // classes.
-TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
-                                                      TfLiteNode* node,
-                                                      OpData* op_data,
-                                                      const float* scores) {
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data, const T* scores,
+    const Dequantizer<T>& dequantize) {
   const TfLiteEvalTensor* input_class_predictions =
       tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
   TfLiteEvalTensor* detection_boxes =
@@ -526,7 +872,6 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   TfLiteEvalTensor* num_detections =
       tflite::micro::GetEvalOutput(context, node, kOutputTensorNumDetections);
 
-  const int num_boxes = input_box_encodings->dims->data[1];
   const int num_classes = op_data->num_classes;
   const int num_detections_per_class = op_data->detections_per_class;
   const int max_detections = op_data->max_detections;
@@ -537,33 +882,28 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   TF_LITE_ENSURE(context, num_detections_per_class > 0);
 
   // For each class, perform non-max suppression.
-  float* class_scores = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->score_buffer_idx));
   int* box_indices_after_regular_non_max_suppression = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
-  float* scores_after_regular_non_max_suppression =
-      reinterpret_cast<float*>(context->GetScratchBuffer(
+  T* scores_after_regular_non_max_suppression =
+      reinterpret_cast<T*>(context->GetScratchBuffer(
           context, op_data->scores_after_regular_non_max_suppression_idx));
 
   int size_of_sorted_indices = 0;
   int* sorted_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->sorted_indices_idx));
-  float* sorted_values = reinterpret_cast<float*>(
+  T* sorted_values = reinterpret_cast<T*>(
       context->GetScratchBuffer(context, op_data->sorted_values_idx));
 
   for (int col = 0; col < num_classes; col++) {
-    for (int row = 0; row < num_boxes; row++) {
-      // Get scores of boxes corresponding to all anchors for single class
-      class_scores[row] =
-          *(scores + row * num_classes_with_background + col + label_offset);
-    }
+    // Scores of boxes corresponding to all anchors for single class
+    const T* class_scores = scores + col + label_offset;
     // Perform non-maximal suppression on single class
     int selected_size = 0;
     int* selected = reinterpret_cast<int*>(
         context->GetScratchBuffer(context, op_data->selected_idx));
     TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-        context, node, op_data, class_scores, selected, &selected_size,
-        num_detections_per_class));
+        context, node, op_data, class_scores, num_classes_with_background,
+        selected, &selected_size, num_detections_per_class));
     // Add selected indices from non-max suppression of boxes in this class
     int output_index = size_of_sorted_indices;
     for (int i = 0; i < selected_size; i++) {
@@ -572,7 +912,7 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
       box_indices_after_regular_non_max_suppression[output_index] =
           (selected_index * num_classes_with_background + col + label_offset);
       scores_after_regular_non_max_suppression[output_index] =
-          class_scores[selected_index];
+          class_scores[selected_index * num_classes_with_background];
       output_index++;
     }
     // Sort the max scores among the selected indices
@@ -596,6 +936,10 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
   }
 
   // Allocate output tensors
+  const BoxStore decoded_boxes(
+      reinterpret_cast<float*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx)),
+      input_class_predictions->dims->data[1]);
   for (int output_box_index = 0; output_box_index < max_detections;
        output_box_index++) {
     if (output_box_index < size_of_sorted_indices) {
@@ -605,13 +949,11 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
       const int class_index =
           box_indices_after_regular_non_max_suppression[output_box_index] -
           anchor_index * num_classes_with_background - label_offset;
-      const float selected_score =
-          scores_after_regular_non_max_suppression[output_box_index];
+      const float selected_score = dequantize(
+          scores_after_regular_non_max_suppression[output_box_index]);
       // detection_boxes
-      float* decoded_boxes = reinterpret_cast<float*>(
-          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
       ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[output_box_index] =
-          reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[anchor_index];
+          decoded_boxes.Get(anchor_index);
       // detection_classes
       tflite::micro::GetTensorData<float>(detection_classes)[output_box_index] =
           class_index;
@@ -642,12 +984,10 @@ TfLiteStatus NonMaxSuppressionMultiClassRegularHelper(TfLiteContext* context,
 // 3) Compared to standard NMS, the worst runtime of this version is O(N^2)
 // instead of O(KN^2) where N is the number of anchors and K the number of
 // classes.
-TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
-                                                   TfLiteNode* node,
-                                                   OpData* op_data,
-                                                   const float* scores) {
-  const TfLiteEvalTensor* input_box_encodings =
-      tflite::micro::GetEvalInput(context, node, kInputTensorBoxEncodings);
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClassFastHelper(
+    TfLiteContext* context, TfLiteNode* node, OpData* op_data, const T* scores,
+    const T* max_scores, const Dequantizer<T>& dequantize) {
   const TfLiteEvalTensor* input_class_predictions =
       tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
   TfLiteEvalTensor* detection_boxes =
@@ -660,7 +1000,6 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   TfLiteEvalTensor* num_detections =
       tflite::micro::GetEvalOutput(context, node, kOutputTensorNumDetections);
 
-  const int num_boxes = input_box_encodings->dims->data[1];
   const int num_classes = op_data->num_classes;
   const int max_categories_per_anchor = op_data->max_classes_per_detection;
   const int num_classes_with_background =
@@ -671,47 +1010,40 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   TF_LITE_ENSURE(context, (max_categories_per_anchor > 0));
   const int num_categories_per_anchor =
       std::min(max_categories_per_anchor, num_classes);
-  float* max_scores = reinterpret_cast<float*>(
-      context->GetScratchBuffer(context, op_data->score_buffer_idx));
-  int* sorted_class_indices = reinterpret_cast<int*>(
+  int* class_indices = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->buffer_idx));
 
-  for (int row = 0; row < num_boxes; row++) {
-    const float* box_scores =
-        scores + row * num_classes_with_background + label_offset;
-    int* class_indices = sorted_class_indices + row * num_classes;
-    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
-                             class_indices);
-    max_scores[row] = box_scores[class_indices[0]];
-  }
-
   // Perform non-maximal suppression on max scores
   int selected_size = 0;
   int* selected = reinterpret_cast<int*>(
       context->GetScratchBuffer(context, op_data->selected_idx));
   TF_LITE_ENSURE_STATUS(NonMaxSuppressionSingleClassHelper(
-      context, node, op_data, max_scores, selected, &selected_size,
+      context, node, op_data, max_scores, 1, selected, &selected_size,
       op_data->max_detections));
 
   // Allocate output tensors
+  const BoxStore decoded_boxes(
+      reinterpret_cast<float*>(
+          context->GetScratchBuffer(context, op_data->decoded_boxes_idx)),
+      input_class_predictions->dims->data[1]);
   int output_box_index = 0;
 
   for (int i = 0; i < selected_size; i++) {
     int selected_index = selected[i];
 
-    const float* box_scores =
+    const T* box_scores =
         scores + selected_index * num_classes_with_background + label_offset;
-    const int* class_indices =
-        sorted_class_indices + selected_index * num_classes;
+    // Only the selected anchors need their classes ranked.
+    DecreasingPartialArgSort(box_scores, num_classes, num_categories_per_anchor,
+                             class_indices);
 
     for (int col = 0; col < num_categories_per_anchor; ++col) {
-      int box_offset = num_categories_per_anchor * output_box_index + col;
+      // Each category takes the next output slot.
+      const int box_offset = output_box_index;
 
       // detection_boxes
-      float* decoded_boxes = reinterpret_cast<float*>(
-          context->GetScratchBuffer(context, op_data->decoded_boxes_idx));
       ReInterpretTensor<BoxCornerEncoding*>(detection_boxes)[box_offset] =
-          reinterpret_cast<BoxCornerEncoding*>(decoded_boxes)[selected_index];
+          decoded_boxes.Get(selected_index);
 
       // detection_classes
       tflite::micro::GetTensorData<float>(detection_classes)[box_offset] =
@@ -719,7 +1051,7 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
 
       // detection_scores
       tflite::micro::GetTensorData<float>(detection_scores)[box_offset] =
-          box_scores[class_indices[col]];
+          dequantize(box_scores[class_indices[col]]);
 
       output_box_index++;
     }
@@ -729,6 +1061,39 @@ TfLiteStatus NonMaxSuppressionMultiClassFastHelper(TfLiteContext* context,
   return kTfLiteOk;
 }
 
+template <typename T>
+TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
+                                         TfLiteNode* node, OpData* op_data) {
+  const TfLiteEvalTensor* input_class_predictions =
+      tflite::micro::GetEvalInput(context, node, kInputTensorClassPredictions);
+  const T* scores = tflite::micro::GetTensorData<T>(input_class_predictions);
+  const Dequantizer<T> dequantize(op_data->input_class_predictions);
+  const int num_boxes = input_class_predictions->dims->data[1];
+  const int num_classes_with_background =
+      input_class_predictions->dims->data[2];
+  // The row index offset is 1 if background class is included and 0 otherwise.
+  const int label_offset = num_classes_with_background - op_data->num_classes;
+
+  // An anchor is a candidate in some class only if its best score passes the
+  // threshold, so only those anchors have their boxes decoded.
+  T* max_scores = reinterpret_cast<T*>(
+      context->GetScratchBuffer(context, op_data->score_buffer_idx));
+  for (int row = 0; row < num_boxes; row++) {
+    max_scores[row] =
+        MaxScore(scores + row * num_classes_with_background + label_offset,
+                 op_data->num_classes);
+  }
+  TF_LITE_ENSURE_STATUS(
+      DecodeCandidateBoxes(context, node, op_data, max_scores));
+
+  if (op_data->use_regular_non_max_suppression) {
+    return NonMaxSuppressionMultiClassRegularHelper(context, node, op_data,
+                                                    scores, dequantize);
+  }
+  return NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores,
+                                               max_scores, dequantize);
+}
+
 TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
                                          TfLiteNode* node, OpData* op_data) {
   // Get the input tensors
@@ -748,44 +1113,27 @@ TfLiteStatus NonMaxSuppressionMultiClass(TfLiteContext* context,
   TF_LITE_ENSURE(context, (num_classes_with_background - num_classes <= 1));
   TF_LITE_ENSURE(context, (num_classes_with_background >= num_classes));
 
-  const float* scores;
   switch (input_class_predictions->type) {
     case kTfLiteFloat32:
-      scores = tflite::micro::GetTensorData<float>(input_class_predictions);
-      break;
+      return NonMaxSuppressionMultiClass<float>(context, node, op_data);
+    case kTfLiteUInt8:
+      return NonMaxSuppressionMultiClass<uint8_t>(context, node, op_data);
+    case kTfLiteInt8:
+      return NonMaxSuppressionMultiClass<int8_t>(context, node, op_data);
     default:
       // Unsupported type.
       return kTfLiteError;
   }
-
-  if (op_data->use_regular_non_max_suppression) {
-    TF_LITE_ENSURE_STATUS(NonMaxSuppressionMultiClassRegularHelper(
-        context, node, op_data, scores));
-  } else {
-    TF_LITE_ENSURE_STATUS(
-        NonMaxSuppressionMultiClassFastHelper(context, node, op_data, scores));
-  }
-
-  return kTfLiteOk;
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE(context, (kBatchSize == 1));
   auto* op_data = static_cast<OpData*>(node->user_data);
 
-  // These two functions correspond to two blocks in the Object Detection model.
-  // In future, we would like to break the custom op in two blocks, which is
-  // currently not feasible because we would like to input quantized inputs
-  // and do all calculations in float. Mixed quantized/float calculations are
-  // currently not supported in TFLite.
-
-  // This fills in temporary decoded_boxes
-  // by transforming input_box_encodings and input_anchors from
-  // CenterSizeEncodings to BoxCornerEncoding
-  TF_LITE_ENSURE_STATUS(DecodeCenterSizeBoxes(context, node, op_data));
-
-  // This fills in the output tensors
-  // by choosing effective set of decoded boxes
+  // This fills in temporary decoded_boxes, for the anchors with a score
+  // passing the threshold, by transforming input_box_encodings and
+  // input_anchors from CenterSizeEncodings to BoxCornerEncoding, then the
+  // output tensors by choosing effective set of decoded boxes
   // based on Non Maximal Suppression, i.e. selecting
   // highest scoring non-overlapping boxes.
   TF_LITE_ENSURE_STATUS(NonMaxSuppressionMultiClass(context, node, op_data));
@@ -116,6 +116,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       tflite::micro::GetEvalOutput(context, node, kOutputTensor);
   const int flat_size = ElementCount(*input->dims);
 
+  // Do nothing for in-place expand_dims.
+  if (input->data.raw == output->data.raw) {
+    return kTfLiteOk;
+  }
+
   switch (input->type) {
     case kTfLiteFloat32: {
       memCopyN(tflite::micro::GetTensorData<float>(output),
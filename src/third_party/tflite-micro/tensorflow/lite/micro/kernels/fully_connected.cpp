@@ -18,9 +18,9 @@ limitations under the License.
 #include "tensorflow/lite/c/builtin_op_data.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/optimized/integer_ops/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/quantization_util.h"
 #include "tensorflow/lite/kernels/internal/reference/fully_connected.h"
-#include "tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h"
 #include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
 #include "tensorflow/lite/kernels/kernel_util.h"
 #include "tensorflow/lite/micro/kernels/kernel_util.h"
@@ -28,17 +28,125 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+struct OpData {
+  OpDataFullyConnected reference_op_data;
+  // Constant int8 and uint8 weights (with a constant or no bias) are packed
+  // once in Prepare by optimized_integer_ops::PackFilter(), in persistent
+  // memory and of the weights' type, with the bias the input offset is
+  // folded into. nullptr otherwise.
+  void* packed_filter;
+  int32_t* effective_bias;
+  // The per-tensor output multiplier and shift repeated for every output
+  // channel of an int8 or uint8 node, as the GEMM takes them per channel.
+  int32_t* per_channel_output_multiplier;
+  int32_t* per_channel_output_shift;
+};
+
 void* Init(TfLiteContext* context, const char* buffer, size_t length) {
   TFLITE_DCHECK(context->AllocatePersistentBuffer != nullptr);
-  return context->AllocatePersistentBuffer(context,
-                                           sizeof(OpDataFullyConnected));
+  return context->AllocatePersistentBuffer(context, sizeof(OpData));
+}
+
+// Repeats the per-tensor output multiplier and shift of an int8 or uint8
+// node for every output channel.
+TfLiteStatus SetPerChannelQuantization(TfLiteContext* context,
+                                       const TfLiteTensor* output,
+                                       OpData* data) {
+  data->per_channel_output_multiplier = nullptr;
+  data->per_channel_output_shift = nullptr;
+  if (output->type != kTfLiteInt8 && output->type != kTfLiteUInt8) {
+    return kTfLiteOk;
+  }
+  const int output_depth =
+      SizeOfDimension(output, NumDimensions(output) - 1);
+  data->per_channel_output_multiplier =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, output_depth * sizeof(int32_t)));
+  data->per_channel_output_shift =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->per_channel_output_multiplier != nullptr &&
+                              data->per_channel_output_shift != nullptr);
+  for (int c = 0; c < output_depth; ++c) {
+    data->per_channel_output_multiplier[c] =
+        data->reference_op_data.output_multiplier;
+    data->per_channel_output_shift[c] = data->reference_op_data.output_shift;
+  }
+  return kTfLiteOk;
+}
+
+// Packs the weights of an int8 or uint8 node for FullyConnectedPacked(), if
+// they are constant.
+template <typename T>
+TfLiteStatus PackWeights(TfLiteContext* context, const TfLiteTensor* filter,
+                         const TfLiteTensor* bias, const TfLiteTensor* output,
+                         OpData* data) {
+  if (!IsConstantTensor(filter) ||
+      (bias != nullptr && !IsConstantTensor(bias)) ||
+      NumDimensions(output) != 2) {
+    return kTfLiteOk;
+  }
+  const int filter_dims = NumDimensions(filter);
+  const int output_depth = SizeOfDimension(output, 1);
+  const int accum_depth = SizeOfDimension(filter, filter_dims - 1);
+  TF_LITE_ENSURE(context, filter_dims >= 2 &&
+                              output_depth <=
+                                  SizeOfDimension(filter, filter_dims - 2));
+
+  data->packed_filter = context->AllocatePersistentBuffer(
+      context,
+      optimized_integer_ops::PackedFilterBytes(output_depth, accum_depth));
+  data->effective_bias =
+      static_cast<int32_t*>(context->AllocatePersistentBuffer(
+          context, output_depth * sizeof(int32_t)));
+  TF_LITE_ENSURE(context, data->packed_filter != nullptr &&
+                              data->effective_bias != nullptr);
+  optimized_integer_ops::PackFilter(
+      GetTensorData<T>(filter), output_depth, accum_depth,
+      bias != nullptr ? GetTensorData<int32_t>(bias) : nullptr,
+      -data->reference_op_data.input_zero_point,
+      -data->reference_op_data.filter_zero_point,
+      static_cast<T*>(data->packed_filter), data->effective_bias);
+  return kTfLiteOk;
+}
+
+// Runs an int8 or uint8 node on the GEMM, from the packed weights if there
+// are any.
+template <typename T>
+void EvalQuantized(const OpData& op_data, const TfLiteEvalTensor* input,
+                   const TfLiteEvalTensor* filter,
+                   const TfLiteEvalTensor* bias, TfLiteEvalTensor* output) {
+  const FullyConnectedParams op_params =
+      FullyConnectedParamsQuantized(op_data.reference_op_data);
+  if (op_data.packed_filter != nullptr) {
+    optimized_integer_ops::FullyConnectedPacked(
+        op_params, op_data.per_channel_output_multiplier,
+        op_data.per_channel_output_shift,
+        tflite::micro::GetTensorShape(input),
+        tflite::micro::GetTensorData<T>(input),
+        tflite::micro::GetTensorShape(filter),
+        static_cast<const T*>(op_data.packed_filter), op_data.effective_bias,
+        tflite::micro::GetTensorShape(output),
+        tflite::micro::GetTensorData<T>(output));
+    return;
+  }
+  optimized_integer_ops::FullyConnected(
+      op_params, op_data.per_channel_output_multiplier,
+      op_data.per_channel_output_shift, tflite::micro::GetTensorShape(input),
+      tflite::micro::GetTensorData<T>(input),
+      tflite::micro::GetTensorShape(filter),
+      tflite::micro::GetTensorData<T>(filter),
+      tflite::micro::GetTensorShape(bias),
+      bias != nullptr ? tflite::micro::GetTensorData<int32_t>(bias) : nullptr,
+      tflite::micro::GetTensorShape(output),
+      tflite::micro::GetTensorData<T>(output));
 }
 
 TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TFLITE_DCHECK(node->user_data != nullptr);
   TFLITE_DCHECK(node->builtin_data != nullptr);
 
-  auto* data = static_cast<OpDataFullyConnected*>(node->user_data);
+  auto* data = static_cast<OpData*>(node->user_data);
   const auto params =
       static_cast<const TfLiteFullyConnectedParams*>(node->builtin_data);
 
@@ -57,8 +165,20 @@ TfLiteStatus Prepare(TfLiteContext* context, TfLiteNode* node) {
   TF_LITE_ENSURE_MSG(context, input->type == filter->type,
                      "Hybrid models are not supported on TFLite Micro.");
 
-  return CalculateOpDataFullyConnected(context, params->activation, input->type,
-                                       input, filter, bias, output, data);
+  TF_LITE_ENSURE_STATUS(CalculateOpDataFullyConnected(
+      context, params->activation, input->type, input, filter, bias, output,
+      &data->reference_op_data));
+  TF_LITE_ENSURE_STATUS(SetPerChannelQuantization(context, output, data));
+  data->packed_filter = nullptr;
+  data->effective_bias = nullptr;
+  switch (filter->type) {
+    case kTfLiteInt8:
+      return PackWeights<int8_t>(context, filter, bias, output, data);
+    case kTfLiteUInt8:
+      return PackWeights<uint8_t>(context, filter, bias, output, data);
+    default:
+      return kTfLiteOk;
+  }
 }
 
 TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
@@ -76,8 +196,7 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       tflite::micro::GetEvalOutput(context, node, kFullyConnectedOutputTensor);
 
   TFLITE_DCHECK(node->user_data != nullptr);
-  const auto& data =
-      *(static_cast<const OpDataFullyConnected*>(node->user_data));
+  const OpData& op_data = *(static_cast<const OpData*>(node->user_data));
 
   // Checks in Prepare ensure input, output and filter types are all the same.
   switch (input->type) {
@@ -97,22 +216,13 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
       break;
     }
 
-    case kTfLiteInt8: {
-      const int32_t* bias_data =
-          nullptr != bias ? tflite::micro::GetTensorData<int32_t>(bias)
-                          : nullptr;
+    case kTfLiteInt8:
+      EvalQuantized<int8_t>(op_data, input, filter, bias, output);
+      break;
 
-      tflite::reference_integer_ops::FullyConnected(
-          FullyConnectedParamsQuantized(data),
-          tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<int8_t>(input),
-          tflite::micro::GetTensorShape(filter),
-          tflite::micro::GetTensorData<int8_t>(filter),
-          tflite::micro::GetTensorShape(bias), bias_data,
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
+    case kTfLiteUInt8:
+      EvalQuantized<uint8_t>(op_data, input, filter, bias, output);
       break;
-    }
 
     default: {
       TF_LITE_KERNEL_LOG(context, "Type %s (%d) not supported.",
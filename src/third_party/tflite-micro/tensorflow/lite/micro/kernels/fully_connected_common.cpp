@@ -65,11 +65,10 @@ TfLiteStatus CalculateOpDataFullyConnected(
                        &data->output_shift);
 
     data->input_zero_point = input->params.zero_point;
-    // Filter weights will always be symmetric quantized since we only support
-    // int8 quantization. See
+    // int8 filter weights will always be symmetric quantized. See
     // https://github.com/tensorflow/tensorflow/issues/44912 for additional
-    // context.
-    TFLITE_DCHECK(filter->params.zero_point == 0);
+    // context. uint8 weights are asymmetric and carry their own zero point.
+    TFLITE_DCHECK(data_type == kTfLiteUInt8 || filter->params.zero_point == 0);
     data->filter_zero_point = filter->params.zero_point;
     data->output_zero_point = output->params.zero_point;
 
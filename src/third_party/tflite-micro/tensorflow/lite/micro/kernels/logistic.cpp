@@ -35,6 +35,15 @@ void* LogisticInit(TfLiteContext* context, const char* buffer, size_t length) {
   return context->AllocatePersistentBuffer(context, sizeof(OpDataLogistic));
 }
 
+template <typename T>
+void LogisticLookup(const uint8_t* table, int size, const T* input_data,
+                    T* output_data) {
+  for (int i = 0; i < size; ++i) {
+    output_data[i] =
+        static_cast<T>(table[static_cast<uint8_t>(input_data[i])]);
+  }
+}
+
 TfLiteStatus LogisticEval(TfLiteContext* context, TfLiteNode* node) {
   const TfLiteEvalTensor* input =
       tflite::micro::GetEvalInput(context, node, kLogisticInputTensor);
@@ -75,23 +84,23 @@ TfLiteStatus LogisticEval(TfLiteContext* context, TfLiteNode* node) {
                     TfLiteTypeGetName(output->type));
         return kTfLiteError;
     }
-  } else if (input->type == kTfLiteInt8) {
-    switch (output->type) {
-      case kTfLiteInt8: {
-        reference_integer_ops::Logistic(
-            data->input_zero_point, data->input_range_radius,
-            data->input_multiplier, data->input_left_shift,
-            NumElements(input->dims),
-            tflite::micro::GetTensorData<int8_t>(input),
-            tflite::micro::GetTensorData<int8_t>(output));
-        return kTfLiteOk;
-      }
-      default:
-        MicroPrintf("Input %s, output %s not supported.",
-                    TfLiteTypeGetName(input->type),
-                    TfLiteTypeGetName(output->type));
-        return kTfLiteError;
+  } else if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) {
+    if (output->type != input->type) {
+      MicroPrintf("Input %s, output %s not supported.",
+                  TfLiteTypeGetName(input->type),
+                  TfLiteTypeGetName(output->type));
+      return kTfLiteError;
+    }
+    if (input->type == kTfLiteInt8) {
+      LogisticLookup(data->table, NumElements(input->dims),
+                     tflite::micro::GetTensorData<int8_t>(input),
+                     tflite::micro::GetTensorData<int8_t>(output));
+    } else {
+      LogisticLookup(data->table, NumElements(input->dims),
+                     tflite::micro::GetTensorData<uint8_t>(input),
+                     tflite::micro::GetTensorData<uint8_t>(output));
     }
+    return kTfLiteOk;
   } else {
     // TODO(b/141211002): Also support other data types once we have supported
     // temporary tensors in TFLM.
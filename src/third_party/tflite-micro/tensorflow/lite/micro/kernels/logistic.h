@@ -30,6 +30,8 @@ struct OpDataLogistic {
   int32_t input_range_radius;
   int32_t input_multiplier;
   int input_left_shift;
+  // For 8-bit inputs: 256 output bytes indexed by the raw input byte.
+  uint8_t* table;
 };
 
 TfLiteStatus CalculateArithmeticOpDataLogistic(TfLiteContext* context,
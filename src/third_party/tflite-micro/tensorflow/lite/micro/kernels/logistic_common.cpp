@@ -29,6 +29,10 @@ namespace tflite {
 const int kLogisticInputTensor = 0;
 const int kLogisticOutputTensor = 0;
 
+namespace {
+constexpr int kLogisticTableSize = 256;
+}  // namespace
+
 TfLiteStatus CalculateArithmeticOpDataLogistic(TfLiteContext* context,
                                                TfLiteNode* node,
                                                OpDataLogistic* data) {
@@ -38,8 +42,11 @@ TfLiteStatus CalculateArithmeticOpDataLogistic(TfLiteContext* context,
   TF_LITE_ENSURE(context, output != nullptr);
 
   TF_LITE_ENSURE_TYPES_EQ(context, input->type, output->type);
-  if (input->type == kTfLiteInt8) {
-    TF_LITE_ENSURE_EQ(context, output->params.zero_point,
+  if (input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) {
+    // uint8 is handled as int8 with both zero points shifted by 128, so both
+    // types share the same fixed-point parameters.
+    const int32_t offset = input->type == kTfLiteUInt8 ? 128 : 0;
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point - offset,
                       std::numeric_limits<int8_t>::min());
 
     static constexpr int kInputIntegerBits = 4;
@@ -47,13 +54,31 @@ TfLiteStatus CalculateArithmeticOpDataLogistic(TfLiteContext* context,
         static_cast<double>(input->params.scale) *
         static_cast<double>(1 << (31 - kInputIntegerBits));
 
-    data->input_zero_point = input->params.zero_point;
+    data->input_zero_point = input->params.zero_point - offset;
 
     const double q = std::frexp(input_real_multiplier, &data->input_left_shift);
     data->input_multiplier = static_cast<int32_t>(TfLiteRound(q * (1ll << 31)));
 
     data->input_range_radius =
         CalculateInputRadius(kInputIntegerBits, data->input_left_shift, 31);
+
+    // An 8-bit input has only 256 possible values, so run the fixed-point
+    // reference once over all of them and make Eval a table lookup.
+    data->table = static_cast<uint8_t*>(
+        context->AllocatePersistentBuffer(context, kLogisticTableSize));
+    TF_LITE_ENSURE(context, data->table != nullptr);
+    int8_t input_values[kLogisticTableSize];
+    int8_t output_values[kLogisticTableSize];
+    for (int i = 0; i < kLogisticTableSize; ++i) {
+      input_values[i] = static_cast<int8_t>(i - offset);
+    }
+    reference_integer_ops::Logistic(
+        data->input_zero_point, data->input_range_radius,
+        data->input_multiplier, data->input_left_shift, kLogisticTableSize,
+        input_values, output_values);
+    for (int i = 0; i < kLogisticTableSize; ++i) {
+      data->table[i] = static_cast<uint8_t>(output_values[i] + offset);
+    }
   }
   return kTfLiteOk;
 }
@@ -28,6 +28,54 @@ limitations under the License.
 namespace tflite {
 namespace {
 
+// 8-bit softmax through the exp table built in SoftmaxPrepare. Each row costs
+// a max reduction, one table lookup per element for the sum and one per
+// element for the normalization; the reciprocal of the sum is taken once per
+// row so the inner loops are multiply-and-shift only.
+template <typename T>
+void SoftmaxLookup(const SoftmaxParams& op_data,
+                   const RuntimeShape& input_shape, const T* input_data,
+                   const RuntimeShape& output_shape, T* output_data) {
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size =
+      MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth =
+      MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+  const int16_t* exp_lut = op_data.exp_lut;
+  // Outputs are in units of 1/256; the normalized value is
+  // (exp * reciprocal) >> kReciprocalShift with a Q(8 + kReciprocalShift)
+  // reciprocal of the row sum.
+  constexpr int kReciprocalShift = 23;
+  constexpr int32_t kOutputMax = std::numeric_limits<T>::max();
+
+  for (int i = 0; i < outer_size; ++i) {
+    const T* input_row = input_data + i * depth;
+    T* output_row = output_data + i * depth;
+
+    T max_val = input_row[0];
+    for (int j = 1; j < depth; ++j) {
+      max_val = std::max(max_val, input_row[j]);
+    }
+
+    uint32_t sum = 0;
+    for (int j = 0; j < depth; ++j) {
+      sum += exp_lut[max_val - input_row[j]];
+    }
+
+    const uint32_t reciprocal =
+        ((1u << (8 + kReciprocalShift)) + sum / 2) / sum;
+    for (int j = 0; j < depth; ++j) {
+      const uint32_t exp_val = exp_lut[max_val - input_row[j]];
+      const int32_t unclamped =
+          static_cast<int32_t>((exp_val * reciprocal +
+                                (1u << (kReciprocalShift - 1))) >>
+                               kReciprocalShift) +
+          op_data.zero_point;
+      output_row[j] = static_cast<T>(std::min(unclamped, kOutputMax));
+    }
+  }
+}
+
 void SoftmaxQuantized(const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
                       const SoftmaxParams& op_data) {
   if (input->type == kTfLiteInt8) {
@@ -38,12 +86,16 @@ void SoftmaxQuantized(const TfLiteEvalTensor* input, TfLiteEvalTensor* output,
           tflite::micro::GetTensorShape(output),
           tflite::micro::GetTensorData<int16_t>(output));
     } else {
-      tflite::reference_ops::Softmax(
-          op_data, tflite::micro::GetTensorShape(input),
-          tflite::micro::GetTensorData<int8_t>(input),
-          tflite::micro::GetTensorShape(output),
-          tflite::micro::GetTensorData<int8_t>(output));
+      SoftmaxLookup(op_data, tflite::micro::GetTensorShape(input),
+                    tflite::micro::GetTensorData<int8_t>(input),
+                    tflite::micro::GetTensorShape(output),
+                    tflite::micro::GetTensorData<int8_t>(output));
     }
+  } else if (input->type == kTfLiteUInt8) {
+    SoftmaxLookup(op_data, tflite::micro::GetTensorShape(input),
+                  tflite::micro::GetTensorData<uint8_t>(input),
+                  tflite::micro::GetTensorShape(output),
+                  tflite::micro::GetTensorData<uint8_t>(output));
   } else {
     tflite::reference_ops::SoftmaxInt16(
         op_data, tflite::micro::GetTensorShape(input),
@@ -70,6 +122,7 @@ TfLiteStatus SoftmaxEval(TfLiteContext* context, TfLiteNode* node) {
       return kTfLiteOk;
     }
     case kTfLiteInt8:
+    case kTfLiteUInt8:
     case kTfLiteInt16: {
       SoftmaxQuantized(input, output, op_data);
       return kTfLiteOk;
@@ -26,13 +26,20 @@ namespace tflite {
 namespace {
 // Softmax parameter data that persists in user_data
 const int kInt16LUTArraySize = 513;
+const int kInt8LUTArraySize = 256;
+// Largest row length whose sum of Q0.15 exp values still fits in 31 bits.
+const int kInt8MaxDepth = 65536;
 
 TfLiteStatus CalculateSoftmaxParams(TfLiteContext* context,
                                     const TfLiteTensor* input,
                                     TfLiteTensor* output,
                                     const TfLiteSoftmaxParams* params,
                                     SoftmaxParams* op_data) {
-  if (input->type == kTfLiteInt8 || input->type == kTfLiteInt16) {
+  if (input->type == kTfLiteUInt8) {
+    TF_LITE_ENSURE_TYPES_EQ(context, output->type, kTfLiteUInt8);
+    TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
+    TF_LITE_ENSURE(context, output->params.scale == 1.f / 256);
+  } else if (input->type == kTfLiteInt8 || input->type == kTfLiteInt16) {
     if (input->type == kTfLiteInt16) {
       TF_LITE_ENSURE_EQ(context, output->params.zero_point, 0);
       TF_LITE_ENSURE_NEAR(context, output->params.scale, 1.f / 32768,
@@ -100,7 +107,7 @@ TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
 
   TF_LITE_ENSURE(context, node->user_data != nullptr);
   SoftmaxParams* op_data = static_cast<SoftmaxParams*>(node->user_data);
-  // Only allocate LUTs for KTfLiteInt16 data type
+  // Only allocate the interpolated LUTs for KTfLiteInt16 data type
   if (input->type == kTfLiteInt16) {
     void* raw_exp_lut = context->AllocatePersistentBuffer(
         context, sizeof(int16_t) * kInt16LUTArraySize);
@@ -136,6 +143,27 @@ TfLiteStatus SoftmaxPrepare(TfLiteContext* context, TfLiteNode* node) {
   }
 
   auto* params = static_cast<TfLiteSoftmaxParams*>(node->builtin_data);
+
+  // 8-bit outputs come from a 256-entry exp table indexed by the distance
+  // d = max - x from the row maximum: exp_lut[d] = exp(-beta * scale * d) in
+  // Q0.15. The int8 -> int16 variant keeps using the reference kernel.
+  if ((input->type == kTfLiteInt8 || input->type == kTfLiteUInt8) &&
+      output->type == input->type) {
+    const int depth = input->dims->data[NumDimensions(input) - 1];
+    TF_LITE_ENSURE(context, depth <= kInt8MaxDepth);
+    void* raw_exp_lut = context->AllocatePersistentBuffer(
+        context, sizeof(int16_t) * kInt8LUTArraySize);
+    TF_LITE_ENSURE(context, raw_exp_lut != nullptr);
+    op_data->exp_lut = reinterpret_cast<int16_t*>(raw_exp_lut);
+    const double scale = static_cast<double>(input->params.scale) *
+                         static_cast<double>(params->beta);
+    for (int d = 0; d < kInt8LUTArraySize; ++d) {
+      op_data->exp_lut[d] = static_cast<int16_t>(TfLiteRound(
+          std::exp(-scale * d) * std::numeric_limits<int16_t>::max()));
+    }
+    op_data->zero_point = output->params.zero_point;
+  }
+
   return CalculateSoftmaxParams(context, input, output, params, op_data);
 }
 
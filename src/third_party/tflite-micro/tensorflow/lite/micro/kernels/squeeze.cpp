@@ -90,8 +90,11 @@ TfLiteStatus Eval(TfLiteContext* context, TfLiteNode* node) {
   }
 
   TF_LITE_ENSURE_EQ(context, op_context.input->bytes, op_context.output->bytes);
-  memcpy(op_context.output->data.raw, op_context.input->data.raw,
-         op_context.input->bytes);
+  // Do nothing for in-place squeeze.
+  if (op_context.input->data.raw != op_context.output->data.raw) {
+    memcpy(op_context.output->data.raw, op_context.input->data.raw,
+           op_context.input->bytes);
+  }
   return kTfLiteOk;
 }
 
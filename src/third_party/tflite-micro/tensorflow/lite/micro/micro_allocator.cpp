@@ -80,6 +80,103 @@ class MicroBuiltinDataAllocator : public BuiltinDataAllocator {
   SimpleMemoryAllocator* memory_allocator_;
 };
 
+// True if the shape of tensor is fully known when the model is loaded.
+bool HasStaticShape(const Tensor* tensor) {
+  if (tensor->shape() == nullptr) {
+    return true;
+  }
+  for (const int32_t dim : *tensor->shape()) {
+    if (dim < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Size of the buffer planned for tensor, or 0 if it does not get one: it has
+// constant data, is a variable or its shape is not known up front.
+size_t PlannedActivationBytes(const Model* model, const Tensor* tensor) {
+  const Buffer* buffer = model->buffers()->Get(tensor->buffer());
+  size_t bytes;
+  size_t type_size;
+  if (tensor->is_variable() || !HasStaticShape(tensor) ||
+      (buffer != nullptr && buffer->data() != nullptr &&
+       buffer->data()->size() > 0) ||
+      BytesRequiredForTensor(*tensor, &bytes, &type_size,
+                             GetMicroErrorReporter()) != kTfLiteOk) {
+    return 0;
+  }
+  return bytes;
+}
+
+// When every dimension in front of the concatenation axis is 1, the output of
+// a CONCATENATION is its inputs stored back to back. The buffer of each input
+// (or of the tensor it is a view of) can then be placed at its slice of the
+// output, so the producers write the output directly and the kernel finds
+// nothing left to copy.
+void AliasConcatenationInputs(const Model* model, const SubGraph* subgraph,
+                              const Operator* op, TensorAlias* aliases) {
+  const ConcatenationOptions* options =
+      op->builtin_options_as_ConcatenationOptions();
+  if (options == nullptr ||
+      options->fused_activation_function() != ActivationFunctionType_NONE ||
+      op->inputs() == nullptr || op->outputs() == nullptr ||
+      op->outputs()->size() != 1 || op->outputs()->Get(0) < 0) {
+    return;
+  }
+  const int output = op->outputs()->Get(0);
+  const Tensor* output_tensor = subgraph->tensors()->Get(output);
+  if (PlannedActivationBytes(model, output_tensor) == 0 ||
+      output_tensor->shape() == nullptr) {
+    return;
+  }
+  const int rank = static_cast<int>(output_tensor->shape()->size());
+  const int axis = options->axis() < 0 ? options->axis() + rank
+                                       : options->axis();
+  if (axis < 0 || axis >= rank) {
+    return;
+  }
+  for (int d = 0; d < axis; ++d) {
+    if (output_tensor->shape()->Get(d) != 1) {
+      return;
+    }
+  }
+
+  const int output_owner = ResolveTensorAlias(aliases, output, nullptr);
+  size_t slice_offset = 0;
+  for (size_t n = 0; n < op->inputs()->size(); ++n) {
+    const int input = op->inputs()->Get(n);
+    if (input < 0) {
+      return;
+    }
+    const Tensor* input_tensor = subgraph->tensors()->Get(input);
+    size_t bytes;
+    size_t type_size;
+    if (input_tensor->type() != output_tensor->type() ||
+        BytesRequiredForTensor(*input_tensor, &bytes, &type_size,
+                               GetMicroErrorReporter()) != kTfLiteOk) {
+      return;
+    }
+    // Move the buffer the input lives in, if the input is all of it and it
+    // is only read on the way to this concatenation: a buffer that other
+    // operators also read would keep the whole output alive for longer.
+    // Inputs and outputs of the subgraph keep their own buffers, and an input
+    // that is already part of the output (e.g. passed twice) is copied.
+    size_t view_offset;
+    const int owner = ResolveTensorAlias(aliases, input, &view_offset);
+    if (owner != output_owner && view_offset == 0 &&
+        PlannedActivationBytes(model, subgraph->tensors()->Get(owner)) ==
+            bytes &&
+        NumTensorReaders(subgraph, owner) == 1 &&
+        !TensorListContains(subgraph->inputs(), owner) &&
+        !TensorListContains(subgraph->outputs(), owner)) {
+      aliases[owner].target = output;
+      aliases[owner].offset = slice_offset;
+    }
+    slice_offset += bytes;
+  }
+}
+
 // A helper class to construct AllocationInfo array. This array contains the
 // lifetime of tensors / scratch_buffer and will be used to calculate the memory
 // plan. Methods need to be called in order from `Init`, `Add*`, to `Finish`.
@@ -99,10 +196,13 @@ class AllocationInfoBuilder {
   TfLiteStatus GetOfflinePlannedOffsets(
       const Model* model, const int32_t** offline_planner_offsets);
 
-  // Add allocaiton information for the tensors.
+  // Add allocaiton information for the tensors. If preserve_inputs is set,
+  // the subgraph inputs stay allocated for the whole invocation.
   TfLiteStatus AddTensors(const SubGraph* subgraph,
                           const int32_t* offline_offsets,
-                          TfLiteEvalTensor* eval_tensors);
+                          TfLiteEvalTensor* eval_tensors,
+                          const TensorAlias* tensor_aliases,
+                          bool preserve_inputs);
 
   // Add allocation information for the scratch buffers.
   TfLiteStatus AddScratchBuffers(
@@ -119,9 +219,10 @@ class AllocationInfoBuilder {
   ErrorReporter* reporter_ = nullptr;
 };
 
-TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
-                                               const int32_t* offline_offsets,
-                                               TfLiteEvalTensor* eval_tensors) {
+TfLiteStatus AllocationInfoBuilder::AddTensors(
+    const SubGraph* subgraph, const int32_t* offline_offsets,
+    TfLiteEvalTensor* eval_tensors, const TensorAlias* tensor_aliases,
+    bool preserve_inputs) {
   TFLITE_DCHECK(eval_tensors != nullptr);
 
   // Set up allocation info for all tensors.
@@ -145,11 +246,16 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
 
   uint32_t operators_size = NumSubgraphOperators(subgraph);
 
-  for (size_t i = 0;
-       subgraph->inputs() != nullptr && i < subgraph->inputs()->size(); ++i) {
+  // On request, inputs are also kept to the end of the invocation, so that
+  // the application can write the next input in place while Invoke() runs,
+  // once the operators that read the current one are done.
+  for (size_t i = 0; preserve_inputs && subgraph->inputs() != nullptr &&
+                     i < subgraph->inputs()->size();
+       ++i) {
     const int tensor_index = subgraph->inputs()->Get(i);
     AllocationInfo* current = &info_[tensor_index];
     current->first_created = 0;
+    current->last_used = operators_size - 1;
   }
 
   // Mark all outputs as persistent to the end of the invocation.
@@ -184,6 +290,26 @@ TfLiteStatus AllocationInfoBuilder::AddTensors(const SubGraph* subgraph,
       }
     }
   }
+
+  // An aliased tensor is not planned itself; the tensor that owns the buffer
+  // is kept alive for the lifetime of both instead.
+  for (size_t i = 0; tensor_aliases != nullptr && i < tensor_count_; ++i) {
+    if (tensor_aliases[i].target < 0) {
+      continue;
+    }
+    AllocationInfo* alias = &info_[i];
+    AllocationInfo* owner =
+        &info_[ResolveTensorAlias(tensor_aliases, i, nullptr)];
+    alias->needs_allocating = false;
+    if ((alias->first_created != -1) &&
+        ((owner->first_created == -1) ||
+         (owner->first_created > alias->first_created))) {
+      owner->first_created = alias->first_created;
+    }
+    if (owner->last_used < alias->last_used) {
+      owner->last_used = alias->last_used;
+    }
+  }
   return kTfLiteOk;
 }
 
@@ -437,7 +563,8 @@ TfLiteStatus InitializeTfLiteTensorFromFlatbuffer(
 }
 
 TfLiteStatus InitializeTfLiteEvalTensorFromFlatbuffer(
-    SimpleMemoryAllocator* allocator, const tflite::Tensor& flatbuffer_tensor,
+    SimpleMemoryAllocator* /*allocator*/,
+    const tflite::Tensor& flatbuffer_tensor,
     const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers,
     ErrorReporter* error_reporter, TfLiteEvalTensor* result) {
   *result = {};
@@ -460,6 +587,66 @@ TfLiteStatus InitializeTfLiteEvalTensorFromFlatbuffer(
 
 }  // namespace internal
 
+int ResolveTensorAlias(const TensorAlias* tensor_aliases, int tensor_index,
+                       size_t* offset) {
+  size_t total_offset = 0;
+  while (tensor_aliases[tensor_index].target >= 0) {
+    total_offset += tensor_aliases[tensor_index].offset;
+    tensor_index = tensor_aliases[tensor_index].target;
+  }
+  if (offset != nullptr) {
+    *offset = total_offset;
+  }
+  return tensor_index;
+}
+
+void FindTensorAliases(const Model* model, int subgraph_idx,
+                       TensorAlias* aliases) {
+  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+  const int tensor_count = static_cast<int>(subgraph->tensors()->size());
+  for (int i = 0; i < tensor_count; ++i) {
+    aliases[i].target = -1;
+    aliases[i].offset = 0;
+  }
+  const int operators_size = static_cast<int>(NumSubgraphOperators(subgraph));
+
+  // Shape-only operators: the output is a view of the input.
+  for (int i = 0; i < operators_size; ++i) {
+    const Operator* op = subgraph->operators()->Get(i);
+    const BuiltinOperator code =
+        GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+    if ((code != BuiltinOperator_RESHAPE && code != BuiltinOperator_SQUEEZE &&
+         code != BuiltinOperator_EXPAND_DIMS) ||
+        op->inputs() == nullptr || op->inputs()->size() < 1 ||
+        op->outputs() == nullptr || op->outputs()->size() != 1) {
+      continue;
+    }
+    const int source = op->inputs()->Get(0);
+    const int view = op->outputs()->Get(0);
+    if (source < 0 || view < 0 || source == view) {
+      continue;
+    }
+    const Tensor* source_tensor = subgraph->tensors()->Get(source);
+    const Tensor* view_tensor = subgraph->tensors()->Get(view);
+    const size_t bytes = PlannedActivationBytes(model, view_tensor);
+    if (bytes > 0 && source_tensor->type() == view_tensor->type() &&
+        PlannedActivationBytes(model, source_tensor) == bytes &&
+        ResolveTensorAlias(aliases, source, nullptr) != view) {
+      aliases[view].target = source;
+    }
+  }
+
+  // Concatenations, in execution order so that the output of one can in turn
+  // be placed in the output of a later one.
+  for (int i = 0; i < operators_size; ++i) {
+    const Operator* op = subgraph->operators()->Get(i);
+    if (GetBuiltinCode(model->operator_codes()->Get(op->opcode_index())) ==
+        BuiltinOperator_CONCATENATION) {
+      AliasConcatenationInputs(model, subgraph, op, aliases);
+    }
+  }
+}
+
 size_t MicroAllocator::GetDefaultTailUsage(bool is_memory_planner_given) {
   // TODO(b/208703041): a template version of AlignSizeUp to make expression
   // shorter.
@@ -562,7 +749,9 @@ SubgraphAllocations* MicroAllocator::StartModelAllocation(const Model* model) {
     return nullptr;
   }
 
-  if (AllocateTfLiteEvalTensors(model, output) != kTfLiteOk ||
+  IndexSubgraphs(model, output);
+  if (AllocateTensorAliases(model, output) != kTfLiteOk ||
+      AllocateTfLiteEvalTensors(model, output) != kTfLiteOk ||
       AllocateNodeAndRegistrations(model, output) != kTfLiteOk) {
     return nullptr;
   }
@@ -589,6 +778,7 @@ TfLiteStatus MicroAllocator::FinishModelAllocation(
         scratch_buffer_handles, scratch_buffer_request_count_));
     TF_LITE_ENSURE_STATUS(CommitStaticMemoryPlan(
         model, subgraph_allocations[subgraph_idx].tensors,
+        subgraph_allocations[subgraph_idx].tensor_aliases,
         *scratch_buffer_handles, subgraph_idx));
     TF_LITE_ENSURE_STATUS(AllocateVariables(
         subgraph, subgraph_allocations[subgraph_idx].tensors));
@@ -597,13 +787,94 @@ TfLiteStatus MicroAllocator::FinishModelAllocation(
   return kTfLiteOk;
 }
 
+TfLiteStatus MicroAllocator::AliasTensor(
+    const Model* model, SubgraphAllocations* subgraph_allocations,
+    int subgraph_idx, int tensor_index, int target_index, size_t offset) {
+  TFLITE_DCHECK(subgraph_allocations != nullptr);
+  if (!model_is_allocating_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "MicroAllocator: Tensors can only be aliased while "
+                         "a model is allocating");
+    return kTfLiteError;
+  }
+  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+  const int tensor_count = static_cast<int>(subgraph->tensors()->size());
+  TF_LITE_ENSURE(error_reporter_, tensor_index >= 0 &&
+                                      tensor_index < tensor_count &&
+                                      target_index >= 0 &&
+                                      target_index < tensor_count);
+  TF_LITE_ENSURE(error_reporter_,
+                 !subgraph->tensors()->Get(tensor_index)->is_variable() &&
+                     !subgraph->tensors()->Get(target_index)->is_variable());
+
+  SubgraphAllocations* allocations = &subgraph_allocations[subgraph_idx];
+  TfLiteEvalTensor* tensors = allocations->tensors;
+  TF_LITE_ENSURE(error_reporter_, tensors[tensor_index].data.data == nullptr);
+  size_t bytes;
+  size_t target_bytes;
+  TF_LITE_ENSURE_STATUS(
+      TfLiteEvalTensorByteLength(&tensors[tensor_index], &bytes));
+  TF_LITE_ENSURE_STATUS(
+      TfLiteEvalTensorByteLength(&tensors[target_index], &target_bytes));
+  TF_LITE_ENSURE(error_reporter_, offset + bytes <= target_bytes);
+
+  TensorAlias* aliases = allocations->tensor_aliases;
+  TFLITE_DCHECK(aliases != nullptr);
+  // A tensor has at most one target, and following the targets must not
+  // lead back to it.
+  TF_LITE_ENSURE(error_reporter_,
+                 aliases[tensor_index].target < 0 &&
+                     ResolveTensorAlias(aliases, target_index, nullptr) !=
+                         tensor_index);
+  aliases[tensor_index].target = target_index;
+  aliases[tensor_index].offset = offset;
+  return kTfLiteOk;
+}
+
+void MicroAllocator::IndexSubgraphs(const Model* model,
+                                    SubgraphAllocations* subgraph_allocations) {
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
+       subgraph_idx++) {
+    const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+    TFLITE_DCHECK(subgraph != nullptr);
+    SubgraphAllocations* allocations = &subgraph_allocations[subgraph_idx];
+    allocations->flatbuffer_tensors = subgraph->tensors();
+    allocations->tensors_size = subgraph->tensors()->size();
+    allocations->operators_size = NumSubgraphOperators(subgraph);
+    allocations->inputs = FlatBufferVectorToTfLiteTypeArray(subgraph->inputs());
+    allocations->outputs =
+        FlatBufferVectorToTfLiteTypeArray(subgraph->outputs());
+  }
+}
+
+TfLiteStatus MicroAllocator::AllocateTensorAliases(
+    const Model* model, SubgraphAllocations* subgraph_allocations) {
+  for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
+       subgraph_idx++) {
+    const size_t tensor_count = subgraph_allocations[subgraph_idx].tensors_size;
+    TensorAlias* aliases =
+        reinterpret_cast<TensorAlias*>(memory_allocator_->AllocateFromTail(
+            sizeof(TensorAlias) * tensor_count, alignof(TensorAlias)));
+    if (aliases == nullptr) {
+      TF_LITE_REPORT_ERROR(error_reporter_,
+                           "Failed to allocate memory for tensor aliases, "
+                           "%d bytes required",
+                           sizeof(TensorAlias) * tensor_count);
+      return kTfLiteError;
+    }
+    FindTensorAliases(model, subgraph_idx, aliases);
+    subgraph_allocations[subgraph_idx].tensor_aliases = aliases;
+  }
+  return kTfLiteOk;
+}
+
 void* MicroAllocator::AllocatePersistentBuffer(size_t bytes) {
   return memory_allocator_->AllocateFromTail(bytes,
                                              MicroArenaBufferAlignment());
 }
 
 TfLiteStatus MicroAllocator::RequestScratchBufferInArena(size_t bytes,
-                                                         int subgraph_idx,
+                                                         int /*subgraph_idx*/,
                                                          int* buffer_idx) {
   // All scratch buffer requests are stored in the head section of the arena
   // when a model is in the prepare phase. First align a scratch buffer request
@@ -677,16 +948,27 @@ size_t MicroAllocator::used_bytes() const {
   return memory_allocator_->GetUsedBytes();
 }
 
+uint8_t* MicroAllocator::arena() const {
+  return memory_allocator_->GetHeadBuffer();
+}
+
+size_t MicroAllocator::arena_size() const {
+  return memory_allocator_->GetBufferTail() -
+         memory_allocator_->GetHeadBuffer();
+}
+
+size_t MicroAllocator::persistent_bytes() const {
+  return memory_allocator_->GetTailUsedBytes();
+}
+
 TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
     const Model* model, SubgraphAllocations* subgraph_allocations) {
   TFLITE_DCHECK(subgraph_allocations != nullptr);
 
   for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
        subgraph_idx++) {
-    const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
-    TFLITE_DCHECK(subgraph != nullptr);
-
-    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    const size_t operators_size =
+        subgraph_allocations[subgraph_idx].operators_size;
 
     // Initialize NodeAndRegistrations for the subgraph.
     NodeAndRegistration* output = reinterpret_cast<NodeAndRegistration*>(
@@ -706,18 +988,21 @@ TfLiteStatus MicroAllocator::AllocateNodeAndRegistrations(
 TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
     const Model* model, const SubgraphAllocations* subgraph_allocations,
     int tensor_index, int subgraph_index) {
-  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_index);
-  TFLITE_DCHECK(subgraph != nullptr);
-
   // This value is allocated from persistent arena space. It is guaranteed to be
   // around for the lifetime of the application.
   TfLiteTensor* tensor = AllocatePersistentTfLiteTensorInternal();
+  if (tensor == nullptr) {
+    TF_LITE_REPORT_ERROR(
+        error_reporter_,
+        "Failed to allocate memory for a persistent TfLiteTensor");
+    return nullptr;
+  }
 
   // Populate any fields from the flatbuffer, since this TfLiteTensor struct is
   // allocated in the persistent section of the arena, ensure that additional
   // allocations also take place in that section of the arena.
   if (PopulateTfLiteTensorFromFlatbuffer(
-          model, tensor, tensor_index, subgraph_index,
+          model, subgraph_allocations, tensor, tensor_index, subgraph_index,
           /*allocate_temp=*/false) != kTfLiteOk) {
     TF_LITE_REPORT_ERROR(error_reporter_,
                          "Failed to populate a persistent TfLiteTensor struct "
@@ -743,22 +1028,24 @@ TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensor(
 TfLiteTensor* MicroAllocator::AllocateTempTfLiteTensor(
     const Model* model, const SubgraphAllocations* subgraph_allocations,
     int tensor_index, int subgraph_index) {
-  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_index);
-  TFLITE_DCHECK(subgraph != nullptr);
-
   // This value is allocated from temporary arena space. It is guaranteed to be
   // around for at least the scope of the calling function. Since this struct
   // allocation takes place in temp space, no need to own or cleanup.
   TfLiteTensor* tensor =
       reinterpret_cast<TfLiteTensor*>(memory_allocator_->AllocateTemp(
           sizeof(TfLiteTensor), alignof(TfLiteTensor)));
+  if (tensor == nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Failed to allocate memory for a temp TfLiteTensor");
+    return nullptr;
+  }
 
   // Populate any fields from the flatbuffer, since this TfLiteTensor struct is
   // allocated in the temp section of the arena, ensure that additional
   // allocations also take place in that section of the arena.
-  if (PopulateTfLiteTensorFromFlatbuffer(model, tensor, tensor_index,
-                                         subgraph_index,
-                                         /*allocate_temp=*/true) != kTfLiteOk) {
+  if (PopulateTfLiteTensorFromFlatbuffer(
+          model, subgraph_allocations, tensor, tensor_index, subgraph_index,
+          /*allocate_temp=*/true) != kTfLiteOk) {
     TF_LITE_REPORT_ERROR(
         error_reporter_,
         "Failed to populate a temp TfLiteTensor struct from flatbuffer data!");
@@ -790,10 +1077,9 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
 
   for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
        subgraph_idx++) {
-    const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
-    TFLITE_DCHECK(subgraph != nullptr);
-
-    size_t alloc_count = subgraph->tensors()->size();
+    const auto* flatbuffer_tensors =
+        subgraph_allocations[subgraph_idx].flatbuffer_tensors;
+    const size_t alloc_count = subgraph_allocations[subgraph_idx].tensors_size;
     TfLiteEvalTensor* tensors =
         reinterpret_cast<TfLiteEvalTensor*>(memory_allocator_->AllocateFromTail(
             sizeof(TfLiteEvalTensor) * alloc_count, alignof(TfLiteEvalTensor)));
@@ -808,7 +1094,7 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
 
     for (size_t i = 0; i < alloc_count; ++i) {
       TfLiteStatus status = internal::InitializeTfLiteEvalTensorFromFlatbuffer(
-          memory_allocator_, *subgraph->tensors()->Get(i), model->buffers(),
+          memory_allocator_, *flatbuffer_tensors->Get(i), model->buffers(),
           error_reporter_, &tensors[i]);
       if (status != kTfLiteOk) {
         TF_LITE_REPORT_ERROR(error_reporter_, "Failed to initialize tensor %d",
@@ -822,9 +1108,9 @@ TfLiteStatus MicroAllocator::AllocateTfLiteEvalTensors(
 }
 TfLiteStatus MicroAllocator::AllocateVariables(const SubGraph* subgraph,
                                                TfLiteEvalTensor* eval_tensors) {
-  for (size_t i = 0; i < subgraph->tensors()->size(); ++i) {
-    auto* tensor = subgraph->tensors()->Get(i);
-    if (tensor->is_variable()) {
+  const auto* flatbuffer_tensors = subgraph->tensors();
+  for (size_t i = 0; i < flatbuffer_tensors->size(); ++i) {
+    if (flatbuffer_tensors->Get(i)->is_variable()) {
       size_t buffer_size;
       TF_LITE_ENSURE_STATUS(
           TfLiteEvalTensorByteLength(&eval_tensors[i], &buffer_size));
@@ -849,14 +1135,18 @@ TfLiteTensor* MicroAllocator::AllocatePersistentTfLiteTensorInternal() {
 }
 
 TfLiteStatus MicroAllocator::PopulateTfLiteTensorFromFlatbuffer(
-    const Model* model, TfLiteTensor* tensor, int tensor_index,
-    int subgraph_idx, bool allocate_temp) {
+    const Model* model, const SubgraphAllocations* subgraph_allocations,
+    TfLiteTensor* tensor, int tensor_index, int subgraph_idx,
+    bool allocate_temp) {
   // TODO(b/162311891): This method serves as a stub to ensure quantized
   // allocations in the tail can be recorded. Once the interpreter has APIs for
   // accessing buffers on TfLiteEvalTensor this method can be dropped.
+  const auto* flatbuffer_tensors =
+      subgraph_allocations != nullptr
+          ? subgraph_allocations[subgraph_idx].flatbuffer_tensors
+          : model->subgraphs()->Get(subgraph_idx)->tensors();
   return internal::InitializeTfLiteTensorFromFlatbuffer(
-      memory_allocator_, allocate_temp,
-      *model->subgraphs()->Get(subgraph_idx)->tensors()->Get(tensor_index),
+      memory_allocator_, allocate_temp, *flatbuffer_tensors->Get(tensor_index),
       model->buffers(), error_reporter_, tensor);
 }
 
@@ -866,6 +1156,7 @@ ErrorReporter* MicroAllocator::error_reporter() const {
 
 TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
     const Model* model, TfLiteEvalTensor* eval_tensors,
+    const TensorAlias* tensor_aliases,
     ScratchBufferHandle* scratch_buffer_handles, int subgraph_idx) {
   size_t head_usage = 0;
   // Create static memory plan
@@ -903,8 +1194,10 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   const int32_t* offline_planner_offsets = nullptr;
   TF_LITE_ENSURE_STATUS(
       builder.GetOfflinePlannedOffsets(model, &offline_planner_offsets));
-  TF_LITE_ENSURE_STATUS(
-      builder.AddTensors(subgraph, offline_planner_offsets, eval_tensors));
+  // Only the inputs of the model, which the application writes, are kept.
+  TF_LITE_ENSURE_STATUS(builder.AddTensors(
+      subgraph, offline_planner_offsets, eval_tensors, tensor_aliases,
+      preserve_inputs_ && subgraph_idx == 0));
 
   internal::ScratchBufferRequest* scratch_buffer_requests =
       GetScratchBufferRequests();
@@ -944,6 +1237,15 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   TF_LITE_ENSURE_STATUS(CommitPlan(error_reporter_, memory_planner_,
                                    memory_allocator_->GetHeadBuffer(),
                                    allocation_info, allocation_info_count));
+  for (size_t i = 0;
+       tensor_aliases != nullptr && i < subgraph->tensors()->size(); ++i) {
+    if (tensor_aliases[i].target >= 0) {
+      size_t offset;
+      const int owner = ResolveTensorAlias(tensor_aliases, i, &offset);
+      eval_tensors[i].data.data =
+          static_cast<uint8_t*>(eval_tensors[owner].data.data) + offset;
+    }
+  }
 #ifdef TF_LITE_SHOW_MEMORY_USE
   memory_planner_->PrintMemoryPlan();
 #endif
@@ -79,13 +79,53 @@ typedef struct {
   uint8_t* data;
 } ScratchBufferHandle;
 
+// Buffer sharing between two tensors of a subgraph, set up by
+// FindTensorAliases() and MicroAllocator::AliasTensor() before the memory plan
+// is committed.
+typedef struct {
+  // Index of the tensor whose buffer is shared, or -1 if the tensor has a
+  // buffer of its own.
+  int target;
+  // Byte offset of the tensor's data in the buffer of target.
+  size_t offset;
+} TensorAlias;
+
 // Stores all per-subgraph allocations. This includes the node and registration
 // array, tensor list and scratch buffer handles for each subgraph.
 typedef struct {
   NodeAndRegistration* node_and_registrations;
   TfLiteEvalTensor* tensors;
+  // One entry per tensor of the subgraph.
+  TensorAlias* tensor_aliases;
+  // Index of the subgraph's flatbuffer tables, built once by
+  // StartModelAllocation() so that tensor population, Invoke() and the
+  // interpreter's input()/output() do not go through model->subgraphs().
+  const flatbuffers::Vector<flatbuffers::Offset<Tensor>>* flatbuffer_tensors;
+  size_t tensors_size;
+  size_t operators_size;
+  // Subgraph input and output tensor indices, pointing into the flatbuffer.
+  TfLiteIntArray* inputs;
+  TfLiteIntArray* outputs;
 } SubgraphAllocations;
 
+// Fills aliases, one entry per tensor of the subgraph, with the buffers
+// MicroAllocator shares between tensors based on the model alone:
+//  - the output of a shape-only operator (RESHAPE, SQUEEZE, EXPAND_DIMS) is a
+//    view of its input when both are activations of the same type and size,
+//    so the kernel has nothing to copy;
+//  - the inputs of a CONCATENATION along an axis with only 1s in front of it
+//    (or the tensors they are views of) are placed at their slice of the
+//    output, so the producers write the output directly.
+// Offline tools use it to reproduce the memory plan.
+void FindTensorAliases(const Model* model, int subgraph_idx,
+                       TensorAlias* aliases);
+
+// Follows the aliases of tensor_index to the tensor that owns the buffer and
+// returns its index. If offset is given, it receives the byte offset of the
+// tensor's data in that buffer.
+int ResolveTensorAlias(const TensorAlias* tensor_aliases, int tensor_index,
+                       size_t* offset);
+
 // Allocator responsible for allocating memory for all intermediate tensors
 // necessary to invoke a model.
 //
@@ -165,6 +205,18 @@ class MicroAllocator {
       const Model* model, SubgraphAllocations* subgraph_allocations,
       ScratchBufferHandle** scratch_buffer_handles);
 
+  // Makes tensor_index share the buffer of target_index, starting offset
+  // bytes into it, instead of getting a buffer of its own from the memory
+  // plan. The buffer is kept alive for the lifetimes of both tensors. Used by
+  // graph rewrites that let an operator read or write another operator's
+  // tensor in place; must be called between StartModelAllocation() and
+  // FinishModelAllocation(). Neither tensor may be a variable, and
+  // tensor_index may not have constant data.
+  TfLiteStatus AliasTensor(const Model* model,
+                           SubgraphAllocations* subgraph_allocations,
+                           int subgraph_idx, int tensor_index,
+                           int target_index, size_t offset);
+
   // Allocates a TfLiteTensor struct and populates the returned value with
   // properties from the model flatbuffer. This struct is allocated from
   // persistent arena memory is only guaranteed for the lifetime of the
@@ -213,6 +265,23 @@ class MicroAllocator {
   // `FinishModelAllocation`. Otherwise, it will return 0.
   size_t used_bytes() const;
 
+  // Keeps the inputs of the model allocated for the whole invocation instead
+  // of handing their buffers to later operators, at the cost of arena space
+  // (see MicroInterpreter::SetPreserveInputs()). Off by default; must be set
+  // before FinishModelAllocation().
+  void set_preserve_inputs(bool preserve_inputs) {
+    preserve_inputs_ = preserve_inputs;
+  }
+  bool preserve_inputs() const { return preserve_inputs_; }
+
+  // The arena managed by this allocator, and the number of bytes at its end
+  // holding the allocator itself and every persistent allocation. After
+  // FinishModelAllocation() that tail is all the state set up for the model
+  // apart from tensor data (see MicroInterpreter::SaveSnapshot()).
+  uint8_t* arena() const;
+  size_t arena_size() const;
+  size_t persistent_bytes() const;
+
   BuiltinDataAllocator* GetBuiltinDataAllocator();
 
  protected:
@@ -243,25 +312,36 @@ class MicroAllocator {
 
   // Populates a TfLiteTensor struct with data from the model flatbuffer. Any
   // quantization data is allocated from either the tail (persistent) or temp
-  // sections of the arena based on the allocation flag.
-  virtual TfLiteStatus PopulateTfLiteTensorFromFlatbuffer(const Model* model,
-                                                          TfLiteTensor* tensor,
-                                                          int tensor_index,
-                                                          int subgraph_idx,
-                                                          bool allocate_temp);
+  // sections of the arena based on the allocation flag. The tensor is looked
+  // up through the index in subgraph_allocations unless it is nullptr.
+  virtual TfLiteStatus PopulateTfLiteTensorFromFlatbuffer(
+      const Model* model, const SubgraphAllocations* subgraph_allocations,
+      TfLiteTensor* tensor, int tensor_index, int subgraph_idx,
+      bool allocate_temp);
 
   ErrorReporter* error_reporter() const;
 
  private:
+  // Fills in the flatbuffer index fields of every SubgraphAllocations entry.
+  void IndexSubgraphs(const Model* model,
+                      SubgraphAllocations* subgraph_allocations);
+
+  // Allocates the TensorAlias array of each subgraph in the tail and fills it
+  // in with FindTensorAliases().
+  TfLiteStatus AllocateTensorAliases(
+      const Model* model, SubgraphAllocations* subgraph_allocations);
+
   // Commits a memory plan for all non-persistent buffer allocations in the
   // 'head' section of the memory arena. The eval_tensors pointer is the list of
   // pre-allocated TfLiteEvalTensor structs that will point to the buffers that
   // will be allocated into the head section in this function call. The
   // scratch_buffer_handles pointer is the array of pre-allocated
   // ScratchBufferHandle structs that will point to allocated buffers also in
-  // the head section.
+  // the head section. Tensors aliased in tensor_aliases (may be nullptr) are
+  // pointed into the buffers they share.
   virtual TfLiteStatus CommitStaticMemoryPlan(
       const Model* model, TfLiteEvalTensor* eval_tensors,
+      const TensorAlias* tensor_aliases,
       ScratchBufferHandle* scratch_buffer_handles, int subgraph_idx);
 
   // Allocates an array of ScratchBufferHandle structs in the tail section for a
@@ -298,6 +378,8 @@ class MicroAllocator {
   // to ensure that multi-tenant allocations can share the head for buffers.
   size_t max_head_buffer_usage_ = 0;
 
+  bool preserve_inputs_ = false;
+
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
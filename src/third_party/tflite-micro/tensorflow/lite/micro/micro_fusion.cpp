@@ -0,0 +1,263 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_fusion.h"
+
+#include "flatbuffers/flatbuffers.h"  // from @flatbuffers
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/flatbuffer_utils.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace tflite {
+namespace {
+
+// One of the original operators of a fused node, with its own node so the
+// kernel sees the inputs, outputs and user data it was written for.
+struct FusedOperator {
+  const TfLiteRegistration* registration;
+  TfLiteNode node;
+};
+
+struct FusedOpData {
+  FusedOperator* ops;
+  int op_count;
+};
+
+void* FusedInit(TfLiteContext* context, const char* buffer, size_t) {
+  // FuseOperators() passes the FusedOpData as custom initial data.
+  FusedOpData* data =
+      reinterpret_cast<FusedOpData*>(const_cast<char*>(buffer));
+  for (int i = 0; i < data->op_count; ++i) {
+    FusedOperator* op = &data->ops[i];
+    if (op->registration->init != nullptr) {
+      op->node.user_data = op->registration->init(
+          context, reinterpret_cast<const char*>(op->node.builtin_data), 0);
+    }
+  }
+  return data;
+}
+
+void FusedFree(TfLiteContext* context, void* buffer) {
+  FusedOpData* data = static_cast<FusedOpData*>(buffer);
+  for (int i = 0; i < data->op_count; ++i) {
+    const FusedOperator& op = data->ops[i];
+    if (op.registration->free != nullptr) {
+      op.registration->free(context, op.node.user_data);
+    }
+  }
+}
+
+TfLiteStatus FusedPrepare(TfLiteContext* context, TfLiteNode* node) {
+  FusedOpData* data = static_cast<FusedOpData*>(node->user_data);
+  for (int i = 0; i < data->op_count; ++i) {
+    FusedOperator* op = &data->ops[i];
+    if (op->registration->prepare != nullptr) {
+      TF_LITE_ENSURE_OK(context, op->registration->prepare(context, &op->node));
+    }
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus FusedEval(TfLiteContext* context, TfLiteNode* node) {
+  FusedOpData* data = static_cast<FusedOpData*>(node->user_data);
+  for (int i = 0; i < data->op_count; ++i) {
+    FusedOperator* op = &data->ops[i];
+    TF_LITE_ENSURE_OK(context, op->registration->invoke(context, &op->node));
+  }
+  return kTfLiteOk;
+}
+
+TfLiteStatus FusedAwayEval(TfLiteContext*, TfLiteNode*) {
+  return kTfLiteOk;
+}
+
+// Left in place of the operators absorbed into a fused node.
+const TfLiteRegistration kFusedAwayRegistration = {
+    nullptr, nullptr, nullptr, FusedAwayEval, nullptr,
+    BuiltinOperator_CUSTOM, "FUSED", 0};
+
+struct FusionPattern {
+  // The producer writes into the consumer's output, which the consumer then
+  // updates in place.
+  BuiltinOperator producer;
+  BuiltinOperator consumer;
+  TfLiteRegistration registration;
+};
+
+#define TF_LITE_FUSED_REGISTRATION(name)                                     \
+  {                                                                          \
+    FusedInit, FusedFree, FusedPrepare, FusedEval, nullptr,                  \
+        BuiltinOperator_CUSTOM, name, 0                                      \
+  }
+
+const FusionPattern kFusionPatterns[] = {
+    // The SSD class predictor head: the concatenated class logits go through
+    // a sigmoid before the detection postprocess.
+    {BuiltinOperator_CONCATENATION, BuiltinOperator_LOGISTIC,
+     TF_LITE_FUSED_REGISTRATION("CONCATENATION+LOGISTIC")},
+};
+
+#undef TF_LITE_FUSED_REGISTRATION
+
+BuiltinOperator BuiltinCodeOf(const Model* model, const Operator* op) {
+  return GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+}
+
+// True if tensor_index is an activation that is read by exactly one operator
+// and not visible outside the subgraph, so it does not need a buffer of its
+// own.
+bool CanFuseAway(const Model* model, const SubGraph* subgraph,
+                 int tensor_index) {
+  const Tensor* tensor = subgraph->tensors()->Get(tensor_index);
+  const Buffer* buffer = model->buffers()->Get(tensor->buffer());
+  if (tensor->is_variable() ||
+      (buffer->data() != nullptr && buffer->data()->size() > 0) ||
+      TensorListContains(subgraph->inputs(), tensor_index) ||
+      TensorListContains(subgraph->outputs(), tensor_index)) {
+    return false;
+  }
+  return NumTensorReaders(subgraph, tensor_index) == 1;
+}
+
+// Number of elements of tensor, or -1 if its shape is not fully known.
+int64_t ElementCount(const Tensor* tensor) {
+  if (tensor->shape() == nullptr) {
+    return -1;
+  }
+  int64_t count = 1;
+  for (const int32_t dim : *tensor->shape()) {
+    if (dim < 0) {
+      return -1;
+    }
+    count *= dim;
+  }
+  return count;
+}
+
+// True if the two tensors hold the same number of elements of the same type,
+// i.e. one can be stored in the buffer of the other.
+bool HaveSameLayout(const Tensor* a, const Tensor* b) {
+  return a->type() == b->type() && !a->is_variable() && !b->is_variable() &&
+         ElementCount(a) >= 0 && ElementCount(a) == ElementCount(b);
+}
+
+bool MatchInPlace(const Model* model, const SubGraph* subgraph, int op_index,
+                  const FusionPattern& pattern, OperatorFusion* fusion) {
+  if (op_index == 0) {
+    return false;
+  }
+  const Operator* producer = subgraph->operators()->Get(op_index - 1);
+  const Operator* consumer = subgraph->operators()->Get(op_index);
+  if (BuiltinCodeOf(model, producer) != pattern.producer ||
+      producer->outputs() == nullptr || producer->outputs()->size() != 1) {
+    return false;
+  }
+  const int intermediate = producer->outputs()->Get(0);
+  const int output = consumer->outputs()->Get(0);
+  if (!TensorListContains(consumer->inputs(), intermediate) ||
+      !CanFuseAway(model, subgraph, intermediate) ||
+      !HaveSameLayout(subgraph->tensors()->Get(intermediate),
+                      subgraph->tensors()->Get(output))) {
+    return false;
+  }
+  fusion->ops[0] = op_index - 1;
+  fusion->ops[1] = op_index;
+  fusion->op_count = 2;
+  fusion->node = op_index - 1;
+  fusion->aliased_tensors[0] = intermediate;
+  fusion->alias_targets[0] = output;
+  fusion->alias_count = 1;
+  return true;
+}
+
+}  // namespace
+
+bool MatchOperatorFusion(const Model* model, int subgraph_idx, int op_index,
+                         OperatorFusion* fusion) {
+  const SubGraph* subgraph = model->subgraphs()->Get(subgraph_idx);
+  if (subgraph->operators() == nullptr ||
+      op_index >= static_cast<int>(subgraph->operators()->size())) {
+    return false;
+  }
+  const Operator* consumer = subgraph->operators()->Get(op_index);
+  if (consumer->inputs() == nullptr || consumer->outputs() == nullptr ||
+      consumer->outputs()->size() != 1) {
+    return false;
+  }
+  const BuiltinOperator code = BuiltinCodeOf(model, consumer);
+  for (const FusionPattern& pattern : kFusionPatterns) {
+    if (pattern.consumer != code) {
+      continue;
+    }
+    if (MatchInPlace(model, subgraph, op_index, pattern, fusion)) {
+      fusion->registration = &pattern.registration;
+      return true;
+    }
+  }
+  return false;
+}
+
+TfLiteStatus FuseOperators(const Model* model, int subgraph_idx,
+                           SubgraphAllocations* subgraph_allocations,
+                           MicroAllocator* allocator) {
+  NodeAndRegistration* node_and_registrations =
+      subgraph_allocations[subgraph_idx].node_and_registrations;
+  const int operators_size =
+      static_cast<int>(subgraph_allocations[subgraph_idx].operators_size);
+  for (int op_index = 0; op_index < operators_size; ++op_index) {
+    OperatorFusion fusion;
+    if (!MatchOperatorFusion(model, subgraph_idx, op_index, &fusion)) {
+      continue;
+    }
+
+    FusedOpData* data = static_cast<FusedOpData*>(
+        allocator->AllocatePersistentBuffer(sizeof(FusedOpData)));
+    FusedOperator* ops =
+        static_cast<FusedOperator*>(allocator->AllocatePersistentBuffer(
+            sizeof(FusedOperator) * fusion.op_count));
+    if (data == nullptr || ops == nullptr) {
+      MicroPrintf("Failed to allocate memory for fused node %s",
+                  fusion.registration->custom_name);
+      return kTfLiteError;
+    }
+    data->ops = ops;
+    data->op_count = fusion.op_count;
+    for (int i = 0; i < fusion.op_count; ++i) {
+      NodeAndRegistration* original = &node_and_registrations[fusion.ops[i]];
+      TFLITE_DCHECK(original->registration != nullptr);
+      ops[i].registration = original->registration;
+      ops[i].node = original->node;
+      original->registration = &kFusedAwayRegistration;
+    }
+
+    NodeAndRegistration* fused = &node_and_registrations[fusion.node];
+    fused->registration = fusion.registration;
+    fused->node.user_data = nullptr;
+    fused->node.custom_initial_data = data;
+    fused->node.custom_initial_data_size = 0;
+
+    for (int i = 0; i < fusion.alias_count; ++i) {
+      TF_LITE_ENSURE_STATUS(allocator->AliasTensor(
+          model, subgraph_allocations, subgraph_idx,
+          fusion.aliased_tensors[i], fusion.alias_targets[i], 0));
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace tflite
@@ -0,0 +1,78 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_FUSION_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_FUSION_H_
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// Operator fusion, run by MicroInterpreter::AllocateTensors() before the
+// kernels are initialized. A CONCATENATION followed by a LOGISTIC of its
+// output, as on the class predictor head of SSD MobileNetV1, is replaced by
+// one node that prepares and invokes the original kernels back to back: the
+// first kernel writes straight into the output of the second, which then runs
+// in place, so the tensor passed between them shares that buffer (see
+// MicroAllocator::AliasTensor()) instead of getting one of its own. Other
+// producer / in-place consumer pairs can be added to kFusionPatterns in
+// micro_fusion.cpp.
+//
+// The converter already folds RELU6 into CONV_2D and DEPTHWISE_CONV_2D, and
+// the RESHAPE -> CONCATENATION chains of the network need no fusion:
+// FindTensorAliases() makes the reshapes views placed in the concat output.
+//
+// Only tensors that are read by exactly one operator, and are neither inputs
+// nor outputs of the subgraph, are fused away. The second operator of a chain
+// keeps its place in the graph as a no-op "FUSED" node, so node numbers (and
+// MicroOpProfiler reports) still match the model.
+
+constexpr int kMaxFusedOperators = 2;
+
+struct OperatorFusion {
+  // Operator indices of the chain, in execution order.
+  int ops[kMaxFusedOperators];
+  int op_count;
+  // Operator whose node runs the fused chain.
+  int node;
+  // aliased_tensors[i] shares the buffer of alias_targets[i].
+  int aliased_tensors[kMaxFusedOperators - 1];
+  int alias_targets[kMaxFusedOperators - 1];
+  int alias_count;
+  // Registration of the fused node; its custom_name names the chain, e.g.
+  // "CONCATENATION+LOGISTIC".
+  const TfLiteRegistration* registration;
+};
+
+// Returns true and fills in fusion if operator op_index of the subgraph is the
+// last operator of a chain that FuseOperators() replaces. Every operator is
+// part of at most one chain. Only depends on the model, so offline tools can
+// reproduce the tensor aliasing done at runtime.
+bool MatchOperatorFusion(const Model* model, int subgraph_idx, int op_index,
+                         OperatorFusion* fusion);
+
+// Replaces every chain found by MatchOperatorFusion() in the subgraph with a
+// fused node and aliases the tensors passed along it. Must be called after
+// the node and registration data has been set up from the flatbuffer and
+// before the kernels are initialized.
+TfLiteStatus FuseOperators(const Model* model, int subgraph_idx,
+                           SubgraphAllocations* subgraph_allocations,
+                           MicroAllocator* allocator);
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_FUSION_H_
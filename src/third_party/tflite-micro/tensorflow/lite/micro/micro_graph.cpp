@@ -22,6 +22,7 @@ limitations under the License.
 #include "tensorflow/lite/micro/flatbuffer_utils.h"
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_fusion.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
@@ -53,13 +54,23 @@ MicroGraph::MicroGraph(TfLiteContext* context, const Model* model,
 
 MicroGraph::~MicroGraph() {}
 
+TfLiteStatus MicroGraph::FuseSubgraphs() {
+  for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
+       subgraph_idx++) {
+    TF_LITE_ENSURE_STATUS(FuseOperators(model_, subgraph_idx,
+                                        subgraph_allocations_, allocator_));
+  }
+  return kTfLiteOk;
+}
+
 TfLiteStatus MicroGraph::InitSubgraphs() {
   int previous_subgraph_idx = current_subgraph_index_;
 
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
     current_subgraph_index_ = subgraph_idx;
-    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    const size_t operators_size =
+        subgraph_allocations_[subgraph_idx].operators_size;
     for (size_t i = 0; i < operators_size; ++i) {
       TfLiteNode* node =
           &(subgraph_allocations_[subgraph_idx].node_and_registrations[i].node);
@@ -93,7 +104,8 @@ TfLiteStatus MicroGraph::PrepareSubgraphs() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
     current_subgraph_index_ = subgraph_idx;
-    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    const size_t operators_size =
+        subgraph_allocations_[subgraph_idx].operators_size;
     for (size_t i = 0; i < operators_size; ++i) {
       TfLiteNode* node =
           &(subgraph_allocations_[subgraph_idx].node_and_registrations[i].node);
@@ -123,7 +135,8 @@ TfLiteStatus MicroGraph::FreeSubgraphs() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
     current_subgraph_index_ = subgraph_idx;
-    uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+    const size_t operators_size =
+        subgraph_allocations_[subgraph_idx].operators_size;
     for (size_t i = 0; i < operators_size; ++i) {
       TfLiteNode* node =
           &(subgraph_allocations_[subgraph_idx].node_and_registrations[i].node);
@@ -152,7 +165,8 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
                 subgraph_idx, subgraphs_->size());
     return kTfLiteError;
   }
-  uint32_t operators_size = NumSubgraphOperators(model_, subgraph_idx);
+  const size_t operators_size =
+      subgraph_allocations_[subgraph_idx].operators_size;
   for (size_t i = 0; i < operators_size; ++i) {
     TfLiteNode* node =
         &(subgraph_allocations_[subgraph_idx].node_and_registrations[i].node);
@@ -160,6 +174,10 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
                                                  .node_and_registrations[i]
                                                  .registration;
 
+    if (yield_ != nullptr && i > 0) {
+      yield_(yield_context_);
+    }
+
 // This ifdef is needed (even though ScopedMicroProfiler itself is a no-op with
 // -DTF_LITE_STRIP_ERROR_STRINGS) because the function OpNameFromRegistration is
 // only defined for builds with the error strings.
@@ -193,9 +211,10 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
 TfLiteStatus MicroGraph::ResetVariableTensors() {
   for (size_t subgraph_idx = 0; subgraph_idx < subgraphs_->size();
        subgraph_idx++) {
-    const SubGraph* subgraph = (*subgraphs_)[subgraph_idx];
-    for (size_t i = 0; i < subgraph->tensors()->size(); ++i) {
-      auto* tensor = subgraph->tensors()->Get(i);
+    const SubgraphAllocations& allocations =
+        subgraph_allocations_[subgraph_idx];
+    for (size_t i = 0; i < allocations.tensors_size; ++i) {
+      auto* tensor = allocations.flatbuffer_tensors->Get(i);
       if (tensor->is_variable()) {
         size_t buffer_size;
         TF_LITE_ENSURE_STATUS(TfLiteEvalTensorByteLength(
@@ -222,25 +241,23 @@ void MicroGraph::SetSubgraphAllocations(
 }
 
 size_t MicroGraph::NumSubgraphInputs(int subgraph_idx) {
-  return model_->subgraphs()->Get(subgraph_idx)->inputs()->size();
+  return subgraph_allocations_[subgraph_idx].inputs->size;
 }
 
 TfLiteEvalTensor* MicroGraph::GetSubgraphInput(int subgraph_idx,
                                                int input_idx) {
-  int tensor_idx =
-      model_->subgraphs()->Get(subgraph_idx)->inputs()->Get(input_idx);
-  return &subgraph_allocations_[subgraph_idx].tensors[tensor_idx];
+  const SubgraphAllocations& allocations = subgraph_allocations_[subgraph_idx];
+  return &allocations.tensors[allocations.inputs->data[input_idx]];
 }
 
 size_t MicroGraph::NumSubgraphOutputs(int subgraph_idx) {
-  return model_->subgraphs()->Get(subgraph_idx)->outputs()->size();
+  return subgraph_allocations_[subgraph_idx].outputs->size;
 }
 
 TfLiteEvalTensor* MicroGraph::GetSubgraphOutput(int subgraph_idx,
                                                 int output_idx) {
-  int tensor_idx =
-      model_->subgraphs()->Get(subgraph_idx)->outputs()->Get(output_idx);
-  return &subgraph_allocations_[subgraph_idx].tensors[tensor_idx];
+  const SubgraphAllocations& allocations = subgraph_allocations_[subgraph_idx];
+  return &allocations.tensors[allocations.outputs->data[output_idx]];
 }
 
 }  // namespace tflite
@@ -38,6 +38,10 @@ class MicroGraph {
              MicroResourceVariables* resource_variables);
   virtual ~MicroGraph();
 
+  // Replaces chains of operators in every subgraph with fused nodes, see
+  // micro_fusion.h. Must be called before InitSubgraphs().
+  virtual TfLiteStatus FuseSubgraphs();
+
   // Sets up builtin data and calls TfLiteRegistration->Init for every operator
   // in every subgraph in the model.
   virtual TfLiteStatus InitSubgraphs();
@@ -57,6 +61,10 @@ class MicroGraph {
   // Zeros out all variable tensors in all subgraphs in the model.
   virtual TfLiteStatus ResetVariableTensors();
 
+  // The subgraph accessors below and the init / prepare / invoke / free loops
+  // read the flatbuffer index in the subgraph allocations, so they are only
+  // valid once SetSubgraphAllocations() has been called.
+
   // Number of tensor inputs to a specified subgraph in the model.
   virtual size_t NumSubgraphInputs(int subgraph_idx);
 
@@ -87,6 +95,15 @@ class MicroGraph {
   // Get the resource variables for this TFLM graph.
   MicroResourceVariables* GetResourceVariables() { return resource_variables_; }
 
+  // Calls yield(yield_context) between two operators of InvokeSubgraph(),
+  // outside of their profiler events, so that a single-threaded application
+  // can service its I/O while a model runs. yield must not use the
+  // interpreter. nullptr (the default) disables it.
+  void SetYield(void (*yield)(void* yield_context), void* yield_context) {
+    yield_ = yield;
+    yield_context_ = yield_context;
+  }
+
  private:
   TfLiteContext* context_;
   const Model* model_;
@@ -95,6 +112,8 @@ class MicroGraph {
   int current_subgraph_index_;
   MicroResourceVariables* resource_variables_;
   const flatbuffers::Vector<flatbuffers::Offset<SubGraph>>* subgraphs_;
+  void (*yield_)(void* yield_context) = nullptr;
+  void* yield_context_ = nullptr;
 
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
@@ -17,6 +17,7 @@ limitations under the License.
 #include <cstdarg>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 #include "flatbuffers/flatbuffers.h"  // from @flatbuffers
 #include "tensorflow/lite/c/c_api_types.h"
@@ -27,12 +28,150 @@ limitations under the License.
 #include "tensorflow/lite/micro/memory_helpers.h"
 #include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_fusion.h"
 #include "tensorflow/lite/micro/micro_op_resolver.h"
 #include "tensorflow/lite/micro/micro_profiler.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 #include "tensorflow/lite/schema/schema_utils.h"
 
+// Version string of the firmware, mixed into the build id of snapshots, e.g.
+// -DTFLM_SNAPSHOT_BUILD_ID=\"1.2.0\".
+#ifndef TFLM_SNAPSHOT_BUILD_ID
+#define TFLM_SNAPSHOT_BUILD_ID ""
+#endif
+
 namespace tflite {
+namespace {
+
+// "TFMS" when dumped on a little-endian target.
+constexpr uint32_t kSnapshotMagic = 0x534d4654;
+constexpr uint32_t kSnapshotVersion = 3;
+
+// Precedes the copy of the persistent end of the arena in a snapshot.
+// Addresses are stored as 64-bit values so the layout is the same for every
+// target.
+struct SnapshotHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t pointer_size;
+  uint32_t model_hash;
+  uint64_t model;
+  uint64_t model_size;
+  uint64_t op_resolver;
+  uint64_t arena;
+  uint64_t arena_size;
+  uint64_t persistent_bytes;
+  uint32_t persistent_hash;
+  // SnapshotBuildId() of the firmware that took the snapshot.
+  uint32_t build_id;
+  // MicroAllocator::preserve_inputs() the memory plan was made with.
+  uint32_t preserve_inputs;
+  // Interpreter state pointing into the persistent bytes.
+  uint64_t subgraph_allocations;
+  uint64_t scratch_buffer_handles;
+  uint64_t input_tensors;
+  uint64_t output_tensors;
+};
+
+constexpr uint32_t kSnapshotHashSeed = 2166136261u;
+
+// FNV-1a over 32-bit words, continuing from hash, so that a model of a few
+// megabytes takes a quarter of the multiplications of the bytewise variant.
+uint32_t SnapshotHash(const uint8_t* data, size_t size,
+                      uint32_t hash = kSnapshotHashSeed) {
+  size_t i = 0;
+  for (; i + sizeof(uint32_t) <= size; i += sizeof(uint32_t)) {
+    uint32_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    hash = (hash ^ word) * 16777619u;
+  }
+  for (; i < size; ++i) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+uint64_t AddressOf(const void* pointer) {
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+}
+
+template <typename T>
+T* PointerAt(uint64_t address) {
+  return reinterpret_cast<T*>(static_cast<uintptr_t>(address));
+}
+
+// Address of a function, which may be nullptr.
+template <typename F>
+uint64_t EntryPoint(F* function) {
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(function));
+}
+
+template <typename T>
+uint32_t SnapshotHashValue(const T& value, uint32_t hash) {
+  return SnapshotHash(reinterpret_cast<const uint8_t*>(&value), sizeof(value),
+                      hash);
+}
+
+// Identifies the firmware build a snapshot is valid for: TFLM_SNAPSHOT_BUILD_ID,
+// the layout of the structs the snapshot holds, and the entry points of the
+// fusion pass and of every kernel op_resolver returns for the operators of
+// model. Relinking after a change to the kernels moves those entry points; the
+// same sources always give the same id, so builds stay reproducible.
+uint32_t SnapshotBuildId(const Model* model,
+                         const MicroOpResolver& op_resolver) {
+  static const char kBuildId[] = TFLM_SNAPSHOT_BUILD_ID;
+  uint32_t hash = SnapshotHash(reinterpret_cast<const uint8_t*>(kBuildId),
+                               sizeof(kBuildId));
+  const uint32_t layout[] = {
+      sizeof(MicroAllocator),      sizeof(SubgraphAllocations),
+      sizeof(NodeAndRegistration), sizeof(TfLiteTensor),
+      sizeof(TfLiteEvalTensor),    sizeof(ScratchBufferHandle),
+      sizeof(TensorAlias)};
+  hash = SnapshotHashValue(layout, hash);
+  hash = SnapshotHashValue(EntryPoint(&FuseOperators), hash);
+  const auto* opcodes = model->operator_codes();
+  for (size_t i = 0; opcodes != nullptr && i < opcodes->size(); ++i) {
+    const OperatorCode* opcode = opcodes->Get(i);
+    const BuiltinOperator code = GetBuiltinCode(opcode);
+    const TfLiteRegistration* registration = nullptr;
+    if (code != BuiltinOperator_CUSTOM) {
+      registration = op_resolver.FindOp(code);
+    } else if (opcode->custom_code() != nullptr) {
+      registration = op_resolver.FindOp(opcode->custom_code()->c_str());
+    }
+    if (registration == nullptr) {
+      continue;
+    }
+    const uint64_t entry_points[] = {
+        EntryPoint(registration->init), EntryPoint(registration->free),
+        EntryPoint(registration->prepare), EntryPoint(registration->invoke)};
+    hash = SnapshotHashValue(entry_points, hash);
+  }
+  return hash;
+}
+
+// RestoreSnapshot() resets the variable tensors once the arena holds the
+// restored state. Their sizes only depend on the model, so this checks up
+// front that the reset cannot fail after the arena has been overwritten.
+TfLiteStatus CheckVariableTensors(const Model* model,
+                                  ErrorReporter* error_reporter) {
+  for (size_t s = 0; s < model->subgraphs()->size(); ++s) {
+    const auto* tensors = model->subgraphs()->Get(s)->tensors();
+    for (size_t i = 0; tensors != nullptr && i < tensors->size(); ++i) {
+      const Tensor* tensor = tensors->Get(i);
+      if (!tensor->is_variable()) {
+        continue;
+      }
+      size_t bytes;
+      size_t type_size;
+      TF_LITE_ENSURE_STATUS(
+          BytesRequiredForTensor(*tensor, &bytes, &type_size, error_reporter));
+    }
+  }
+  return kTfLiteOk;
+}
+
+}  // namespace
 
 MicroInterpreter::MicroInterpreter(const Model* model,
                                    const MicroOpResolver& op_resolver,
@@ -101,7 +240,8 @@ TfLiteStatus MicroInterpreter::PrepareNodeAndRegistrationDataFromFlatbuffer() {
 //s    
     BuiltinDataAllocator* builtin_data_allocator =
         allocator_.GetBuiltinDataAllocator();
-    uint32_t operators_size = NumSubgraphOperators(subgraph);
+    const size_t operators_size =
+        graph_.GetAllocations()[subgraph_idx].operators_size;
     for (size_t i = 0; i < operators_size; ++i) {
       const auto* op = subgraph->operators()->Get(i);
       const size_t index = op->opcode_index();
@@ -158,8 +298,9 @@ TfLiteStatus MicroInterpreter::PrepareNodeAndRegistrationDataFromFlatbuffer() {
 
           return kTfLiteError;
         }
-        TF_LITE_ENSURE_STATUS(parser(op, error_reporter_, nullptr, (void**)(&builtin_data)));
-
+        TF_LITE_ENSURE_STATUS(parser(op, error_reporter_,
+                                     builtin_data_allocator,
+                                     (void**)(&builtin_data)));
       }
 
       TfLiteIntArray* inputs_array =
@@ -199,6 +340,9 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
 
   TF_LITE_ENSURE_STATUS(PrepareNodeAndRegistrationDataFromFlatbuffer());
 
+  // Fuse operator chains before any kernel sees its node.
+  TF_LITE_ENSURE_STATUS(graph_.FuseSubgraphs());
+
   // Only allow AllocatePersistentBuffer in Init stage.
   context_.AllocatePersistentBuffer = MicroContextAllocatePersistentBuffer;
   context_.RequestScratchBufferInArena = nullptr;
@@ -227,23 +371,26 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
 
   micro_context_.SetScratchBufferHandles(scratch_buffer_handles_);
 
+  const TfLiteIntArray* inputs = graph_.GetAllocations()[0].inputs;
+  const TfLiteIntArray* outputs = graph_.GetAllocations()[0].outputs;
+
   // TODO(b/162311891): Drop these allocations when the interpreter supports
   // handling buffers from TfLiteEvalTensor.
   input_tensors_ =
       reinterpret_cast<TfLiteTensor**>(allocator_.AllocatePersistentBuffer(
-          sizeof(TfLiteTensor*) * inputs_size()));
+          sizeof(TfLiteTensor*) * inputs->size));
   if (input_tensors_ == nullptr) {
     TF_LITE_REPORT_ERROR(
         error_reporter_,
         "Failed to allocate memory for context->input_tensors_, "
         "%d bytes required",
-        sizeof(TfLiteTensor*) * inputs_size());
+        sizeof(TfLiteTensor*) * inputs->size);
     return kTfLiteError;
   }
 
-  for (size_t i = 0; i < inputs_size(); ++i) {
+  for (int i = 0; i < inputs->size; ++i) {
     input_tensors_[i] = allocator_.AllocatePersistentTfLiteTensor(
-        model_, graph_.GetAllocations(), inputs().Get(i), 0);
+        model_, graph_.GetAllocations(), inputs->data[i], 0);
     if (input_tensors_[i] == nullptr) {
       TF_LITE_REPORT_ERROR(error_reporter_,
                            "Failed to initialize input tensor %d", i);
@@ -255,19 +402,19 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   // handling buffers from TfLiteEvalTensor.
   output_tensors_ =
       reinterpret_cast<TfLiteTensor**>(allocator_.AllocatePersistentBuffer(
-          sizeof(TfLiteTensor*) * outputs_size()));
+          sizeof(TfLiteTensor*) * outputs->size));
   if (output_tensors_ == nullptr) {
     TF_LITE_REPORT_ERROR(
         error_reporter_,
         "Failed to allocate memory for context->output_tensors_, "
         "%d bytes required",
-        sizeof(TfLiteTensor*) * outputs_size());
+        sizeof(TfLiteTensor*) * outputs->size);
     return kTfLiteError;
   }
 
-  for (size_t i = 0; i < outputs_size(); ++i) {
+  for (int i = 0; i < outputs->size; ++i) {
     output_tensors_[i] = allocator_.AllocatePersistentTfLiteTensor(
-        model_, graph_.GetAllocations(), outputs().Get(i), 0);
+        model_, graph_.GetAllocations(), outputs->data[i], 0);
     if (output_tensors_[i] == nullptr) {
       TF_LITE_REPORT_ERROR(error_reporter_,
                            "Failed to initialize output tensor %d", i);
@@ -281,6 +428,163 @@ TfLiteStatus MicroInterpreter::AllocateTensors() {
   return kTfLiteOk;
 }
 
+size_t MicroInterpreter::SnapshotSize() const {
+  return sizeof(SnapshotHeader) + allocator_.persistent_bytes();
+}
+
+TfLiteStatus MicroInterpreter::SaveSnapshot(size_t model_size, uint8_t* buffer,
+                                            size_t buffer_size,
+                                            size_t* snapshot_size) {
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "SaveSnapshot() called before AllocateTensors()");
+    return kTfLiteError;
+  }
+  if (buffer_size < SnapshotSize()) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot needs %d bytes, buffer has %d",
+                         SnapshotSize(), buffer_size);
+    return kTfLiteError;
+  }
+  const size_t persistent_bytes = allocator_.persistent_bytes();
+  const uint8_t* persistent =
+      allocator_.arena() + allocator_.arena_size() - persistent_bytes;
+
+  SnapshotHeader header = {};
+  header.magic = kSnapshotMagic;
+  header.version = kSnapshotVersion;
+  header.pointer_size = sizeof(void*);
+  header.model_hash =
+      SnapshotHash(reinterpret_cast<const uint8_t*>(model_), model_size);
+  header.model = AddressOf(model_);
+  header.model_size = model_size;
+  header.op_resolver = AddressOf(&op_resolver_);
+  header.arena = AddressOf(allocator_.arena());
+  header.arena_size = allocator_.arena_size();
+  header.persistent_bytes = persistent_bytes;
+  header.persistent_hash = SnapshotHash(persistent, persistent_bytes);
+  header.build_id = SnapshotBuildId(model_, op_resolver_);
+  header.preserve_inputs = allocator_.preserve_inputs() ? 1 : 0;
+  header.subgraph_allocations = AddressOf(graph_.GetAllocations());
+  header.scratch_buffer_handles = AddressOf(scratch_buffer_handles_);
+  header.input_tensors = AddressOf(input_tensors_);
+  header.output_tensors = AddressOf(output_tensors_);
+
+  std::memcpy(buffer, &header, sizeof(header));
+  std::memcpy(buffer + sizeof(header), persistent, persistent_bytes);
+  *snapshot_size = sizeof(header) + persistent_bytes;
+  return kTfLiteOk;
+}
+
+TfLiteStatus MicroInterpreter::RestoreSnapshot(size_t model_size,
+                                               const uint8_t* snapshot,
+                                               size_t snapshot_size) {
+  if (tensors_allocated_ || graph_.GetAllocations() != nullptr) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "RestoreSnapshot() must be called instead of "
+                         "AllocateTensors()");
+    return kTfLiteError;
+  }
+  SnapshotHeader header;
+  if (snapshot_size < sizeof(header)) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Snapshot is truncated");
+    return kTfLiteError;
+  }
+  std::memcpy(&header, snapshot, sizeof(header));
+  const uint8_t* data = snapshot + sizeof(header);
+  const size_t persistent_bytes = snapshot_size - sizeof(header);
+  if (header.magic != kSnapshotMagic || header.version != kSnapshotVersion ||
+      header.pointer_size != sizeof(void*) ||
+      header.persistent_bytes != persistent_bytes) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot format not supported or truncated");
+    return kTfLiteError;
+  }
+  if (header.build_id != SnapshotBuildId(model_, op_resolver_)) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot was taken by a different firmware build");
+    return kTfLiteError;
+  }
+  if (header.preserve_inputs != (allocator_.preserve_inputs() ? 1u : 0u)) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot was taken with a different input "
+                         "lifetime, see SetPreserveInputs()");
+    return kTfLiteError;
+  }
+  // The snapshot must cover at least what the constructor allocated.
+  if (header.model != AddressOf(model_) || header.model_size != model_size ||
+      header.op_resolver != AddressOf(&op_resolver_) ||
+      header.arena != AddressOf(allocator_.arena()) ||
+      header.arena_size != allocator_.arena_size() ||
+      persistent_bytes < allocator_.persistent_bytes() ||
+      persistent_bytes > allocator_.arena_size()) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot was taken with a different arena, model "
+                         "or op resolver address");
+    return kTfLiteError;
+  }
+  if (SnapshotHash(data, persistent_bytes) != header.persistent_hash) {
+    TF_LITE_REPORT_ERROR(error_reporter_, "Snapshot is corrupted");
+    return kTfLiteError;
+  }
+  if (SnapshotHash(reinterpret_cast<const uint8_t*>(model_), model_size) !=
+      header.model_hash) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Snapshot was taken for a different model");
+    return kTfLiteError;
+  }
+  TF_LITE_ENSURE_STATUS(CheckVariableTensors(model_, error_reporter_));
+
+  // Nothing below can fail. Overwrites the allocator itself, which lives at the very end of the arena,
+  // with its state after AllocateTensors().
+  std::memcpy(allocator_.arena() + allocator_.arena_size() - persistent_bytes,
+              data, persistent_bytes);
+
+  graph_.SetSubgraphAllocations(
+      PointerAt<SubgraphAllocations>(header.subgraph_allocations));
+  scratch_buffer_handles_ =
+      PointerAt<ScratchBufferHandle>(header.scratch_buffer_handles);
+  input_tensors_ = PointerAt<TfLiteTensor*>(header.input_tensors);
+  output_tensors_ = PointerAt<TfLiteTensor*>(header.output_tensors);
+
+  // Same state as at the end of AllocateTensors().
+  context_.AllocatePersistentBuffer = nullptr;
+  context_.RequestScratchBufferInArena = nullptr;
+  context_.GetScratchBuffer = MicroContextGetScratchBuffer;
+  context_.GetExternalContext = MicroContextGetExternalContext;
+  micro_context_.SetScratchBufferHandles(scratch_buffer_handles_);
+
+  TF_LITE_ENSURE_STATUS(ResetVariableTensors());
+
+  tensors_allocated_ = true;
+  return kTfLiteOk;
+}
+
+int MicroInterpreter::LastInputReader(size_t index) {
+  if (!tensors_allocated_ || index >= graph_.NumSubgraphInputs(0)) {
+    return -1;
+  }
+  // Operators may read the input through views placed in its buffer, so
+  // tensors are compared by the buffer they resolve to.
+  const SubgraphAllocations& allocations = graph_.GetAllocations()[0];
+  const TensorAlias* aliases = allocations.tensor_aliases;
+  const int input =
+      ResolveTensorAlias(aliases, allocations.inputs->data[index], nullptr);
+  int last_reader = -1;
+  for (size_t i = 0; i < allocations.operators_size; ++i) {
+    const TfLiteIntArray* inputs =
+        allocations.node_and_registrations[i].node.inputs;
+    for (int n = 0; inputs != nullptr && n < inputs->size; ++n) {
+      const int tensor_index = inputs->data[n];
+      if (tensor_index >= 0 &&
+          ResolveTensorAlias(aliases, tensor_index, nullptr) == input) {
+        last_reader = static_cast<int>(i);
+      }
+    }
+  }
+  return last_reader;
+}
+
 TfLiteStatus MicroInterpreter::Invoke() {
   if (initialization_status_ != kTfLiteOk) {
     TF_LITE_REPORT_ERROR(error_reporter_,
@@ -297,7 +601,12 @@ TfLiteStatus MicroInterpreter::Invoke() {
 }
 
 TfLiteTensor* MicroInterpreter::input(size_t index) {
-  const size_t length = inputs_size();
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Input %d requested before AllocateTensors()", index);
+    return nullptr;
+  }
+  const size_t length = graph_.NumSubgraphInputs(0);
   if (index >= length) {
     TF_LITE_REPORT_ERROR(error_reporter_,
                          "Input index %d out of range (length is %d)", index,
@@ -308,7 +617,12 @@ TfLiteTensor* MicroInterpreter::input(size_t index) {
 }
 
 TfLiteTensor* MicroInterpreter::output(size_t index) {
-  const size_t length = outputs_size();
+  if (!tensors_allocated_) {
+    TF_LITE_REPORT_ERROR(error_reporter_,
+                         "Output %d requested before AllocateTensors()", index);
+    return nullptr;
+  }
+  const size_t length = graph_.NumSubgraphOutputs(0);
   if (index >= length) {
     TF_LITE_REPORT_ERROR(error_reporter_,
                          "Output index %d out of range (length is %d)", index,
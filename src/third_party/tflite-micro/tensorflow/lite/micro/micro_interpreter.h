@@ -69,17 +69,66 @@ class MicroInterpreter {
   // intermediate tensors.
   TfLiteStatus AllocateTensors();
 
+  // Prepared state snapshots, to skip the Init() and Prepare() of every kernel
+  // on later boots. After AllocateTensors(), SaveSnapshot() copies the end of
+  // the arena holding the allocator, node, tensor and kernel data (see
+  // MicroAllocator::persistent_bytes()) to buffer, behind a header recording
+  // the addresses it was taken at and a hash of the model. RestoreSnapshot()
+  // is called in place of AllocateTensors() and copies that state back.
+  //
+  // The snapshot holds raw pointers into the arena, the model and the op
+  // resolver, and kernel data laid out by this build, so it is only valid for
+  // the same firmware with the arena and model at the same addresses.
+  // RestoreSnapshot() checks those addresses, the model hash (model_size is
+  // the size of the flatbuffer the interpreter was created with), a build id
+  // (TFLM_SNAPSHOT_BUILD_ID, the sizes of the structs the snapshot holds and
+  // the addresses of the kernels the op resolver returns for the model), the
+  // integrity of the snapshot and the variable tensors it will reset, and
+  // returns kTfLiteError without touching the arena if any check fails;
+  // AllocateTensors() can then be called as usual. Firmware that changes the
+  // interpreter without moving any kernel should define TFLM_SNAPSHOT_BUILD_ID
+  // to its version string, so that snapshots of older versions are rejected.
+  size_t SnapshotSize() const;
+  TfLiteStatus SaveSnapshot(size_t model_size, uint8_t* buffer,
+                            size_t buffer_size, size_t* snapshot_size);
+  TfLiteStatus RestoreSnapshot(size_t model_size, const uint8_t* snapshot,
+                               size_t snapshot_size);
+
   // In order to support partial graph runs for strided models, this can return
   // values other than kTfLiteOk and kTfLiteError.
   // TODO(b/149795762): Add this to the TfLiteStatus enum.
   TfLiteStatus Invoke();
 
+  // Has Invoke() call yield(yield_context) between operators, see
+  // MicroGraph::SetYield().
+  void SetYield(void (*yield)(void* yield_context), void* yield_context) {
+    graph_.SetYield(yield, yield_context);
+  }
+
+  // Keeps the model inputs allocated for the whole of Invoke(), so that the
+  // next input can be written from yield once LastInputReader() has run,
+  // while the current one is still being processed. Otherwise later
+  // operators reuse the input buffers, which keeps the arena smaller. Must be
+  // called before AllocateTensors() or RestoreSnapshot(); a snapshot is only
+  // restored with the setting it was saved with.
+  void SetPreserveInputs(bool preserve_inputs) {
+    allocator_.set_preserve_inputs(preserve_inputs);
+  }
+
+  // Index of the last operator that reads input(index), directly or through a
+  // tensor sharing its buffer (e.g. a RESHAPE of it), or -1 if none does.
+  // Returns -1 before AllocateTensors().
+  int LastInputReader(size_t index);
+
   // This is the recommended API for an application to pass an external payload
   // pointer as an external context to kernels. The life time of the payload
   // pointer should be at least as long as this interpreter. TFLM supports only
   // one external context.
   TfLiteStatus SetMicroExternalContext(void* external_context_payload);
 
+  // input() and output() return nullptr before AllocateTensors(). They are
+  // served from the subgraph index built by the allocator, whereas the
+  // *_size() and inputs()/outputs() accessors read the flatbuffer.
   TfLiteTensor* input(size_t index);
   size_t inputs_size() const {
     return model_->subgraphs()->Get(0)->inputs()->size();
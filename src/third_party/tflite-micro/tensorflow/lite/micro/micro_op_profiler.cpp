@@ -0,0 +1,210 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "tensorflow/lite/micro/micro_op_profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "tensorflow/lite/kernels/internal/compatibility.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_string.h"
+#include "tensorflow/lite/micro/micro_time.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+namespace tflite {
+namespace {
+
+uint64_t FlatSize(const Tensor* tensor) {
+  uint64_t size = 1;
+  for (const int32_t dim : *tensor->shape()) {
+    size *= static_cast<uint64_t>(dim);
+  }
+  return size;
+}
+
+// Returns the number of multiply-accumulates done by op, or 0 for ops that
+// are not MAC-bound.
+uint32_t ComputeMacs(const Model* model, const SubGraph* subgraph,
+                     const Operator* op) {
+  const auto* inputs = op->inputs();
+  const auto* outputs = op->outputs();
+  if (inputs == nullptr || inputs->size() < 2 || inputs->Get(1) < 0 ||
+      outputs == nullptr || outputs->size() < 1) {
+    return 0;
+  }
+  const Tensor* filter = subgraph->tensors()->Get(inputs->Get(1));
+  const Tensor* output = subgraph->tensors()->Get(outputs->Get(0));
+  if (filter->shape() == nullptr || filter->shape()->size() == 0 ||
+      output->shape() == nullptr) {
+    return 0;
+  }
+
+  // Each output element takes one MAC per filter element of its channel.
+  uint64_t macs_per_output;
+  switch (GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()))) {
+    case BuiltinOperator_CONV_2D:
+    case BuiltinOperator_FULLY_CONNECTED:
+      // Filter is [output channels, ..., input depth].
+      macs_per_output = FlatSize(filter) / filter->shape()->Get(0);
+      break;
+    case BuiltinOperator_DEPTHWISE_CONV_2D:
+      // Filter is [1, height, width, output channels].
+      macs_per_output = FlatSize(filter) /
+                        filter->shape()->Get(filter->shape()->size() - 1);
+      break;
+    default:
+      return 0;
+  }
+  return static_cast<uint32_t>(
+      std::min<uint64_t>(FlatSize(output) * macs_per_output,
+                         std::numeric_limits<uint32_t>::max()));
+}
+
+// Returns 100 * numerator / denominator, for printing with two decimals.
+uint32_t Hundredths(uint64_t numerator, uint64_t denominator) {
+  return denominator == 0
+             ? 0
+             : static_cast<uint32_t>(numerator * 100 / denominator);
+}
+
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+void LogRow(const char* prefix, const char* tag, uint32_t cycles,
+            uint32_t total_cycles, uint32_t macs) {
+  const uint32_t percent =
+      Hundredths(static_cast<uint64_t>(cycles) * 100, total_cycles);
+  if (macs == 0) {
+    MicroPrintf("%s,%s,%u,%u.%u%u,,", prefix, tag, cycles, percent / 100,
+                (percent / 10) % 10, percent % 10);
+    return;
+  }
+  const uint32_t macs_per_cycle = Hundredths(macs, cycles);
+  MicroPrintf("%s,%s,%u,%u.%u%u,%u,%u.%u%u", prefix, tag, cycles,
+              percent / 100, (percent / 10) % 10, percent % 10, macs,
+              macs_per_cycle / 100, (macs_per_cycle / 10) % 10,
+              macs_per_cycle % 10);
+}
+#endif
+
+}  // namespace
+
+void MicroOpProfiler::SetModel(const Model* model) {
+  const SubGraph* subgraph = model->subgraphs()->Get(0);
+  const auto* operators = subgraph->operators();
+  model_nodes_ = std::min(static_cast<int>(operators->size()), kMaxNodes);
+  for (int i = 0; i < model_nodes_; ++i) {
+    nodes_[i].macs = ComputeMacs(model, subgraph, operators->Get(i));
+  }
+  Reset();
+}
+
+uint32_t MicroOpProfiler::BeginEvent(const char* tag) {
+  const int node = std::min(next_node_, kMaxNodes - 1);
+  nodes_[node].tag = tag;
+  start_ticks_ = GetCurrentTimeTicks();
+  return node;
+}
+
+void MicroOpProfiler::EndEvent(uint32_t event_handle) {
+  const int32_t end_ticks = GetCurrentTimeTicks();
+  TFLITE_DCHECK(event_handle < kMaxNodes);
+  nodes_[event_handle].ticks +=
+      static_cast<uint32_t>(TicksElapsed(start_ticks_, end_ticks));
+  num_nodes_ = std::max(num_nodes_, static_cast<int>(event_handle) + 1);
+  ++next_node_;
+  if (model_nodes_ > 0 && next_node_ == model_nodes_) {
+    next_node_ = 0;
+    ++invocations_;
+  }
+}
+
+void MicroOpProfiler::Reset() {
+  for (int i = 0; i < kMaxNodes; ++i) {
+    nodes_[i].ticks = 0;
+  }
+  num_nodes_ = model_nodes_;
+  next_node_ = 0;
+  invocations_ = 0;
+}
+
+uint32_t MicroOpProfiler::TicksToCycles(uint64_t ticks) const {
+  const uint64_t invocations = std::max<uint32_t>(invocations_, 1);
+  return static_cast<uint32_t>(ticks * cpu_clock_hz_ /
+                               (ticks_per_second() * invocations));
+}
+
+void MicroOpProfiler::LogReport() const {
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+  if (ticks_per_second() == 0) {
+    MicroPrintf("No platform timer: micro_time reports 0 ticks per second.");
+    return;
+  }
+
+  uint64_t total_ticks = 0;
+  for (int i = 0; i < num_nodes_; ++i) {
+    total_ticks += nodes_[i].ticks;
+  }
+  const uint32_t total_cycles = TicksToCycles(total_ticks);
+
+  MicroPrintf("\"Node\",\"Op\",\"Cycles\",\"Percent\",\"MACs\",\"MACs/cycle\"");
+  char index[12];
+  for (int i = 0; i < num_nodes_; ++i) {
+    MicroSnprintf(index, sizeof(index), "%d", i);
+    LogRow(index, nodes_[i].tag != nullptr ? nodes_[i].tag : "?",
+           TicksToCycles(nodes_[i].ticks), total_cycles, nodes_[i].macs);
+  }
+
+  // Per op type, in order of first appearance.
+  const char* type_tags[kMaxOpTypes];
+  uint64_t type_ticks[kMaxOpTypes];
+  uint64_t type_macs[kMaxOpTypes];
+  int type_counts[kMaxOpTypes];
+  int num_types = 0;
+  for (int i = 0; i < num_nodes_; ++i) {
+    const char* tag = nodes_[i].tag != nullptr ? nodes_[i].tag : "?";
+    int type = 0;
+    while (type < num_types && std::strcmp(type_tags[type], tag) != 0) {
+      ++type;
+    }
+    if (type == num_types) {
+      if (num_types == kMaxOpTypes) {
+        continue;
+      }
+      type_tags[type] = tag;
+      type_ticks[type] = 0;
+      type_macs[type] = 0;
+      type_counts[type] = 0;
+      ++num_types;
+    }
+    type_ticks[type] += nodes_[i].ticks;
+    type_macs[type] += nodes_[i].macs;
+    ++type_counts[type];
+  }
+
+  MicroPrintf("\"Count\",\"Op\",\"Cycles\",\"Percent\",\"MACs\",\"MACs/cycle\"");
+  for (int type = 0; type < num_types; ++type) {
+    MicroSnprintf(index, sizeof(index), "%d", type_counts[type]);
+    LogRow(index, type_tags[type], TicksToCycles(type_ticks[type]),
+           total_cycles,
+           static_cast<uint32_t>(std::min<uint64_t>(
+               type_macs[type], std::numeric_limits<uint32_t>::max())));
+  }
+  MicroPrintf("Total: %u cycles per Invoke, averaged over %u Invoke(s).",
+              total_cycles, std::max<uint32_t>(invocations_, 1));
+#endif
+}
+
+}  // namespace tflite
@@ -0,0 +1,84 @@
+/* Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+#ifndef TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
+#define TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
+
+#include <cstdint>
+
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_profiler.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite {
+
+// MicroProfiler that aggregates the per-op events recorded by MicroGraph
+// across any number of Invoke() calls, instead of keeping a bounded event log.
+// Time is accumulated per node (event order within an Invoke) and reported per
+// node and per op type, as average CPU cycles per Invoke, percentage of the
+// total and, for CONV_2D, DEPTHWISE_CONV_2D and FULLY_CONNECTED, MACs/cycle.
+//
+// Only the single-subgraph case is supported: nested events (e.g. from
+// control-flow ops invoking other subgraphs) would be attributed to the
+// following nodes.
+class MicroOpProfiler : public MicroProfiler {
+ public:
+  // cpu_clock_hz converts timer ticks (see micro_time.h) into CPU cycles.
+  explicit MicroOpProfiler(uint32_t cpu_clock_hz)
+      : cpu_clock_hz_(cpu_clock_hz) {}
+
+  // Computes the MAC count of every operator in subgraph 0 of the model from
+  // its static tensor shapes. This also tells the profiler how many events
+  // make up one Invoke(); without it every event is treated as a new node and
+  // only a single Invoke() can be reported.
+  void SetModel(const Model* model);
+
+  uint32_t BeginEvent(const char* tag) override;
+  void EndEvent(uint32_t event_handle) override;
+
+  // Clears the accumulated timings. MAC counts from SetModel() are kept.
+  void Reset();
+
+  // Prints the per-node and per-op-type tables in CSV form.
+  void LogReport() const;
+
+ private:
+  static constexpr int kMaxNodes = 128;
+  static constexpr int kMaxOpTypes = 32;
+
+  struct NodeStats {
+    const char* tag;
+    uint64_t ticks;
+    uint32_t macs;
+  };
+
+  // Converts accumulated ticks into average CPU cycles per Invoke().
+  uint32_t TicksToCycles(uint64_t ticks) const;
+
+  NodeStats nodes_[kMaxNodes] = {};
+  // Number of nodes per Invoke() as given by SetModel(), or 0 if unknown.
+  int model_nodes_ = 0;
+  // Highest node index seen plus one.
+  int num_nodes_ = 0;
+  int next_node_ = 0;
+  uint32_t invocations_ = 0;
+  int32_t start_ticks_ = 0;
+  const uint32_t cpu_clock_hz_;
+
+  TF_LITE_REMOVE_VIRTUAL_DELETE;
+};
+
+}  // namespace tflite
+
+#endif  // TENSORFLOW_LITE_MICRO_MICRO_OP_PROFILER_H_
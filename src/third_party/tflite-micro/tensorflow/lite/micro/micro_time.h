@@ -26,6 +26,14 @@ int32_t ticks_per_second();
 // Return time in ticks.  The meaning of a tick varies per platform.
 int32_t GetCurrentTimeTicks();
 
+// Returns the number of ticks from start to end. Hardware counters are free
+// running and wrap around, so the difference is taken modulo 2^32; this is
+// correct as long as the interval is shorter than one counter period.
+inline int32_t TicksElapsed(int32_t start, int32_t end) {
+  return static_cast<int32_t>(static_cast<uint32_t>(end) -
+                              static_cast<uint32_t>(start));
+}
+
 inline int32_t TicksToMs(int32_t ticks) {
   return static_cast<int32_t>(1000.0f * static_cast<float>(ticks) /
                               static_cast<float>(ticks_per_second()));
@@ -150,6 +150,8 @@ size_t SimpleMemoryAllocator::GetTailUsedBytes() const {
   return buffer_tail_ - tail_;
 }
 
+uint8_t* SimpleMemoryAllocator::GetBufferTail() const { return buffer_tail_; }
+
 size_t SimpleMemoryAllocator::GetAvailableMemory(size_t alignment) const {
   uint8_t* const aligned_temp = AlignPointerUp(temp_, alignment);
   uint8_t* const aligned_tail = AlignPointerDown(tail_, alignment);